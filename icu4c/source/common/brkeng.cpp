@@ -21,6 +21,7 @@
 #include "unicode/uscript.h"
 #include "unicode/ucharstrie.h"
 #include "unicode/bytestrie.h"
+#include "unicode/localpointer.h"
 
 #include "brkeng.h"
 #include "cmemory.h"
@@ -32,6 +33,7 @@
 #include "umutex.h"
 #include "uresimp.h"
 #include "ubrkimpl.h"
+#include "ucmndata.h"
 
 U_NAMESPACE_BEGIN
 
@@ -102,6 +104,30 @@ UnhandledEngine::handleCharacter(UChar32 c) {
     }
 }
 
+/*
+ ******************************************************************
+ */
+
+// Create a DictionaryMatcher over dictionary data that follows the data header.
+// The matcher takes ownership of file, which may be NULL.
+static DictionaryMatcher *
+createDictionaryMatcher(const uint8_t *data, UDataMemory *file) {
+    const int32_t *indexes = (const int32_t *)data;
+    const int32_t offset = indexes[DictionaryData::IX_STRING_TRIE_OFFSET];
+    const int32_t trieType = indexes[DictionaryData::IX_TRIE_TYPE] & DictionaryData::TRIE_TYPE_MASK;
+    DictionaryMatcher *m = NULL;
+    if (trieType == DictionaryData::TRIE_TYPE_BYTES) {
+        const int32_t transform = indexes[DictionaryData::IX_TRANSFORM];
+        const char *characters = (const char *)(data + offset);
+        m = new BytesDictionaryMatcher(characters, transform, file);
+    }
+    else if (trieType == DictionaryData::TRIE_TYPE_UCHARS) {
+        const UChar *characters = (const UChar *)(data + offset);
+        m = new UCharsDictionaryMatcher(characters, file);
+    }
+    return m;
+}
+
 /*
  ******************************************************************
  */
@@ -251,19 +277,7 @@ ICULanguageBreakFactory::loadDictionaryMatcherFor(UScriptCode script) {
     if (U_SUCCESS(status)) {
         // build trie
         const uint8_t *data = (const uint8_t *)udata_getMemory(file);
-        const int32_t *indexes = (const int32_t *)data;
-        const int32_t offset = indexes[DictionaryData::IX_STRING_TRIE_OFFSET];
-        const int32_t trieType = indexes[DictionaryData::IX_TRIE_TYPE] & DictionaryData::TRIE_TYPE_MASK;
-        DictionaryMatcher *m = NULL;
-        if (trieType == DictionaryData::TRIE_TYPE_BYTES) {
-            const int32_t transform = indexes[DictionaryData::IX_TRANSFORM];
-            const char *characters = (const char *)(data + offset);
-            m = new BytesDictionaryMatcher(characters, transform, file);
-        }
-        else if (trieType == DictionaryData::TRIE_TYPE_UCHARS) {
-            const UChar *characters = (const UChar *)(data + offset);
-            m = new UCharsDictionaryMatcher(characters, file);
-        }
+        DictionaryMatcher *m = createDictionaryMatcher(data, file);
         if (m == NULL) {
             // no matcher exists to take ownership - either we are an invalid 
             // type or memory allocation failed
@@ -279,6 +293,145 @@ ICULanguageBreakFactory::loadDictionaryMatcherFor(UScriptCode script) {
     return NULL;
 }
 
+/*
+ ******************************************************************
+ */
+
+static UMutex gUserBreakEngineMutex;
+
+U_NAMESPACE_END
+U_CDECL_BEGIN
+static void U_CALLCONV _releaseUserEngine(void *obj) {
+    ((const icu::UserDictionaryBreakEngine *) obj)->removeReference();
+}
+U_CDECL_END
+U_NAMESPACE_BEGIN
+
+UserLanguageBreakFactory::UserLanguageBreakFactory(UErrorCode &status) {
+    fEngines = new UStack(_releaseUserEngine, NULL, status);
+    if (U_SUCCESS(status) && fEngines == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
+UserLanguageBreakFactory::~UserLanguageBreakFactory() {
+    delete fEngines;
+}
+
+const LanguageBreakEngine *
+UserLanguageBreakFactory::getEngineFor(UChar32 c) {
+    // Add the caller's reference while holding the mutex,
+    // so that removeDictionary() cannot delete the engine in between.
+    Mutex m(&gUserBreakEngineMutex);
+    if (fEngines == NULL) {
+        return NULL;
+    }
+    int32_t i = fEngines->size();
+    while (--i >= 0) {
+        const UserDictionaryBreakEngine *lbe = (const UserDictionaryBreakEngine *)(fEngines->elementAt(i));
+        if (lbe->handles(c)) {
+            return lbe->addReference();
+        }
+    }
+    return NULL;
+}
+
+void
+UserLanguageBreakFactory::releaseEngine(const LanguageBreakEngine *engine) {
+    const UserDictionaryBreakEngine *user = dynamic_cast<const UserDictionaryBreakEngine *>(engine);
+    if (user != NULL) {
+        user->removeReference();
+    }
+}
+
+URegistryKey
+UserLanguageBreakFactory::addDictionary(const UnicodeSet &chars, const void *dictData, int32_t length,
+                                        UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    if (fEngines == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    if (chars.isEmpty() || dictData == NULL || U_POINTER_MASK_LSB(dictData, 3) != 0 ||
+            length < (int32_t)sizeof(DataHeader)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+
+    // Check the data header. The data is used in place, so it must match
+    // the platform; a foreign-endian dictionary would have to be swapped first.
+    const DataHeader *header = (const DataHeader *)dictData;
+    const UDataInfo *pInfo = &header->info;
+    if (!(header->dataHeader.magic1 == 0xda &&
+          header->dataHeader.magic2 == 0x27 &&
+          pInfo->isBigEndian == U_IS_BIG_ENDIAN &&
+          pInfo->charsetFamily == U_CHARSET_FAMILY &&
+          pInfo->dataFormat[0] == 0x44 &&   // dataFormat="Dict"
+          pInfo->dataFormat[1] == 0x69 &&
+          pInfo->dataFormat[2] == 0x63 &&
+          pInfo->dataFormat[3] == 0x74 &&
+          pInfo->formatVersion[0] == 1)) {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    int32_t headerSize = udata_getHeaderSize(header);
+    const uint8_t *data = (const uint8_t *)dictData + headerSize;
+    length -= headerSize;
+    const int32_t *indexes = (const int32_t *)data;
+    if (length < DictionaryData::IX_COUNT * 4 ||
+            indexes[DictionaryData::IX_STRING_TRIE_OFFSET] < DictionaryData::IX_COUNT * 4 ||
+            indexes[DictionaryData::IX_TOTAL_SIZE] > length ||
+            indexes[DictionaryData::IX_STRING_TRIE_OFFSET] >= indexes[DictionaryData::IX_TOTAL_SIZE]) {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    const int32_t trieType = indexes[DictionaryData::IX_TRIE_TYPE] & DictionaryData::TRIE_TYPE_MASK;
+    if (trieType != DictionaryData::TRIE_TYPE_BYTES && trieType != DictionaryData::TRIE_TYPE_UCHARS) {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+
+    DictionaryMatcher *m = createDictionaryMatcher(data, NULL);
+    if (m == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    LocalPointer<UserDictionaryBreakEngine> engine(new UserDictionaryBreakEngine(m, chars, status), status);
+    if (U_FAILURE(status)) {
+        if (engine.isNull()) {
+            delete m;
+        }
+        return NULL;
+    }
+
+    Mutex lock(&gUserBreakEngineMutex);
+    fEngines->push(engine.getAlias(), status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return engine.orphan();
+}
+
+UBool
+UserLanguageBreakFactory::removeDictionary(URegistryKey key, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    Mutex lock(&gUserBreakEngineMutex);
+    if (fEngines == NULL) {
+        return FALSE;
+    }
+    int32_t i = fEngines->indexOf((void *)key);
+    if (i < 0) {
+        return FALSE;
+    }
+    // Drops the factory's reference; break iterators may still hold others.
+    fEngines->removeElementAt(i);
+    return TRUE;
+}
+
 U_NAMESPACE_END
 
 #endif /* #if !UCONFIG_NO_BREAK_ITERATION */
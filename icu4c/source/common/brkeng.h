@@ -12,6 +12,7 @@
 
 #include "unicode/utypes.h"
 #include "unicode/uobject.h"
+#include "unicode/umisc.h"
 #include "unicode/utext.h"
 #include "unicode/uscript.h"
 
@@ -265,6 +266,90 @@ class ICULanguageBreakFactory : public LanguageBreakFactory {
   virtual DictionaryMatcher *loadDictionaryMatcherFor(UScriptCode script);
 };
 
+/*******************************************************************
+ * UserLanguageBreakFactory
+ */
+
+/**
+ * <p>UserLanguageBreakFactory holds LanguageBreakEngines built from
+ * dictionaries supplied by the application at run time. It is consulted
+ * before ICULanguageBreakFactory, so a registered dictionary takes
+ * precedence over ICU's own data for the characters it handles.</p>
+ *
+ * <p>Unlike other LanguageBreakFactorys, a UserLanguageBreakFactory may
+ * be shared between threads; engines may be added while it is in use.</p>
+ */
+class UserLanguageBreakFactory : public LanguageBreakFactory {
+ private:
+
+    /**
+     * The stack of break engines registered with this factory.
+     * The factory holds one reference to each of them.
+     * @internal
+     */
+
+  UStack    *fEngines;
+
+ public:
+
+  /**
+   * <p>Standard constructor.</p>
+   *
+   */
+  UserLanguageBreakFactory(UErrorCode &status);
+
+  /**
+   * <p>Virtual destructor.</p>
+   */
+  virtual ~UserLanguageBreakFactory();
+
+ /**
+  * <p>Find and return the most recently registered LanguageBreakEngine
+  * that handles the supplied character. The caller receives a reference
+  * to the engine, which it must give back with releaseEngine().</p>
+  *
+  * @param c A character that begins a run for which a LanguageBreakEngine is
+  * sought.
+  * @return A LanguageBreakEngine with the desired characteristics, or 0.
+  */
+  virtual const LanguageBreakEngine *getEngineFor(UChar32 c);
+
+ /**
+  * <p>Give back a reference to an engine returned by getEngineFor().
+  * Engines from other factories are ignored, so that this can be called
+  * for any LanguageBreakEngine.</p>
+  *
+  * @param engine A LanguageBreakEngine, or NULL.
+  */
+  static void releaseEngine(const LanguageBreakEngine *engine);
+
+ /**
+  * <p>Create a dictionary-based LanguageBreakEngine for a set of characters
+  * and add it to this factory.</p>
+  *
+  * @param chars The set of characters handled by the new engine.
+  * @param dictData A dictionary data file image, as written by gendict,
+  * starting with the standard ICU data header. It is not copied and must
+  * remain valid until the engine is deleted.
+  * @param length The length of dictData in bytes.
+  * @param status Receives U_ILLEGAL_ARGUMENT_ERROR or U_INVALID_FORMAT_ERROR
+  * if the data is not a usable dictionary.
+  * @return A key for removeDictionary(), or NULL on failure.
+  */
+  URegistryKey addDictionary(const UnicodeSet &chars, const void *dictData, int32_t length,
+                             UErrorCode &status);
+
+ /**
+  * <p>Stop handing out the LanguageBreakEngine added with the given key.
+  * The engine is deleted once no break iterator holds it any more.</p>
+  *
+  * @param key The key returned by addDictionary().
+  * @param status The in/out status code.
+  * @return TRUE if an engine was registered for the key.
+  */
+  UBool removeDictionary(URegistryKey key, UErrorCode &status);
+};
+
 U_NAMESPACE_END
 
     /* BRKENG_H */
@@ -1050,6 +1050,98 @@ KhmerBreakEngine::divideUpDictionaryRange( UText *text,
     return wordsFound;
 }
 
+/*
+ ******************************************************************
+ * UserDictionaryBreakEngine
+ */
+
+UserDictionaryBreakEngine::UserDictionaryBreakEngine(DictionaryMatcher *adoptDictionary,
+                                                     const UnicodeSet &chars,
+                                                     UErrorCode &status)
+    : DictionaryBreakEngine(),
+      fDictionary(adoptDictionary),
+      fRefCount(1)
+{
+    UTRACE_ENTRY(UTRACE_UBRK_CREATE_BREAK_ENGINE);
+    UTRACE_DATA1(UTRACE_INFO, "dictbe=%s", "user");
+    setCharacters(chars);
+    fMarkSet.applyPattern(UNICODE_STRING_SIMPLE("[:M:]"), status);
+    fMarkSet.retainAll(chars);
+
+    // Compact for caching.
+    fMarkSet.compact();
+    UTRACE_EXIT_STATUS(status);
+}
+
+UserDictionaryBreakEngine::~UserDictionaryBreakEngine() {
+    delete fDictionary;
+}
+
+const UserDictionaryBreakEngine *
+UserDictionaryBreakEngine::addReference() const {
+    umtx_atomic_inc(&fRefCount);
+    return this;
+}
+
+void
+UserDictionaryBreakEngine::removeReference() const {
+    if (umtx_atomic_dec(&fRefCount) == 0) {
+        delete this;
+    }
+}
+
+int32_t
+UserDictionaryBreakEngine::divideUpDictionaryRange( UText *text,
+                                                    int32_t rangeStart,
+                                                    int32_t rangeEnd,
+                                                    UVector32 &foundBreaks ) const {
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t cuLengths[POSSIBLE_WORD_LIST_MAX];
+    int32_t wordsFound = 0;
+    int32_t current = rangeStart;
+    UBool inUnknownRun = FALSE;
+
+    while (U_SUCCESS(status) && current < rangeEnd) {
+        utext_setNativeIndex(text, current);
+        int32_t count = fDictionary->matches(text, rangeEnd - current, UPRV_LENGTHOF(cuLengths),
+                                             cuLengths, NULL, NULL, NULL);
+        if (count > 0) {
+            // A word starts here. Close off any preceding run of non-dictionary text.
+            if (inUnknownRun) {
+                foundBreaks.push(current, status);
+                wordsFound += 1;
+                inUnknownRun = FALSE;
+            }
+            utext_setNativeIndex(text, current + cuLengths[count - 1]);
+        } else {
+            // No word starts here. Run this character together with whatever
+            // follows, up to the next dictionary word.
+            inUnknownRun = TRUE;
+            utext_setNativeIndex(text, current);
+            utext_next32(text);
+        }
+
+        // Don't break before a combining mark.
+        while ((current = (int32_t)utext_getNativeIndex(text)) < rangeEnd
+                && fMarkSet.contains(utext_current32(text))) {
+            utext_next32(text);
+        }
+
+        if (count > 0) {
+            foundBreaks.push(current, status);
+            wordsFound += 1;
+        }
+    }
+
+    // Don't return a break for the end of the dictionary range if there is one there.
+    if (wordsFound > 0 && foundBreaks.peeki() >= rangeEnd) {
+        (void) foundBreaks.popi();
+        wordsFound -= 1;
+    }
+
+    return wordsFound;
+}
+
 #if !UCONFIG_NO_NORMALIZATION
 /*
  ******************************************************************
@@ -15,6 +15,7 @@
 #include "unicode/utext.h"
 
 #include "brkeng.h"
+#include "umutex.h"
 #include "uvectr32.h"
 
 U_NAMESPACE_BEGIN
@@ -326,10 +327,81 @@ class KhmerBreakEngine : public DictionaryBreakEngine {
   virtual int32_t divideUpDictionaryRange( UText *text, 
                                            int32_t rangeStart, 
                                            int32_t rangeEnd, 
-                                           UVector32 &foundBreaks ) const; 
- 
-}; 
- 
+                                           UVector32 &foundBreaks ) const;
+
+};
+
+/*******************************************************************
+ * UserDictionaryBreakEngine
+ */
+
+/**
+ * <p>UserDictionaryBreakEngine is a kind of DictionaryBreakEngine that uses
+ * an application-supplied DictionaryMatcher to divide a run of characters
+ * into the longest dictionary words. Characters that do not begin any
+ * dictionary word are run together up to the next dictionary word, rather
+ * than being broken apart one at a time.</p>
+ *
+ * <p>After it is constructed a UserDictionaryBreakEngine may be shared between
+ * threads without synchronization. It is reference counted: the
+ * UserLanguageBreakFactory holds one reference while the engine is registered,
+ * and each break iterator that uses it holds another.</p>
+ */
+class UserDictionaryBreakEngine : public DictionaryBreakEngine {
+ private:
+    /**
+     * The set of combining marks that are kept with the preceding character
+     * @internal
+     */
+
+  UnicodeSet                fMarkSet;
+  DictionaryMatcher  *fDictionary;
+  mutable u_atomic_int32_t  fRefCount;
+
+ public:
+
+  /**
+   * <p>Default constructor.</p>
+   *
+   * @param adoptDictionary A DictionaryMatcher to adopt. Deleted when the
+   * engine is deleted.
+   * @param chars The set of characters handled by this engine.
+   */
+  UserDictionaryBreakEngine(DictionaryMatcher *adoptDictionary, const UnicodeSet &chars, UErrorCode &status);
+
+  /**
+   * <p>Virtual destructor.</p>
+   */
+  virtual ~UserDictionaryBreakEngine();
+
+  /**
+   * <p>Add a reference to this engine. The engine starts out with one.</p>
+   * @return This engine.
+   */
+  const UserDictionaryBreakEngine *addReference() const;
+
+  /**
+   * <p>Remove a reference, and delete the engine when it was the last one.</p>
+   */
+  void removeReference() const;
+
+ protected:
+ /**
+  * <p>Divide up a range of known dictionary characters.</p>
+  *
+  * @param text A UText representing the text
+  * @param rangeStart The start of the range of dictionary characters
+  * @param rangeEnd The end of the range of dictionary characters
+  * @param foundBreaks Output of C array of int32_t break positions, or 0
+  * @return The number of breaks found
+  */
+  virtual int32_t divideUpDictionaryRange( UText *text,
+                                           int32_t rangeStart,
+                                           int32_t rangeEnd,
+                                           UVector32 &foundBreaks ) const;
+
+};
+
 #if !UCONFIG_NO_NORMALIZATION
 
 /*******************************************************************
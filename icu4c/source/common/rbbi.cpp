@@ -1109,6 +1109,7 @@ U_NAMESPACE_END
 
 
 static icu::UStack *gLanguageBreakFactories = nullptr;
+static icu::UserLanguageBreakFactory *gUserLanguageBreakFactory = nullptr;
 static const icu::UnicodeString *gEmptyString = nullptr;
 static icu::UInitOnce gLanguageBreakFactoriesInitOnce = U_INITONCE_INITIALIZER;
 static icu::UInitOnce gRBBIInitOnce = U_INITONCE_INITIALIZER;
@@ -1120,6 +1121,7 @@ U_CDECL_BEGIN
 UBool U_CALLCONV rbbi_cleanup(void) {
     delete gLanguageBreakFactories;
     gLanguageBreakFactories = nullptr;
+    gUserLanguageBreakFactory = nullptr;    // Owned by gLanguageBreakFactories.
     delete gEmptyString;
     gEmptyString = nullptr;
     gLanguageBreakFactoriesInitOnce.reset();
@@ -1132,6 +1134,12 @@ U_CDECL_BEGIN
 static void U_CALLCONV _deleteFactory(void *obj) {
     delete (icu::LanguageBreakFactory *) obj;
 }
+
+// Engines from factories are shared, except that those for
+// application dictionaries are reference counted.
+static void U_CALLCONV _releaseEngine(void *obj) {
+    icu::UserLanguageBreakFactory::releaseEngine((const icu::LanguageBreakEngine *) obj);
+}
 U_CDECL_END
 U_NAMESPACE_BEGIN
 
@@ -1153,6 +1161,18 @@ static void U_CALLCONV initLanguageFactories() {
             gLanguageBreakFactories->push(extra, status);
         }
 #endif
+        // Factories are consulted from the top of the stack down, so push the
+        // one holding application dictionaries last.
+        UserLanguageBreakFactory *user = new UserLanguageBreakFactory(status);
+        if (U_SUCCESS(status) && user == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        gLanguageBreakFactories->push(user, status);
+        if (U_SUCCESS(status)) {
+            gUserLanguageBreakFactory = user;
+        } else {
+            delete user;
+        }
     }
     ucln_common_registerCleanup(UCLN_COMMON_RBBI, rbbi_cleanup);
 }
@@ -1179,6 +1199,41 @@ getLanguageBreakEngineFromFactory(UChar32 c)
 }
 
 
+//-------------------------------------------------------------------------------
+//
+//  registerDictionary      Add an application-supplied dictionary, ahead of
+//                          ICU's own, for all break iterators.
+//
+//-------------------------------------------------------------------------------
+URegistryKey U_EXPORT2
+RuleBasedBreakIterator::registerDictionary(const UnicodeSet &chars,
+                                           const void *dictData,
+                                           int32_t length,
+                                           UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    umtx_initOnce(gLanguageBreakFactoriesInitOnce, &initLanguageFactories);
+    if (gUserLanguageBreakFactory == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    return gUserLanguageBreakFactory->addDictionary(chars, dictData, length, status);
+}
+
+UBool U_EXPORT2
+RuleBasedBreakIterator::unregisterDictionary(URegistryKey key, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    umtx_initOnce(gLanguageBreakFactoriesInitOnce, &initLanguageFactories);
+    if (gUserLanguageBreakFactory == nullptr) {
+        return FALSE;
+    }
+    return gUserLanguageBreakFactory->removeDictionary(key, status);
+}
+
+
 //-------------------------------------------------------------------------------
 //
 //  getLanguageBreakEngine  Find an appropriate LanguageBreakEngine for the
@@ -1191,7 +1246,7 @@ RuleBasedBreakIterator::getLanguageBreakEngine(UChar32 c) {
     UErrorCode status = U_ZERO_ERROR;
 
     if (fLanguageBreakEngines == NULL) {
-        fLanguageBreakEngines = new UStack(status);
+        fLanguageBreakEngines = new UStack(_releaseEngine, NULL, status);
         if (fLanguageBreakEngines == NULL || U_FAILURE(status)) {
             delete fLanguageBreakEngines;
             fLanguageBreakEngines = 0;
@@ -1215,7 +1270,8 @@ RuleBasedBreakIterator::getLanguageBreakEngine(UChar32 c) {
     if (lbe != NULL) {
         fLanguageBreakEngines->push((void *)lbe, status);
         // Even if we can't remember it, we can keep looking it up, so
-        // return it even if the push fails.
+        // return it even if the push fails. The reference that the stack
+        // would have released is then never given back.
         return lbe;
     }
 
@@ -40,6 +40,7 @@ struct RBBIDataHeader;
 class  RBBIDataWrapper;
 class  UnhandledEngine;
 class  UStack;
+class  UnicodeSet;
 
 /**
  *
@@ -589,6 +590,55 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     virtual const uint8_t *getBinaryRules(uint32_t &length);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Register an application-supplied word dictionary for a set of characters.
+     * Within runs of characters that the break rules hand to dictionary-based
+     * segmentation (for example Thai, Khmer or Han text in word and line break
+     * iterators), characters in the set are divided into the longest matching
+     * words of the dictionary. Characters that do not begin any word are kept
+     * together up to the next word.
+     *
+     * A registered dictionary takes precedence over ICU's own dictionaries and
+     * over dictionaries registered earlier for the same characters. Break iterators
+     * look up and remember a dictionary the first time they encounter a character,
+     * so dictionaries should be registered before break iterators are created.
+     *
+     * The dictionary must be in the binary format produced by the gendict tool,
+     * including its ICU data header, for the same platform type (endianness and
+     * charset family). The data is used in place, for example directly from a
+     * memory-mapped file, and must remain valid and unmodified until the
+     * dictionary is unregistered and all break iterators that used it have been
+     * deleted, or until u_cleanup() is called.
+     *
+     * @param chars      The set of characters to segment with the dictionary.
+     * @param dictData   The dictionary data, aligned on a 4-byte boundary.
+     * @param length     The length of the dictionary data in bytes.
+     * @param status     Set to U_ILLEGAL_ARGUMENT_ERROR if the set is empty or the data
+     *                   is missing or misaligned, or U_INVALID_FORMAT_ERROR if the data
+     *                   is not a usable dictionary.
+     * @return a registry key that can be used to unregister the dictionary
+     * @draft ICU 68
+     */
+    static URegistryKey U_EXPORT2 registerDictionary(const UnicodeSet &chars,
+                                                     const void *dictData,
+                                                     int32_t length,
+                                                     UErrorCode &status);
+
+    /**
+     * Unregister a dictionary using the key returned by registerDictionary().
+     * Break iterators created afterwards no longer use the dictionary. Break
+     * iterators that have already used it may continue to do so until they
+     * are deleted. The key becomes invalid after a successful call.
+     *
+     * @param key    the registry key returned by registerDictionary()
+     * @param status the in/out status code, no special meanings are assigned
+     * @return TRUE if the dictionary for the key was unregistered
+     * @draft ICU 68
+     */
+    static UBool U_EXPORT2 unregisterDictionary(URegistryKey key, UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      *  Set the subject text string upon which the break iterator is operating
      *  without changing any other aspect of the matching state.
@@ -813,6 +813,8 @@
 #define ucsdet_open U_ICU_ENTRY_POINT_RENAME(ucsdet_open)
 #define ucsdet_setDeclaredEncoding U_ICU_ENTRY_POINT_RENAME(ucsdet_setDeclaredEncoding)
 #define ucsdet_setDetectableCharset U_ICU_ENTRY_POINT_RENAME(ucsdet_setDetectableCharset)
+#define ucsdet_setInputLimit U_ICU_ENTRY_POINT_RENAME(ucsdet_setInputLimit)
+#define ucsdet_setStopConfidence U_ICU_ENTRY_POINT_RENAME(ucsdet_setStopConfidence)
 #define ucsdet_setText U_ICU_ENTRY_POINT_RENAME(ucsdet_setText)
 #define ucurr_countCurrencies U_ICU_ENTRY_POINT_RENAME(ucurr_countCurrencies)
 #define ucurr_forLocale U_ICU_ENTRY_POINT_RENAME(ucurr_forLocale)
@@ -1226,7 +1228,9 @@
 #define unum_parseDecimal U_ICU_ENTRY_POINT_RENAME(unum_parseDecimal)
 #define unum_parseDouble U_ICU_ENTRY_POINT_RENAME(unum_parseDouble)
 #define unum_parseDoubleCurrency U_ICU_ENTRY_POINT_RENAME(unum_parseDoubleCurrency)
+#define unum_parseDoubleUTF8 U_ICU_ENTRY_POINT_RENAME(unum_parseDoubleUTF8)
 #define unum_parseInt64 U_ICU_ENTRY_POINT_RENAME(unum_parseInt64)
+#define unum_parseInt64UTF8 U_ICU_ENTRY_POINT_RENAME(unum_parseInt64UTF8)
 #define unum_parseToUFormattable U_ICU_ENTRY_POINT_RENAME(unum_parseToUFormattable)
 #define unum_setAttribute U_ICU_ENTRY_POINT_RENAME(unum_setAttribute)
 #define unum_setContext U_ICU_ENTRY_POINT_RENAME(unum_setContext)
@@ -1238,7 +1242,9 @@
 #define unumf_closeResult U_ICU_ENTRY_POINT_RENAME(unumf_closeResult)
 #define unumf_formatDecimal U_ICU_ENTRY_POINT_RENAME(unumf_formatDecimal)
 #define unumf_formatDouble U_ICU_ENTRY_POINT_RENAME(unumf_formatDouble)
+#define unumf_formatDoubleToUTF8 U_ICU_ENTRY_POINT_RENAME(unumf_formatDoubleToUTF8)
 #define unumf_formatInt U_ICU_ENTRY_POINT_RENAME(unumf_formatInt)
+#define unumf_formatIntToUTF8 U_ICU_ENTRY_POINT_RENAME(unumf_formatIntToUTF8)
 #define unumf_openForSkeletonAndLocale U_ICU_ENTRY_POINT_RENAME(unumf_openForSkeletonAndLocale)
 #define unumf_openForSkeletonAndLocaleWithError U_ICU_ENTRY_POINT_RENAME(unumf_openForSkeletonAndLocaleWithError)
 #define unumf_openResult U_ICU_ENTRY_POINT_RENAME(unumf_openResult)
@@ -1511,6 +1517,7 @@
 #define uregex_setStackLimit U_ICU_ENTRY_POINT_RENAME(uregex_setStackLimit)
 #define uregex_setText U_ICU_ENTRY_POINT_RENAME(uregex_setText)
 #define uregex_setTimeLimit U_ICU_ENTRY_POINT_RENAME(uregex_setTimeLimit)
+#define uregex_setUTF8 U_ICU_ENTRY_POINT_RENAME(uregex_setUTF8)
 #define uregex_setUText U_ICU_ENTRY_POINT_RENAME(uregex_setUText)
 #define uregex_split U_ICU_ENTRY_POINT_RENAME(uregex_split)
 #define uregex_splitUText U_ICU_ENTRY_POINT_RENAME(uregex_splitUText)
@@ -1694,6 +1701,8 @@
 #define uset_spanBackUTF8 U_ICU_ENTRY_POINT_RENAME(uset_spanBackUTF8)
 #define uset_spanUTF8 U_ICU_ENTRY_POINT_RENAME(uset_spanUTF8)
 #define uset_toPattern U_ICU_ENTRY_POINT_RENAME(uset_toPattern)
+#define uspoof_addToIndex U_ICU_ENTRY_POINT_RENAME(uspoof_addToIndex)
+#define uspoof_addToIndexUTF8 U_ICU_ENTRY_POINT_RENAME(uspoof_addToIndexUTF8)
 #define uspoof_areConfusable U_ICU_ENTRY_POINT_RENAME(uspoof_areConfusable)
 #define uspoof_areConfusableUTF8 U_ICU_ENTRY_POINT_RENAME(uspoof_areConfusableUTF8)
 #define uspoof_areConfusableUnicodeString U_ICU_ENTRY_POINT_RENAME(uspoof_areConfusableUnicodeString)
@@ -1706,6 +1715,7 @@
 #define uspoof_clone U_ICU_ENTRY_POINT_RENAME(uspoof_clone)
 #define uspoof_close U_ICU_ENTRY_POINT_RENAME(uspoof_close)
 #define uspoof_closeCheckResult U_ICU_ENTRY_POINT_RENAME(uspoof_closeCheckResult)
+#define uspoof_closeIndex U_ICU_ENTRY_POINT_RENAME(uspoof_closeIndex)
 #define uspoof_getAllowedChars U_ICU_ENTRY_POINT_RENAME(uspoof_getAllowedChars)
 #define uspoof_getAllowedLocales U_ICU_ENTRY_POINT_RENAME(uspoof_getAllowedLocales)
 #define uspoof_getAllowedUnicodeSet U_ICU_ENTRY_POINT_RENAME(uspoof_getAllowedUnicodeSet)
@@ -1715,18 +1725,25 @@
 #define uspoof_getChecks U_ICU_ENTRY_POINT_RENAME(uspoof_getChecks)
 #define uspoof_getInclusionSet U_ICU_ENTRY_POINT_RENAME(uspoof_getInclusionSet)
 #define uspoof_getInclusionUnicodeSet U_ICU_ENTRY_POINT_RENAME(uspoof_getInclusionUnicodeSet)
+#define uspoof_getIndexSize U_ICU_ENTRY_POINT_RENAME(uspoof_getIndexSize)
 #define uspoof_getRecommendedSet U_ICU_ENTRY_POINT_RENAME(uspoof_getRecommendedSet)
 #define uspoof_getRecommendedUnicodeSet U_ICU_ENTRY_POINT_RENAME(uspoof_getRecommendedUnicodeSet)
 #define uspoof_getRestrictionLevel U_ICU_ENTRY_POINT_RENAME(uspoof_getRestrictionLevel)
 #define uspoof_getSkeleton U_ICU_ENTRY_POINT_RENAME(uspoof_getSkeleton)
 #define uspoof_getSkeletonUTF8 U_ICU_ENTRY_POINT_RENAME(uspoof_getSkeletonUTF8)
 #define uspoof_getSkeletonUnicodeString U_ICU_ENTRY_POINT_RENAME(uspoof_getSkeletonUnicodeString)
+#define uspoof_getSkeletonsUTF8 U_ICU_ENTRY_POINT_RENAME(uspoof_getSkeletonsUTF8)
 #define uspoof_internalInitStatics U_ICU_ENTRY_POINT_RENAME(uspoof_internalInitStatics)
+#define uspoof_isConfusableWithIndex U_ICU_ENTRY_POINT_RENAME(uspoof_isConfusableWithIndex)
+#define uspoof_isConfusableWithIndexUTF8 U_ICU_ENTRY_POINT_RENAME(uspoof_isConfusableWithIndexUTF8)
 #define uspoof_open U_ICU_ENTRY_POINT_RENAME(uspoof_open)
 #define uspoof_openCheckResult U_ICU_ENTRY_POINT_RENAME(uspoof_openCheckResult)
 #define uspoof_openFromSerialized U_ICU_ENTRY_POINT_RENAME(uspoof_openFromSerialized)
 #define uspoof_openFromSource U_ICU_ENTRY_POINT_RENAME(uspoof_openFromSource)
+#define uspoof_openIndex U_ICU_ENTRY_POINT_RENAME(uspoof_openIndex)
+#define uspoof_openIndexFromSerialized U_ICU_ENTRY_POINT_RENAME(uspoof_openIndexFromSerialized)
 #define uspoof_serialize U_ICU_ENTRY_POINT_RENAME(uspoof_serialize)
+#define uspoof_serializeIndex U_ICU_ENTRY_POINT_RENAME(uspoof_serializeIndex)
 #define uspoof_setAllowedChars U_ICU_ENTRY_POINT_RENAME(uspoof_setAllowedChars)
 #define uspoof_setAllowedLocales U_ICU_ENTRY_POINT_RENAME(uspoof_setAllowedLocales)
 #define uspoof_setAllowedUnicodeSet U_ICU_ENTRY_POINT_RENAME(uspoof_setAllowedUnicodeSet)
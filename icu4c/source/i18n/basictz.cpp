@@ -15,6 +15,7 @@
 #include "gregoimp.h"
 #include "uvector.h"
 #include "cmemory.h"
+#include "putilimp.h"
 
 U_NAMESPACE_BEGIN
 
@@ -555,6 +556,113 @@ BasicTimeZone::getOffsetFromLocal(UDate /*date*/, int32_t /*nonExistingTimeOpt*/
     status = U_UNSUPPORTED_ERROR;
 }
 
+static int32_t totalOffset(const TimeZoneRule *rule) {
+    return rule->getRawOffset() + rule->getDSTSavings();
+}
+
+static UBool hasOffsets(const TimeZoneRule *rule, int32_t raw, int32_t dst) {
+    return rule->getRawOffset() == raw && rule->getDSTSavings() == dst;
+}
+
+void
+BasicTimeZone::getOffsets(const UDate* dates, int32_t count,
+                          int32_t* rawOffsets, int32_t* dstOffsets, UErrorCode& status) const {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (count < 0 || (count > 0 && (dates == NULL || rawOffsets == NULL || dstOffsets == NULL))) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    // The offsets are the same for all times in [start, limit),
+    // which is empty until the first lookup.
+    UDate start = 0, limit = 0;
+    int32_t raw = 0, dst = 0;
+    TimeZoneTransition tzt;
+    for (int32_t i = 0; i < count; i++) {
+        UDate date = dates[i];
+        if (!(date >= start && date < limit)) {
+            getOffset(date, FALSE, raw, dst, status);
+            if (U_FAILURE(status)) {
+                return;
+            }
+            UBool found = FALSE;
+            if (uprv_isNaN(date) || uprv_isInfinite(date)) {
+                start = limit = 0;
+                found = TRUE;
+            } else if (start < limit && date >= limit) {
+                // Sorted input mostly moves on to the next interval.
+                UBool hasNext = getNextTransition(limit, FALSE, tzt);
+                if (!hasNext || date < tzt.getTime()) {
+                    start = limit;
+                    limit = hasNext ? tzt.getTime() : uprv_getInfinity();
+                    found = TRUE;
+                }
+            }
+            if (!found) {
+                start = getPreviousTransition(date, TRUE, tzt) ? tzt.getTime() : -uprv_getInfinity();
+                limit = getNextTransition(date, FALSE, tzt) ? tzt.getTime() : uprv_getInfinity();
+            }
+        }
+        rawOffsets[i] = raw;
+        dstOffsets[i] = dst;
+    }
+}
+
+void
+BasicTimeZone::getOffsetsFromLocal(const UDate* dates, int32_t count,
+                                   UTimeZoneLocalOption nonExistingTimeOpt,
+                                   UTimeZoneLocalOption duplicatedTimeOpt,
+                                   int32_t* rawOffsets, int32_t* dstOffsets, UErrorCode& status) const {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (count < 0 || (count > 0 && (dates == NULL || rawOffsets == NULL || dstOffsets == NULL))) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    // The offsets are the same for all local times in [start, limit).
+    // The range stays clear of the local times skipped or repeated by the
+    // transitions on either side, so that the options do not matter there.
+    UDate start = 0, limit = 0;
+    int32_t raw = 0, dst = 0;
+    TimeZoneTransition tzt;
+    for (int32_t i = 0; i < count; i++) {
+        UDate date = dates[i];
+        if (!(date >= start && date < limit)) {
+            getOffsetFromLocal(date, nonExistingTimeOpt, duplicatedTimeOpt, raw, dst, status);
+            if (U_FAILURE(status)) {
+                return;
+            }
+            start = limit = 0;
+            if (!uprv_isNaN(date) && !uprv_isInfinite(date)) {
+                // A time skipped by a transition can resolve to offsets that
+                // are not in effect at the resulting UTC time, so the range
+                // is only used when the offsets match the transitions.
+                int32_t offset = raw + dst;
+                UDate utc = date - offset;
+                UDate localStart = -uprv_getInfinity();
+                UDate localLimit = uprv_getInfinity();
+                UBool matches = TRUE;
+                if (getPreviousTransition(utc, TRUE, tzt)) {
+                    localStart = tzt.getTime() + uprv_max(totalOffset(tzt.getFrom()), offset);
+                    matches = hasOffsets(tzt.getTo(), raw, dst);
+                }
+                if (matches && getNextTransition(utc, FALSE, tzt)) {
+                    localLimit = tzt.getTime() + uprv_min(totalOffset(tzt.getTo()), offset);
+                    matches = hasOffsets(tzt.getFrom(), raw, dst);
+                }
+                if (matches && date >= localStart && date < localLimit) {
+                    start = localStart;
+                    limit = localLimit;
+                }
+            }
+        }
+        rawOffsets[i] = raw;
+        dstOffsets[i] = dst;
+    }
+}
+
 U_NAMESPACE_END
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
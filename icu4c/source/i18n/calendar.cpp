@@ -717,7 +717,11 @@ fTime(0),
 fLenient(TRUE),
 fZone(NULL),
 fRepeatedWallTime(UCAL_WALLTIME_LAST),
-fSkippedWallTime(UCAL_WALLTIME_LAST)
+fSkippedWallTime(UCAL_WALLTIME_LAST),
+fOffsetCacheStart(0),
+fOffsetCacheLimit(0),
+fOffsetCacheMissTime(uprv_getNaN()),
+fFieldsCacheValid(FALSE)
 {
     validLocale[0] = 0;
     actualLocale[0] = 0;
@@ -745,7 +749,11 @@ fTime(0),
 fLenient(TRUE),
 fZone(NULL),
 fRepeatedWallTime(UCAL_WALLTIME_LAST),
-fSkippedWallTime(UCAL_WALLTIME_LAST)
+fSkippedWallTime(UCAL_WALLTIME_LAST),
+fOffsetCacheStart(0),
+fOffsetCacheLimit(0),
+fOffsetCacheMissTime(uprv_getNaN()),
+fFieldsCacheValid(FALSE)
 {
     validLocale[0] = 0;
     actualLocale[0] = 0;
@@ -780,7 +788,11 @@ fTime(0),
 fLenient(TRUE),
 fZone(NULL),
 fRepeatedWallTime(UCAL_WALLTIME_LAST),
-fSkippedWallTime(UCAL_WALLTIME_LAST)
+fSkippedWallTime(UCAL_WALLTIME_LAST),
+fOffsetCacheStart(0),
+fOffsetCacheLimit(0),
+fOffsetCacheMissTime(uprv_getNaN()),
+fFieldsCacheValid(FALSE)
 {
     validLocale[0] = 0;
     actualLocale[0] = 0;
@@ -840,6 +852,22 @@ Calendar::operator=(const Calendar &right)
         fWeekendCease            = right.fWeekendCease;
         fWeekendCeaseMillis      = right.fWeekendCeaseMillis;
         fNextStamp               = right.fNextStamp;
+        fOffsetCacheStart        = right.fOffsetCacheStart;
+        fOffsetCacheLimit        = right.fOffsetCacheLimit;
+        fOffsetCacheRawOffset    = right.fOffsetCacheRawOffset;
+        fOffsetCacheDstOffset    = right.fOffsetCacheDstOffset;
+        fOffsetCacheMissTime     = right.fOffsetCacheMissTime;
+        fFieldsCacheValid        = right.fFieldsCacheValid;
+        if (fFieldsCacheValid) {
+            fFieldsCacheJulianDay = right.fFieldsCacheJulianDay;
+            uprv_arrayCopy(right.fFieldsCacheFields, fFieldsCacheFields, UCAL_FIELD_COUNT);
+            uprv_arrayCopy(right.fFieldsCacheStamp, fFieldsCacheStamp, UCAL_FIELD_COUNT);
+            uprv_arrayCopy(right.fFieldsCacheIsSet, fFieldsCacheIsSet, UCAL_FIELD_COUNT);
+            fFieldsCacheGregorianYear       = right.fFieldsCacheGregorianYear;
+            fFieldsCacheGregorianMonth      = right.fFieldsCacheGregorianMonth;
+            fFieldsCacheGregorianDayOfYear  = right.fFieldsCacheGregorianDayOfYear;
+            fFieldsCacheGregorianDayOfMonth = right.fFieldsCacheGregorianDayOfMonth;
+        }
         uprv_strncpy(validLocale, right.validLocale, sizeof(validLocale));
         uprv_strncpy(actualLocale, right.actualLocale, sizeof(actualLocale));
         validLocale[sizeof(validLocale)-1] = 0;
@@ -1505,9 +1533,77 @@ void Calendar::computeFields(UErrorCode &ec)
     // Compute local wall millis
     double localMillis = internalGetTime();
     int32_t rawOffset, dstOffset;
-    getTimeZone().getOffset(localMillis, FALSE, rawOffset, dstOffset, ec);
+    if (fOffsetCacheStart <= localMillis && localMillis < fOffsetCacheLimit) {
+        // Same zone transition interval as a recent call.
+        rawOffset = fOffsetCacheRawOffset;
+        dstOffset = fOffsetCacheDstOffset;
+    } else {
+        getTimeZone().getOffset(localMillis, FALSE, rawOffset, dstOffset, ec);
+        if (U_SUCCESS(ec)) {
+            cacheOffsets(localMillis, rawOffset, dstOffset);
+        }
+    }
     localMillis += (rawOffset + dstOffset);
 
+    // We used to check for and correct extreme millis values (near
+    // Long.MIN_VALUE or Long.MAX_VALUE) here.  Such values would cause
+    // overflows from positive to negative (or vice versa) and had to
+    // be manually tweaked.  We no longer need to do this because we
+    // have limited the range of supported dates to those that have a
+    // Julian day that fits into an int.  This allows us to implement a
+    // JULIAN_DAY field and also removes some inelegant code. - Liu
+    // 11/6/00
+
+    int32_t days =  (int32_t)ClockMath::floorDivide(localMillis, (double)kOneDay);
+    int32_t julianDay = days + kEpochStartAsJulianDay;
+
+    if (fFieldsCacheValid && fFieldsCacheJulianDay == julianDay) {
+        // Same local day as the last full computation: The date fields
+        // do not depend on the time of day.
+        uprv_arrayCopy(fFieldsCacheFields, fFields, UCAL_FIELD_COUNT);
+        uprv_arrayCopy(fFieldsCacheStamp, fStamp, UCAL_FIELD_COUNT);
+        uprv_arrayCopy(fFieldsCacheIsSet, fIsSet, UCAL_FIELD_COUNT);
+        fGregorianYear = fFieldsCacheGregorianYear;
+        fGregorianMonth = fFieldsCacheGregorianMonth;
+        fGregorianDayOfYear = fFieldsCacheGregorianDayOfYear;
+        fGregorianDayOfMonth = fFieldsCacheGregorianDayOfMonth;
+    } else {
+        fFieldsCacheValid = FALSE;
+        fFieldsCacheAllowed = TRUE;
+        computeDateFields(julianDay, ec);
+        fFieldsCacheValid = fFieldsCacheAllowed && U_SUCCESS(ec);
+        if (fFieldsCacheValid) {
+            fFieldsCacheJulianDay = julianDay;
+            uprv_arrayCopy(fFields, fFieldsCacheFields, UCAL_FIELD_COUNT);
+            uprv_arrayCopy(fStamp, fFieldsCacheStamp, UCAL_FIELD_COUNT);
+            uprv_arrayCopy(fIsSet, fFieldsCacheIsSet, UCAL_FIELD_COUNT);
+            fFieldsCacheGregorianYear = fGregorianYear;
+            fFieldsCacheGregorianMonth = fGregorianMonth;
+            fFieldsCacheGregorianDayOfYear = fGregorianDayOfYear;
+            fFieldsCacheGregorianDayOfMonth = fGregorianDayOfMonth;
+        }
+    }
+
+    // Compute time-related fields.  These are indepent of the date and
+    // of the subclass algorithm.  They depend only on the local zone
+    // wall milliseconds in day.
+    int32_t millisInDay =  (int32_t) (localMillis - (days * kOneDay));
+    fFields[UCAL_MILLISECONDS_IN_DAY] = millisInDay;
+    fFields[UCAL_MILLISECOND] = millisInDay % 1000;
+    millisInDay /= 1000;
+    fFields[UCAL_SECOND] = millisInDay % 60;
+    millisInDay /= 60;
+    fFields[UCAL_MINUTE] = millisInDay % 60;
+    millisInDay /= 60;
+    fFields[UCAL_HOUR_OF_DAY] = millisInDay;
+    fFields[UCAL_AM_PM] = millisInDay / 12; // Assume AM == 0
+    fFields[UCAL_HOUR] = millisInDay % 12;
+    fFields[UCAL_ZONE_OFFSET] = rawOffset;
+    fFields[UCAL_DST_OFFSET] = dstOffset;
+}
+
+void Calendar::computeDateFields(int32_t julianDay, UErrorCode &ec)
+{
     // Mark fields as set.  Do this before calling handleComputeFields().
     uint32_t mask =   //fInternalSetMask;
         (1 << UCAL_ERA) |
@@ -1528,23 +1624,7 @@ void Calendar::computeFields(UErrorCode &ec)
         mask >>= 1;
     }
 
-    // We used to check for and correct extreme millis values (near
-    // Long.MIN_VALUE or Long.MAX_VALUE) here.  Such values would cause
-    // overflows from positive to negative (or vice versa) and had to
-    // be manually tweaked.  We no longer need to do this because we
-    // have limited the range of supported dates to those that have a
-    // Julian day that fits into an int.  This allows us to implement a
-    // JULIAN_DAY field and also removes some inelegant code. - Liu
-    // 11/6/00
-
-    int32_t days =  (int32_t)ClockMath::floorDivide(localMillis, (double)kOneDay);
-
-    internalSet(UCAL_JULIAN_DAY,days + kEpochStartAsJulianDay);
-
-#if defined (U_DEBUG_CAL)
-    //fprintf(stderr, "%s:%d- Hmm! Jules @ %d, as per %.0lf millis\n",
-    //__FILE__, __LINE__, fFields[UCAL_JULIAN_DAY], localMillis);
-#endif
+    internalSet(UCAL_JULIAN_DAY, julianDay);
 
     computeGregorianAndDOWFields(fFields[UCAL_JULIAN_DAY], ec);
 
@@ -1557,23 +1637,41 @@ void Calendar::computeFields(UErrorCode &ec)
     // Compute week-related fields, based on the subclass-computed
     // fields computed by handleComputeFields().
     computeWeekFields(ec);
+}
 
-    // Compute time-related fields.  These are indepent of the date and
-    // of the subclass algorithm.  They depend only on the local zone
-    // wall milliseconds in day.
-    int32_t millisInDay =  (int32_t) (localMillis - (days * kOneDay));
-    fFields[UCAL_MILLISECONDS_IN_DAY] = millisInDay;
-    fFields[UCAL_MILLISECOND] = millisInDay % 1000;
-    millisInDay /= 1000;
-    fFields[UCAL_SECOND] = millisInDay % 60;
-    millisInDay /= 60;
-    fFields[UCAL_MINUTE] = millisInDay % 60;
-    millisInDay /= 60;
-    fFields[UCAL_HOUR_OF_DAY] = millisInDay;
-    fFields[UCAL_AM_PM] = millisInDay / 12; // Assume AM == 0
-    fFields[UCAL_HOUR] = millisInDay % 12;
-    fFields[UCAL_ZONE_OFFSET] = rawOffset;
-    fFields[UCAL_DST_OFFSET] = dstOffset;
+void Calendar::cacheOffsets(UDate time, int32_t rawOffset, int32_t dstOffset)
+{
+    fOffsetCacheStart = fOffsetCacheLimit = 0;
+    UDate lastMissTime = fOffsetCacheMissTime;
+    fOffsetCacheMissTime = time;
+    if (!(uprv_fabs(time - lastMissTime) < kOneDay)) {
+        return;
+    }
+    BasicTimeZone *btz = getBasicTimeZone();
+    if (btz == NULL) {
+        return;
+    }
+    TimeZoneTransition transition;
+    UDate start = -uprv_getInfinity();
+    UDate limit = uprv_getInfinity();
+    if (btz->getPreviousTransition(time, TRUE, transition)) {
+        start = transition.getTime();
+    }
+    if (btz->getNextTransition(time, FALSE, transition)) {
+        limit = transition.getTime();
+    }
+    fOffsetCacheStart = start;
+    fOffsetCacheLimit = limit;
+    fOffsetCacheRawOffset = rawOffset;
+    fOffsetCacheDstOffset = dstOffset;
+}
+
+void Calendar::invalidateFieldsCache()
+{
+    fOffsetCacheStart = fOffsetCacheLimit = 0;
+    fOffsetCacheMissTime = uprv_getNaN();
+    fFieldsCacheValid = FALSE;
+    fFieldsCacheAllowed = FALSE;
 }
 
 uint8_t Calendar::julianDayToDayOfWeek(double julian)
@@ -2401,6 +2499,7 @@ Calendar::adoptTimeZone(TimeZone* zone)
 
     // if the zone changes, we need to recompute the time fields
     fAreFieldsSet = FALSE;
+    invalidateFieldsCache();
 }
 
 // -------------------------------------
@@ -2432,6 +2531,7 @@ Calendar::orphanTimeZone()
     }
     TimeZone *z = fZone;
     fZone = defaultZone;
+    invalidateFieldsCache();
     return z;
 }
 
@@ -2494,6 +2594,7 @@ Calendar::setFirstDayOfWeek(UCalendarDaysOfWeek value)
         value >= UCAL_SUNDAY && value <= UCAL_SATURDAY) {
             fFirstDayOfWeek = value;
             fAreFieldsSet = FALSE;
+            invalidateFieldsCache();
         }
 }
 
@@ -2526,6 +2627,7 @@ Calendar::setMinimalDaysInFirstWeek(uint8_t value)
     if (fMinimalDaysInFirstWeek != value) {
         fMinimalDaysInFirstWeek = value;
         fAreFieldsSet = FALSE;
+        invalidateFieldsCache();
     }
 }
 
@@ -3786,6 +3888,7 @@ Calendar::setWeekData(const Locale& desiredLocale, const char *type, UErrorCode&
 
     fFirstDayOfWeek = UCAL_SUNDAY;
     fMinimalDaysInFirstWeek = 1;
+    invalidateFieldsCache();
     fWeekendOnset = UCAL_SATURDAY;
     fWeekendOnsetMillis = 0;
     fWeekendCease = UCAL_SUNDAY;
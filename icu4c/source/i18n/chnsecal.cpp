@@ -353,6 +353,9 @@ int32_t ChineseCalendar::handleComputeMonthStart(int32_t eyear, int32_t month, U
     // This will modify the MONTH and IS_LEAP_MONTH fields (only)
     nonConstThis->computeChineseFields(newMoon, getGregorianYear(),
                          getGregorianMonth(), FALSE);        
+    // It also sets isLeapYear, which the cached fields of computeFields()
+    // would not restore.
+    nonConstThis->invalidateFieldsCache();
 
     if (month != internalGet(UCAL_MONTH) ||
         isLeapMonth != internalGet(UCAL_IS_LEAP_MONTH)) {
@@ -148,14 +148,19 @@ void CharsetDetector::setRecognizers(UErrorCode &status)
 }
 
 CharsetDetector::CharsetDetector(UErrorCode &status)
-  : textIn(new InputText(status)), resultArray(NULL),
+  : textIn(new InputText(status)), fMatches(NULL), resultArray(NULL),
     resultCount(0), fStripTags(FALSE), fFreshTextSet(FALSE),
-    fEnabledRecognizers(NULL)
+    fPartialResults(FALSE), fStopConfidence(100), fEnabledRecognizers(NULL)
 {
     if (U_FAILURE(status)) {
         return;
     }
 
+    if (textIn == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+
     setRecognizers(status);
 
     if (U_FAILURE(status)) {
@@ -169,24 +174,24 @@ CharsetDetector::CharsetDetector(UErrorCode &status)
         return;
     }
 
-    for(int32_t i = 0; i < fCSRecognizers_size; i += 1) {
-        resultArray[i] = new CharsetMatch();
+    // All of the matches live in one block, so that opening a detector
+    //   takes a fixed, small number of allocations.
+    fMatches = new CharsetMatch[fCSRecognizers_size];
 
-        if (resultArray[i] == NULL) {
-            status = U_MEMORY_ALLOCATION_ERROR;
-            break;
-        }
+    if (fMatches == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+
+    for(int32_t i = 0; i < fCSRecognizers_size; i += 1) {
+        resultArray[i] = &fMatches[i];
     }
 }
 
 CharsetDetector::~CharsetDetector()
 {
     delete textIn;
-
-    for(int32_t i = 0; i < fCSRecognizers_size; i += 1) {
-        delete resultArray[i];
-    }
-
+    delete[] fMatches;
     uprv_free(resultArray);
 
     if (fEnabledRecognizers) {
@@ -213,6 +218,36 @@ UBool CharsetDetector::getStripTagsFlag() const
     return fStripTags;
 }
 
+void CharsetDetector::setStopConfidence(int32_t confidence, UErrorCode &status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    if (confidence < 1 || confidence > 100) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    fStopConfidence = confidence;
+    fFreshTextSet = TRUE;
+}
+
+void CharsetDetector::setInputLimit(int32_t limit, UErrorCode &status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    if (limit < 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    textIn->setInputLimit(limit);
+    fFreshTextSet = TRUE;
+}
+
 void CharsetDetector::setDeclaredEncoding(const char *encoding, int32_t len) const
 {
     textIn->setDeclaredEncoding(encoding,len);
@@ -227,13 +262,54 @@ int32_t CharsetDetector::getDetectableCount()
     return fCSRecognizers_size; 
 }
 
+void CharsetDetector::runRecognizers(int32_t stopConfidence, UErrorCode &status)
+{
+    CharsetRecognizer *csr;
+    int32_t            i;
+
+    textIn->MungeInput(fStripTags);
+
+    // Iterate over all possible charsets, remember all that
+    // give a match quality > 0.
+    resultCount = 0;
+    fPartialResults = FALSE;
+    for (i = 0; i < fCSRecognizers_size; i += 1) {
+        csr = fCSRecognizers[i]->recognizer;
+        if (csr->match(textIn, resultArray[resultCount])) {
+            if (resultArray[resultCount]->getConfidence() >= stopConfidence) {
+                // Good enough; report this match alone and leave the
+                //   remaining recognizers for detectAll().
+                CharsetMatch *match = resultArray[resultCount];
+                resultArray[resultCount] = resultArray[0];
+                resultArray[0] = match;
+                resultCount = 1;
+                fPartialResults = TRUE;
+                break;
+            }
+            resultCount++;
+        }
+    }
+
+    if (resultCount > 1) {
+        uprv_sortArray(resultArray, resultCount, sizeof resultArray[0], charsetMatchComparator, NULL, TRUE, &status);
+    }
+    fFreshTextSet = FALSE;
+}
+
 const CharsetMatch *CharsetDetector::detect(UErrorCode &status)
 {
-    int32_t maxMatchesFound = 0;
+    if(!textIn->isSet()) {
+        status = U_MISSING_RESOURCE_ERROR;// TODO:  Need to set proper status code for input text not set
 
-    detectAll(maxMatchesFound, status);
+        return NULL;
+    } else if (fFreshTextSet) {
+        // The sort is stable, so the first recognizer to report the highest
+        //   possible confidence is the best match. Stopping there by default
+        //   gives the same answer as detectAll() without running the rest.
+        runRecognizers(fStopConfidence, status);
+    }
 
-    if(maxMatchesFound > 0) {
+    if(resultCount > 0) {
         return resultArray[0];
     } else {
         return NULL;
@@ -246,26 +322,8 @@ const CharsetMatch * const *CharsetDetector::detectAll(int32_t &maxMatchesFound,
         status = U_MISSING_RESOURCE_ERROR;// TODO:  Need to set proper status code for input text not set
 
         return NULL;
-    } else if (fFreshTextSet) {
-        CharsetRecognizer *csr;
-        int32_t            i;
-
-        textIn->MungeInput(fStripTags);
-
-        // Iterate over all possible charsets, remember all that
-        // give a match quality > 0.
-        resultCount = 0;
-        for (i = 0; i < fCSRecognizers_size; i += 1) {
-            csr = fCSRecognizers[i]->recognizer;
-            if (csr->match(textIn, resultArray[resultCount])) {
-                resultCount++;
-            }
-        }
-
-        if (resultCount > 1) {
-            uprv_sortArray(resultArray, resultCount, sizeof resultArray[0], charsetMatchComparator, NULL, TRUE, &status);
-        }
-        fFreshTextSet = FALSE;
+    } else if (fFreshTextSet || fPartialResults) {
+        runRecognizers(INT32_MAX, status);
     }
 
     maxMatchesFound = resultCount;
@@ -26,12 +26,17 @@ class CharsetDetector : public UMemory
 {
 private:
     InputText *textIn;
+    CharsetMatch *fMatches;     // Storage for the matches; resultArray points into it.
     CharsetMatch **resultArray;
     int32_t resultCount;
     UBool fStripTags;   // If true, setText() will strip tags from input text.
     UBool fFreshTextSet;
+    UBool fPartialResults;      // If true, resultArray holds only the match that stopped detect() early.
+    int32_t fStopConfidence;    // detect() stops at the first match with at least this confidence.
     static void setRecognizers(UErrorCode &status);
 
+    void runRecognizers(int32_t stopConfidence, UErrorCode &status);
+
     UBool *fEnabledRecognizers;  // If not null, active set of charset recognizers had
                                 // been changed from the default. The array index is
                                 // corresponding to fCSRecognizers. See setDetectableCharset().
@@ -53,6 +58,10 @@ class CharsetDetector : public UMemory
 
     UBool getStripTagsFlag() const;
 
+    void setStopConfidence(int32_t confidence, UErrorCode &status);
+
+    void setInputLimit(int32_t limit, UErrorCode &status);
+
 //    const char *getCharsetName(int32_t index, UErrorCode& status) const;
 
     static int32_t getDetectableCount();
@@ -147,7 +147,9 @@ const char *CharsetRecog_2022JP::getName() const {
 }
 
 UBool CharsetRecog_2022JP::match(InputText *textIn, CharsetMatch *results) const {
-    int32_t confidence = match_2022(textIn->fInputBytes, 
+    // No escape sequences can match without an ESC byte in the input.
+    int32_t confidence = textIn->fByteStats[0x1B] == 0 ? 0 :
+                         match_2022(textIn->fInputBytes,
                                     textIn->fInputLen, 
                                     escapeSequences_2022JP, 
                                     UPRV_LENGTHOF(escapeSequences_2022JP));
@@ -163,7 +165,9 @@ const char *CharsetRecog_2022KR::getName() const {
 }
 
 UBool CharsetRecog_2022KR::match(InputText *textIn, CharsetMatch *results) const {
-    int32_t confidence = match_2022(textIn->fInputBytes, 
+    // No escape sequences can match without an ESC byte in the input.
+    int32_t confidence = textIn->fByteStats[0x1B] == 0 ? 0 :
+                         match_2022(textIn->fInputBytes,
                                     textIn->fInputLen, 
                                     escapeSequences_2022KR, 
                                     UPRV_LENGTHOF(escapeSequences_2022KR));
@@ -178,7 +182,9 @@ const char *CharsetRecog_2022CN::getName() const {
 }
 
 UBool CharsetRecog_2022CN::match(InputText *textIn, CharsetMatch *results) const {
-    int32_t confidence = match_2022(textIn->fInputBytes,
+    // No escape sequences can match without an ESC byte in the input.
+    int32_t confidence = textIn->fByteStats[0x1B] == 0 ? 0 :
+                         match_2022(textIn->fInputBytes,
                                     textIn->fInputLen,
                                     escapeSequences_2022CN,
                                     UPRV_LENGTHOF(escapeSequences_2022CN));
@@ -154,6 +154,12 @@ int32_t CharsetRecog_mbcs::match_mbcs(InputText *det, const uint16_t commonChars
     int32_t confidence          = 0;
     IteratedChar iter;
 
+    // Every byte of the leading ASCII run is a valid single byte character
+    //   in all of the multi-byte encodings; skip over them.
+    iter.nextIndex      = det->fRawAsciiLength;
+    singleByteCharCount = det->fRawAsciiLength;
+    totalCharCount      = det->fRawAsciiLength;
+
     while (nextChar(&iter, det)) {
         totalCharCount++;
 
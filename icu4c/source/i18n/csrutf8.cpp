@@ -40,8 +40,8 @@ UBool CharsetRecog_UTF8::match(InputText* input, CharsetMatch *results) const {
             hasBOM = TRUE;
     }
 
-    // Scan for multi-byte sequences
-    for (i=0; i < input->fRawLength; i += 1) {
+    // Scan for multi-byte sequences, starting after the leading ASCII run.
+    for (i=input->fRawAsciiLength; i < input->fRawLength; i += 1) {
         int32_t b = inputBytes[i];
 
         if ((b & 0x80) == 0) {
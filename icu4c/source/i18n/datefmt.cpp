@@ -19,6 +19,8 @@
  ********************************************************************************
  */
 
+#include <atomic>
+
 #include "unicode/utypes.h"
 
 #if !UCONFIG_NO_FORMATTING
@@ -46,6 +48,21 @@
 
 U_NAMESPACE_BEGIN
 
+namespace {
+
+// DateFormat::fFormatCalendar is declared as a plain pointer, since <atomic> can not be
+// included by the public header. It is only ever accessed as an atomic pointer, in the
+// same way as LocalizedNumberFormatter::fUnsafeCallCount.
+typedef std::atomic<Calendar*> AtomicCalendarPtr;
+static_assert(sizeof(AtomicCalendarPtr) == sizeof(Calendar*),
+              "std::atomic<Calendar*> must have the size of a pointer");
+
+inline AtomicCalendarPtr& asAtomic(Calendar*& calendar) {
+    return *reinterpret_cast<AtomicCalendarPtr*>(&calendar);
+}
+
+}  // namespace
+
 class U_I18N_API DateFmtBestPattern : public SharedObject {
 public:
     UnicodeString fPattern;
@@ -125,7 +142,8 @@ DateFmtBestPatternKey::~DateFmtBestPatternKey() { }
 DateFormat::DateFormat()
 :   fCalendar(0),
     fNumberFormat(0),
-    fCapitalizationContext(UDISPCTX_CAPITALIZATION_NONE)
+    fCapitalizationContext(UDISPCTX_CAPITALIZATION_NONE),
+    fFormatCalendar(NULL)
 {
 }
 
@@ -135,7 +153,8 @@ DateFormat::DateFormat(const DateFormat& other)
 :   Format(other),
     fCalendar(0),
     fNumberFormat(0),
-    fCapitalizationContext(UDISPCTX_CAPITALIZATION_NONE)
+    fCapitalizationContext(UDISPCTX_CAPITALIZATION_NONE),
+    fFormatCalendar(NULL)
 {
     *this = other;
 }
@@ -148,6 +167,7 @@ DateFormat& DateFormat::operator=(const DateFormat& other)
     {
         delete fCalendar;
         delete fNumberFormat;
+        delete asAtomic(fFormatCalendar).exchange(NULL);
         if(other.fCalendar) {
           fCalendar = other.fCalendar->clone();
         } else {
@@ -170,6 +190,7 @@ DateFormat::~DateFormat()
 {
     delete fCalendar;
     delete fNumberFormat;
+    delete asAtomic(fFormatCalendar).exchange(NULL);
 }
 
 //----------------------------------------------------------------------
@@ -281,14 +302,14 @@ UnicodeString&
 DateFormat::format(UDate date, UnicodeString& appendTo, FieldPosition& fieldPosition) const {
     if (fCalendar != NULL) {
         // Use a clone of our calendar instance
-        Calendar* calClone = fCalendar->clone();
+        Calendar* calClone = takeFormatCalendar();
         if (calClone != NULL) {
             UErrorCode ec = U_ZERO_ERROR;
             calClone->setTime(date, ec);
             if (U_SUCCESS(ec)) {
                 format(*calClone, appendTo, fieldPosition);
             }
-            delete calClone;
+            returnFormatCalendar(calClone);
         }
     }
     return appendTo;
@@ -300,13 +321,13 @@ UnicodeString&
 DateFormat::format(UDate date, UnicodeString& appendTo, FieldPositionIterator* posIter,
                    UErrorCode& status) const {
     if (fCalendar != NULL) {
-        Calendar* calClone = fCalendar->clone();
+        Calendar* calClone = takeFormatCalendar();
         if (calClone != NULL) {
             calClone->setTime(date, status);
             if (U_SUCCESS(status)) {
                format(*calClone, appendTo, posIter, status);
             }
-            delete calClone;
+            returnFormatCalendar(calClone);
         }
     }
     return appendTo;
@@ -314,6 +335,37 @@ DateFormat::format(UDate date, UnicodeString& appendTo, FieldPositionIterator* p
 
 //----------------------------------------------------------------------
 
+Calendar*
+DateFormat::takeFormatCalendar() const
+{
+    // Concurrent calls on the same format do not wait for each other: the one that
+    // finds the slot empty makes its own clone.
+    Calendar* cal = asAtomic(fFormatCalendar).exchange(NULL, std::memory_order_acquire);
+    // fCalendar may have been changed since the clone was made.
+    if (cal != NULL && !(cal->isEquivalentTo(*fCalendar) &&
+                         uprv_strcmp(cal->getType(), fCalendar->getType()) == 0)) {
+        delete cal;
+        cal = NULL;
+    }
+    if (cal == NULL) {
+        cal = fCalendar->clone();
+    }
+    return cal;
+}
+
+void
+DateFormat::returnFormatCalendar(Calendar* calendar) const
+{
+    Calendar* expected = NULL;
+    if (!asAtomic(fFormatCalendar).compare_exchange_strong(expected, calendar,
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed)) {
+        delete calendar;
+    }
+}
+
+//----------------------------------------------------------------------
+
 UnicodeString&
 DateFormat::format(UDate date, UnicodeString& appendTo) const
 {
@@ -563,6 +615,7 @@ DateFormat::adoptCalendar(Calendar* newCalendar)
 {
     delete fCalendar;
     fCalendar = newCalendar;
+    delete asAtomic(fFormatCalendar).exchange(NULL);
 }
 
 //----------------------------------------------------------------------
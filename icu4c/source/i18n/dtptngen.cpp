@@ -38,6 +38,7 @@
 #include "hash.h"
 #include "uhash.h"
 #include "uresimp.h"
+#include "unifiedcache.h"
 #include "dtptngen_impl.h"
 #include "ucln_in.h"
 #include "charstr.h"
@@ -306,9 +307,15 @@ DateTimePatternGenerator::createInstance(const Locale& locale, UErrorCode& statu
     if (U_FAILURE(status)) {
         return nullptr;
     }
-    LocalPointer<DateTimePatternGenerator> result(
-            new DateTimePatternGenerator(locale, status), status);
-    return U_SUCCESS(status) ? result.orphan() : nullptr;
+    // Loading the locale data is expensive; copy the shared generator instead.
+    const SharedDateTimePatternGenerator *shared = nullptr;
+    UnifiedCache::getByLocale(locale, shared, status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    DateTimePatternGenerator *result = shared->createGenerator(status);
+    shared->removeRef();
+    return result;
 }
 
 DateTimePatternGenerator*  U_EXPORT2
@@ -325,7 +332,8 @@ DateTimePatternGenerator::DateTimePatternGenerator(UErrorCode &status) :
     skipMatcher(nullptr),
     fAvailableFormatKeyHash(nullptr),
     fDefaultHourFormatChar(0),
-    internalErrorCode(U_ZERO_ERROR)
+    internalErrorCode(U_ZERO_ERROR),
+    fSharedGenerator(nullptr)
 {
     fp = new FormatParser();
     dtMatcher = new DateTimeMatcher();
@@ -340,7 +348,8 @@ DateTimePatternGenerator::DateTimePatternGenerator(const Locale& locale, UErrorC
     skipMatcher(nullptr),
     fAvailableFormatKeyHash(nullptr),
     fDefaultHourFormatChar(0),
-    internalErrorCode(U_ZERO_ERROR)
+    internalErrorCode(U_ZERO_ERROR),
+    fSharedGenerator(nullptr)
 {
     fp = new FormatParser();
     dtMatcher = new DateTimeMatcher();
@@ -359,7 +368,8 @@ DateTimePatternGenerator::DateTimePatternGenerator(const DateTimePatternGenerato
     skipMatcher(nullptr),
     fAvailableFormatKeyHash(nullptr),
     fDefaultHourFormatChar(0),
-    internalErrorCode(U_ZERO_ERROR)
+    internalErrorCode(U_ZERO_ERROR),
+    fSharedGenerator(nullptr)
 {
     fp = new FormatParser();
     dtMatcher = new DateTimeMatcher();
@@ -380,6 +390,8 @@ DateTimePatternGenerator::operator=(const DateTimePatternGenerator& other) {
     internalErrorCode = other.internalErrorCode;
     pLocale = other.pLocale;
     fDefaultHourFormatChar = other.fDefaultHourFormatChar;
+    uprv_memcpy(fAllowedHourFormats, other.fAllowedHourFormats, sizeof(fAllowedHourFormats));
+    SharedObject::copyPtr(other.fSharedGenerator, fSharedGenerator);
     *fp = *(other.fp);
     dtMatcher->copyFrom(other.dtMatcher->skeleton);
     *distanceInfo = *(other.distanceInfo);
@@ -453,6 +465,85 @@ DateTimePatternGenerator::~DateTimePatternGenerator() {
     if (distanceInfo != nullptr) delete distanceInfo;
     if (patternMap != nullptr) delete patternMap;
     if (skipMatcher != nullptr) delete skipMatcher;
+    SharedObject::clearPtr(fSharedGenerator);
+}
+
+void
+DateTimePatternGenerator::releaseSharedGenerator() {
+    // Once modified, this generator no longer matches the shared one,
+    // so it must neither use nor add to the shared best patterns.
+    SharedObject::clearPtr(fSharedGenerator);
+}
+
+SharedDateTimePatternGenerator::SharedDateTimePatternGenerator(const Locale &locale, UErrorCode &status) :
+        fGenerator(new DateTimePatternGenerator(locale, status), status),
+        fBestPatterns(status) {
+    if (U_SUCCESS(status)) {
+        fBestPatterns.setValueDeleter(uprv_deleteUObject);
+    }
+}
+
+SharedDateTimePatternGenerator::~SharedDateTimePatternGenerator() {
+}
+
+DateTimePatternGenerator *
+SharedDateTimePatternGenerator::createGenerator(UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    LocalPointer<DateTimePatternGenerator> result(new DateTimePatternGenerator(*fGenerator), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    if (U_FAILURE(result->internalErrorCode)) {
+        status = result->internalErrorCode;
+        return nullptr;
+    }
+    SharedObject::copyPtr(this, result->fSharedGenerator);
+    return result.orphan();
+}
+
+UBool
+SharedDateTimePatternGenerator::getBestPattern(const UnicodeString &key, UnicodeString &pattern) const {
+    std::lock_guard<std::mutex> lock(fBestPatternsMutex);
+    const UnicodeString *value = static_cast<const UnicodeString *>(fBestPatterns.get(key));
+    if (value == nullptr) {
+        return FALSE;
+    }
+    pattern = *value;
+    return TRUE;
+}
+
+void
+SharedDateTimePatternGenerator::putBestPattern(const UnicodeString &key, const UnicodeString &pattern) const {
+    LocalPointer<UnicodeString> value(new UnicodeString(pattern));
+    if (value.isNull()) {
+        return;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    std::lock_guard<std::mutex> lock(fBestPatternsMutex);
+    if (fBestPatterns.count() < MAX_BEST_PATTERNS && fBestPatterns.get(key) == nullptr) {
+        fBestPatterns.put(key, value.orphan(), status);
+    }
+}
+
+UnicodeString &
+SharedDateTimePatternGenerator::makeKey(const UnicodeString &skeleton, UDateTimePatternMatchOptions options,
+                                        UnicodeString &key) {
+    key.setTo((char16_t)(options >> 16)).append((char16_t)options);
+    return key.append(skeleton);
+}
+
+template<>
+const SharedDateTimePatternGenerator *LocaleCacheKey<SharedDateTimePatternGenerator>::createObject(
+        const void * /*unusedCreationContext*/, UErrorCode &status) const {
+    LocalPointer<SharedDateTimePatternGenerator> shared(
+            new SharedDateTimePatternGenerator(fLoc, status), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    shared->addRef();
+    return shared.orphan();
 }
 
 namespace {
@@ -1098,6 +1189,7 @@ DateTimePatternGenerator::initHashtable(UErrorCode& err) {
 
 void
 DateTimePatternGenerator::setAppendItemFormat(UDateTimePatternField field, const UnicodeString& value) {
+    releaseSharedGenerator();
     appendItemFormats[field] = value;
     // NUL-terminate for the C API.
     appendItemFormats[field].getTerminatedBuffer();
@@ -1120,6 +1212,7 @@ DateTimePatternGenerator::getAppendItemName(UDateTimePatternField field) const {
 
 void
 DateTimePatternGenerator::setFieldDisplayName(UDateTimePatternField field, UDateTimePGDisplayWidth width, const UnicodeString& value) {
+    releaseSharedGenerator();
     fieldDisplayNames[field][width] = value;
     // NUL-terminate for the C API.
     fieldDisplayNames[field][width].getTerminatedBuffer();
@@ -1156,6 +1249,24 @@ DateTimePatternGenerator::getBestPattern(const UnicodeString& patternForm, UDate
         status = internalErrorCode;
         return UnicodeString();
     }
+    if (fSharedGenerator == nullptr) {
+        return findBestPattern(patternForm, options, status);
+    }
+    // Unmodified copies of a locale's generator all find the same patterns.
+    UnicodeString key;
+    UnicodeString resultPattern;
+    SharedDateTimePatternGenerator::makeKey(patternForm, options, key);
+    if (!fSharedGenerator->getBestPattern(key, resultPattern)) {
+        resultPattern = findBestPattern(patternForm, options, status);
+        if (U_SUCCESS(status)) {
+            fSharedGenerator->putBestPattern(key, resultPattern);
+        }
+    }
+    return resultPattern;
+}
+
+UnicodeString
+DateTimePatternGenerator::findBestPattern(const UnicodeString& patternForm, UDateTimePatternMatchOptions options, UErrorCode& status) {
     const UnicodeString *bestPattern = nullptr;
     UnicodeString dtFormat;
     UnicodeString resultPattern;
@@ -1313,6 +1424,7 @@ DateTimePatternGenerator::replaceFieldTypes(const UnicodeString& pattern,
 
 void
 DateTimePatternGenerator::setDecimal(const UnicodeString& newDecimal) {
+    releaseSharedGenerator();
     this->decimal = newDecimal;
     // NUL-terminate for the C API.
     this->decimal.getTerminatedBuffer();
@@ -1338,6 +1450,7 @@ DateTimePatternGenerator::addCanonicalItems(UErrorCode& status) {
 
 void
 DateTimePatternGenerator::setDateTimeFormat(const UnicodeString& dtFormat) {
+    releaseSharedGenerator();
     dateTimeFormat = dtFormat;
     // NUL-terminate for the C API.
     dateTimeFormat.getTerminatedBuffer();
@@ -1412,6 +1525,7 @@ DateTimePatternGenerator::addPattern(
         return UDATPG_NO_CONFLICT;
     }
 
+    releaseSharedGenerator();
     return addPatternWithSkeleton(pattern, nullptr, override, conflictingPattern, status);
 }
 
@@ -14,10 +14,14 @@
 #ifndef __DTPTNGEN_IMPL_H__
 #define __DTPTNGEN_IMPL_H__
 
+#include <mutex>
+
 #include "unicode/udatpg.h"
 
 #include "unicode/strenum.h"
 #include "unicode/unistr.h"
+#include "hash.h"
+#include "sharedobject.h"
 #include "uvector.h"
 
 // TODO(claireho): Split off Builder class.
@@ -32,6 +36,7 @@
 #define EXTRA_FIELD   0x10000
 #define MISSING_FIELD  0x1000
 #define MAX_STRING_ENUMERATION  200
+#define MAX_BEST_PATTERNS  1000
 #define SINGLE_QUOTE      ((UChar)0x0027)
 #define FORWARDSLASH      ((UChar)0x002F)
 #define BACKSLASH         ((UChar)0x005C)
@@ -305,6 +310,42 @@ class DTRedundantEnumeration : public StringEnumeration {
     LocalPointer<UVector> fPatterns;
 };
 
+/**
+ * The DateTimePatternGenerator for one locale, shared through the UnifiedCache,
+ * together with the best patterns that have been found for that locale.
+ * The generator itself is never modified; DateTimePatternGenerator::createInstance()
+ * hands out copies of it, which use the memo until they are modified.
+ */
+class SharedDateTimePatternGenerator : public SharedObject {
+public:
+    SharedDateTimePatternGenerator(const Locale &locale, UErrorCode &status);
+    virtual ~SharedDateTimePatternGenerator();
+
+    /** Returns a new copy of the locale's generator that refers back to this object. */
+    DateTimePatternGenerator *createGenerator(UErrorCode &status) const;
+
+    /** Looks up a best pattern by options and skeleton; returns FALSE if it has not been found yet. */
+    UBool getBestPattern(const UnicodeString &key, UnicodeString &pattern) const;
+
+    /** Remembers a best pattern; does nothing once the memo is full. */
+    void putBestPattern(const UnicodeString &key, const UnicodeString &pattern) const;
+
+    /** Returns the memo key for a skeleton and its match options. */
+    static UnicodeString &makeKey(const UnicodeString &skeleton, UDateTimePatternMatchOptions options,
+                                  UnicodeString &key);
+
+private:
+    LocalPointer<DateTimePatternGenerator> fGenerator;
+    // Best patterns keyed by makeKey(); guarded by fBestPatternsMutex.
+    mutable Hashtable fBestPatterns;
+    // Per locale, so that lookups for different locales do not contend.
+    // (UMutex cannot be a member.)
+    mutable std::mutex fBestPatternsMutex;
+
+    SharedDateTimePatternGenerator(const SharedDateTimePatternGenerator &) = delete;
+    SharedDateTimePatternGenerator &operator=(const SharedDateTimePatternGenerator &) = delete;
+};
+
 U_NAMESPACE_END
 
 #endif
@@ -64,7 +64,12 @@ EthiopicCalendar::getType() const
 void
 EthiopicCalendar::setAmeteAlemEra(UBool onOff)
 {
-    eraType = onOff ? AMETE_ALEM_ERA : AMETE_MIHRET_ERA;
+    EEraType newEraType = onOff ? AMETE_ALEM_ERA : AMETE_MIHRET_ERA;
+    if (eraType != newEraType) {
+        // The cached fields were computed with the other era.
+        eraType = newEraType;
+        invalidateFieldsCache();
+    }
 }
     
 UBool
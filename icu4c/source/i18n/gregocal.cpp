@@ -361,6 +361,7 @@ GregorianCalendar::setGregorianChange(UDate date, UErrorCode& status)
     if (cal->get(UCAL_ERA, status) == BC) 
         fGregorianCutoverYear = 1 - fGregorianCutoverYear;
     fCutoverJulianDay = (int32_t)cutoverDay;
+    invalidateFieldsCache();
     delete cal;
 }
 
@@ -25,25 +25,46 @@ U_NAMESPACE_BEGIN
 #define NEW_ARRAY(type,count) (type *) uprv_malloc((count) * sizeof(type))
 #define DELETE_ARRAY(array) uprv_free((void *) (array))
 
-InputText::InputText(UErrorCode &status)
-    : fInputBytes(NEW_ARRAY(uint8_t, BUFFER_SIZE)), // The text to be checked.  Markup will have been
-                                                 //   removed if appropriate.
-      fByteStats(NEW_ARRAY(int16_t, 256)),       // byte frequency statistics for the input text.
-                                                 //   Value is percent, not absolute.
+/*
+ * Length of the leading run of bytes below 0x80, tested eight bytes at a time.
+ */
+static int32_t asciiPrefixLength(const uint8_t *s, int32_t length)
+{
+    int32_t i = 0;
+    uint64_t word;
+
+    for (; i + 8 <= length; i += 8) {
+        uprv_memcpy(&word, s + i, 8);
+        if ((word & 0x8080808080808080ULL) != 0) {
+            break;
+        }
+    }
+
+    while (i < length && s[i] < 0x80) {
+        i += 1;
+    }
+
+    return i;
+}
+
+InputText::InputText(UErrorCode &/*status*/)
+    : fInputBytes(NULL),
+      fInputLen(0),
+      fC1Bytes(FALSE),
       fDeclaredEncoding(0),
       fRawInput(0),
-      fRawLength(0)
+      fRawLength(0),
+      fTextLength(0),
+      fInputLimit(0),
+      fRawAsciiLength(0),
+      fStripBuffer(NULL)
 {
-    if (fInputBytes == NULL || fByteStats == NULL) {
-        status = U_MEMORY_ALLOCATION_ERROR;
-    }
 }
 
 InputText::~InputText()
 {
     DELETE_ARRAY(fDeclaredEncoding);
-    DELETE_ARRAY(fByteStats);
-    DELETE_ARRAY(fInputBytes);
+    DELETE_ARRAY(fStripBuffer);
 }
 
 void InputText::setText(const char *in, int32_t len)
@@ -51,7 +72,17 @@ void InputText::setText(const char *in, int32_t len)
     fInputLen  = 0;
     fC1Bytes   = FALSE;
     fRawInput  = (const uint8_t *) in;
-    fRawLength = len == -1? (int32_t)uprv_strlen(in) : len;
+    fTextLength = len == -1? (int32_t)uprv_strlen(in) : len;
+    setInputLimit(fInputLimit);
+}
+
+void InputText::setInputLimit(int32_t limit)
+{
+    fInputLimit = limit;
+    fRawLength  = fTextLength;
+    if (limit > 0 && limit < fTextLength) {
+        fRawLength = limit;
+    }
 }
 
 void InputText::setDeclaredEncoding(const char* encoding, int32_t len)
@@ -94,7 +125,12 @@ void InputText::MungeInput(UBool fStripTags) {
     //     Count how many total '<' and illegal (nested) '<' occur, so we can make some
     //     guess as to whether the input was actually marked up at all.
     // TODO: Think about how this interacts with EBCDIC charsets that are detected.
-    if (fStripTags) {
+    if (fStripTags && fStripBuffer == NULL) {
+        // If this fails, openTags stays 0 and the raw input is used below.
+        fStripBuffer = NEW_ARRAY(uint8_t, BUFFER_SIZE);
+    }
+
+    if (fStripTags && fStripBuffer != NULL) {
         for (srci = 0; srci < fRawLength && dsti < BUFFER_SIZE; srci += 1) {
             b = fRawInput[srci];
 
@@ -108,7 +144,7 @@ void InputText::MungeInput(UBool fStripTags) {
             }
 
             if (! inMarkup) {
-                fInputBytes[dsti++] = b;
+                fStripBuffer[dsti++] = b;
             }
 
             if (b == (uint8_t)0x3E) { /* Check for the ASCII '>' */
@@ -116,6 +152,7 @@ void InputText::MungeInput(UBool fStripTags) {
             }
         }
 
+        fInputBytes = fStripBuffer;
         fInputLen = dsti;
     }
 
@@ -127,17 +164,13 @@ void InputText::MungeInput(UBool fStripTags) {
     if (openTags<5 || openTags/5 < badTags || 
         (fInputLen < 100 && fRawLength>600))
     {
-        int32_t limit = fRawLength;
+        // Examine the raw input in place; there is nothing to copy.
+        fInputBytes = fRawInput;
+        fInputLen = fRawLength;
 
-        if (limit > BUFFER_SIZE) {
-            limit = BUFFER_SIZE;
+        if (fInputLen > BUFFER_SIZE) {
+            fInputLen = BUFFER_SIZE;
         }
-
-        for (srci=0; srci<limit; srci++) {
-            fInputBytes[srci] = fRawInput[srci];
-        }
-
-        fInputLen = srci;
     }
 
     //
@@ -151,12 +184,20 @@ void InputText::MungeInput(UBool fStripTags) {
         fByteStats[fInputBytes[srci]] += 1;
     }
 
+    fC1Bytes = FALSE;
     for (int32_t i = 0x80; i <= 0x9F; i += 1) {
         if (fByteStats[i] != 0) {
             fC1Bytes = TRUE;
             break;
         }
     }
+
+    //
+    // The multi-byte recognizers work on the raw input, and all of them
+    //   take a 7-bit byte as a valid single byte character, so they
+    //   can start their scans after the leading ASCII run.
+    //
+    fRawAsciiLength = asciiPrefixLength(fRawInput, fRawLength);
 }
 
 U_NAMESPACE_END
@@ -35,17 +35,19 @@ class InputText : public UMemory
 
     void setText(const char *in, int32_t len);
     void setDeclaredEncoding(const char *encoding, int32_t len);
+    void setInputLimit(int32_t limit);
     UBool isSet() const; 
     void MungeInput(UBool fStripTags);
 
     // The text to be checked.  Markup will have been
-    //   removed if appropriate.
-    uint8_t    *fInputBytes;
+    //   removed if appropriate. Points into fRawInput unless
+    //   markup was removed, in which case it points to fStripBuffer.
+    const uint8_t *fInputBytes;
     int32_t     fInputLen;          // Length of the byte data in fInputBytes.
     // byte frequency statistics for the input text.
-    //   Value is percent, not absolute.
-    //   Value is rounded up, so zero really means zero occurences. 
-    int16_t  *fByteStats;
+    //   Value is the number of occurrences of each byte in fInputBytes,
+    //   tallied once by MungeInput() and shared by all of the recognizers.
+    int16_t   fByteStats[256];
     UBool     fC1Bytes;          // True if any bytes in the range 0x80 - 0x9F are in the input;false by default
     char     *fDeclaredEncoding;
 
@@ -53,7 +55,15 @@ class InputText : public UMemory
     //  If user gave us a byte array, this is it.
     //  If user gave us a stream, it's read to a 
     //   buffer here.
-    int32_t                  fRawLength;    // Length of data in fRawInput array.
+    int32_t                  fRawLength;    // Length of data in fRawInput array to be examined;
+                                            //   may be less than fTextLength if an input limit is set.
+    int32_t                  fTextLength;   // Full length of the user's text.
+    int32_t                  fInputLimit;   // Maximum number of bytes to examine, 0 for no limit.
+    int32_t                  fRawAsciiLength; // Length of the leading run of 7-bit bytes in fRawInput.
+
+private:
+    uint8_t                 *fStripBuffer;  // Input with markup removed. Allocated on first use
+                                            //   and reused for all later text.
 
 };
 
@@ -252,6 +252,7 @@ void IslamicCalendar::setCalculationType(ECalculationType type, UErrorCode &stat
         // rules are different
         UDate m = getTimeInMillis(status);
         cType = type;
+        invalidateFieldsCache();
         clear();
         setTimeInMillis(m, status);
     }
@@ -622,6 +623,8 @@ void IslamicCalendar::handleComputeFields(int32_t julianDay, UErrorCode &status)
 
         startDate = (int32_t)uprv_floor(months * CalendarAstronomer::SYNODIC_MONTH);
 
+        // The result depends on the time of day, not just on the day.
+        invalidateFieldsCache();
         double age = moonAge(internalGetTime(), status);
         if (U_FAILURE(status)) {
             status = U_MEMORY_ALLOCATION_ERROR;
@@ -13,6 +13,7 @@
 #include "number_utypes.h"
 #include "numparse_types.h"
 #include "formattedval_impl.h"
+#include "ustr_imp.h"
 #include "unicode/numberformatter.h"
 #include "unicode/unumberformatter.h"
 
@@ -90,7 +91,7 @@ unumf_openForSkeletonAndLocale(const UChar* skeleton, int32_t skeletonLen, const
     }
     // Readonly-alias constructor (first argument is whether we are NUL-terminated)
     UnicodeString skeletonString(skeletonLen == -1, skeleton, skeletonLen);
-    impl->fFormatter = NumberFormatter::forSkeleton(skeletonString, *ec).locale(locale);
+    impl->fFormatter = NumberFormatter::forSkeleton(skeletonString, locale, *ec);
     return impl->exportForC();
 }
 
@@ -145,6 +146,40 @@ unumf_formatDecimal(const UNumberFormatter* uformatter, const char* value, int32
     formatter->fFormatter.formatImpl(&result->fData, *ec);
 }
 
+U_CAPI int32_t U_EXPORT2
+unumf_formatIntToUTF8(const UNumberFormatter* uformatter, int64_t value, char* buffer,
+                      int32_t bufferCapacity, UErrorCode* ec) {
+    const UNumberFormatterData* formatter = UNumberFormatterData::validate(uformatter, *ec);
+    if (U_FAILURE(*ec)) { return 0; }
+
+    if (buffer == nullptr ? bufferCapacity != 0 : bufferCapacity < 0) {
+        *ec = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    CheckedArrayByteSink sink(buffer, bufferCapacity);
+    formatter->fFormatter.formatIntToUTF8(value, sink, *ec);
+    if (U_FAILURE(*ec)) { return 0; }
+    return u_terminateChars(buffer, bufferCapacity, sink.NumberOfBytesAppended(), ec);
+}
+
+U_CAPI int32_t U_EXPORT2
+unumf_formatDoubleToUTF8(const UNumberFormatter* uformatter, double value, char* buffer,
+                         int32_t bufferCapacity, UErrorCode* ec) {
+    const UNumberFormatterData* formatter = UNumberFormatterData::validate(uformatter, *ec);
+    if (U_FAILURE(*ec)) { return 0; }
+
+    if (buffer == nullptr ? bufferCapacity != 0 : bufferCapacity < 0) {
+        *ec = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    CheckedArrayByteSink sink(buffer, bufferCapacity);
+    formatter->fFormatter.formatDoubleToUTF8(value, sink, *ec);
+    if (U_FAILURE(*ec)) { return 0; }
+    return u_terminateChars(buffer, bufferCapacity, sink.NumberOfBytesAppended(), ec);
+}
+
 U_CAPI int32_t U_EXPORT2
 unumf_resultToString(const UFormattedNumber* uresult, UChar* buffer, int32_t bufferCapacity,
                      UErrorCode* ec) {
@@ -5,6 +5,7 @@
 
 #if !UCONFIG_NO_FORMATTING
 
+#include <cfloat>
 #include <cstdlib>
 #include <cmath>
 #include <limits>
@@ -65,7 +66,77 @@ static double DOUBLE_MULTIPLIERS[] = {
         1e18,
         1e19,
         1e20,
-        1e21};
+        1e21,
+        1e22};
+
+/**
+ * True if each double operation is rounded to double precision, so that a multiplication or division
+ * of exact operands gives the correctly rounded result. This is not the case with x87 extended
+ * precision arithmetic.
+ */
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+constexpr bool kDoubleArithmeticIsExact = true;
+#else
+constexpr bool kDoubleArithmeticIsExact = false;
+#endif
+
+/**
+ * Finds the shortest decimal representation of a positive finite double, digits * 10^power, without
+ * the double-conversion library. This succeeds when the double has a representation with at most 15
+ * significant digits, as most doubles from decimal data do, and returns false otherwise.
+ *
+ * Doubles have more than 15 digits of precision, so no two decimals with at most 15 digits round to
+ * the same double. If such a decimal is found to round to the double, it is therefore the only one,
+ * and with its trailing zeros removed, it is the shortest representation.
+ */
+bool getShortestDigitsFast(double n, uint64_t& digits, int32_t& power) {
+    if (!kDoubleArithmeticIsExact || !std::numeric_limits<double>::is_iec559 || !(n > 0)) {
+        return false;
+    }
+    uint64_t ieeeBits;
+    uprv_memcpy(&ieeeBits, &n, sizeof(n));
+    int32_t exponent = static_cast<int32_t>((ieeeBits & 0x7ff0000000000000L) >> 52) - 0x3ff;
+    if (exponent == -1023 || exponent == 1024) {
+        return false;
+    }
+
+    // Scale the double to an integer below 2^53 / 10, which is less than 10^15.
+    // 3.3219... is log2(10)
+    auto fracLength = static_cast<int32_t>((52 - exponent) / 3.32192809488736234787031942948939017586) - 1;
+    uint64_t result = 0;
+    for (int32_t attempt = 0; attempt < 2; attempt++) {
+        // 1e22 is the largest exact double.
+        if (fracLength > 22 || fracLength < -22) {
+            return false;
+        }
+        double scaled = fracLength >= 0 ? n * DOUBLE_MULTIPLIERS[fracLength] : n / DOUBLE_MULTIPLIERS[-fracLength];
+        result = static_cast<uint64_t>(uprv_round(scaled));
+        if (result >= 100000000000000ULL) {
+            break;
+        }
+        // There is room for one more digit.
+        fracLength++;
+    }
+    if (result == 0 || result >= 1000000000000000ULL) {
+        return false;
+    }
+
+    // The integer and the power of ten are exact doubles, so the check is a single correctly
+    // rounded operation.
+    double check = fracLength >= 0
+        ? static_cast<double>(result) / DOUBLE_MULTIPLIERS[fracLength]
+        : static_cast<double>(result) * DOUBLE_MULTIPLIERS[-fracLength];
+    if (check != n) {
+        return false;
+    }
+    while (result % 10 == 0) {
+        result /= 10;
+        fracLength--;
+    }
+    digits = result;
+    power = -fracLength;
+    return true;
+}
 
 }  // namespace
 
@@ -483,6 +554,17 @@ void DecimalQuantity::convertToAccurateDouble() {
     U_ASSERT(origDouble != 0);
     int32_t delta = origDelta;
 
+    // Try the fast path for doubles with a short decimal representation first.
+    uint64_t digits;
+    int32_t power;
+    if (getShortestDigitsFast(origDouble, digits, power)) {
+        setBcdToZero();
+        readLongToBcd(static_cast<int64_t>(digits));
+        scale = power + delta;
+        explicitExactDouble = true;
+        return;
+    }
+
     // Call the slow oracle function (Double.toString in Java, DoubleToAscii in C++).
     char buffer[DoubleToStringConverter::kBase10MaximalLength + 1];
     bool sign; // unused; always positive
@@ -616,6 +698,19 @@ double DecimalQuantity::toDouble() const {
         return isNegative() ? -INFINITY : INFINITY;
     }
 
+    // Fast path: an integer of up to 15 digits and a power of ten up to 10^22 are exact doubles,
+    // so a single correctly rounded multiplication or division gives the result.
+    int32_t power = scale + exponent;
+    if (kDoubleArithmeticIsExact && precision <= 15 && power >= -22 && power <= 22) {
+        uint64_t digits = 0;
+        for (int32_t p = precision - 1; p >= 0; p--) {
+            digits = digits * 10 + getDigitPos(p);
+        }
+        double result = static_cast<double>(digits);
+        result = power >= 0 ? result * DOUBLE_MULTIPLIERS[power] : result / DOUBLE_MULTIPLIERS[-power];
+        return isNegative() ? -result : result;
+    }
+
     // We are processing well-formed input, so we don't need any special options to StringToDoubleConverter.
     StringToDoubleConverter converter(0, 0, 0, "", "");
     UnicodeString numberString = this->toScientificString();
@@ -630,15 +725,21 @@ void DecimalQuantity::toDecNum(DecNum& output, UErrorCode& status) const {
     // Special handling for zero
     if (precision == 0) {
         output.setTo("0", status);
+        return;
     }
 
-    // Use the BCD constructor. We need to do a little bit of work to convert, though.
-    // The decNumber constructor expects most-significant first, but we store least-significant first.
-    MaybeStackArray<uint8_t, 20> ubcd(precision);
+    // The byte array has the same layout as the decNumber units, least-significant digit first.
+    if (usingBytes) {
+        output.setToUnits(fBCD.bcdBytes.ptr, precision, scale, isNegative(), status);
+        return;
+    }
+    int8_t units[16];
+    uint64_t bcdLong = fBCD.bcdLong;
     for (int32_t m = 0; m < precision; m++) {
-        ubcd[precision - m - 1] = static_cast<uint8_t>(getDigitPos(m));
+        units[m] = static_cast<int8_t>(bcdLong & 0xf);
+        bcdLong >>= 4;
     }
-    output.setTo(ubcd.getAlias(), precision, scale, isNegative(), status);
+    output.setToUnits(units, precision, scale, isNegative(), status);
 }
 
 void DecimalQuantity::truncate() {
@@ -1004,13 +1105,8 @@ void DecimalQuantity::shiftLeft(int32_t numDigits) {
     }
     if (usingBytes) {
         ensureCapacity(precision + numDigits);
-        int i = precision + numDigits - 1;
-        for (; i >= numDigits; i--) {
-            fBCD.bcdBytes.ptr[i] = fBCD.bcdBytes.ptr[i - numDigits];
-        }
-        for (; i >= 0; i--) {
-            fBCD.bcdBytes.ptr[i] = 0;
-        }
+        uprv_memmove(fBCD.bcdBytes.ptr + numDigits, fBCD.bcdBytes.ptr, precision);
+        uprv_memset(fBCD.bcdBytes.ptr, 0, numDigits);
     } else {
         fBCD.bcdLong <<= (numDigits * 4);
     }
@@ -1020,12 +1116,11 @@ void DecimalQuantity::shiftLeft(int32_t numDigits) {
 
 void DecimalQuantity::shiftRight(int32_t numDigits) {
     if (usingBytes) {
-        int i = 0;
-        for (; i < precision - numDigits; i++) {
-            fBCD.bcdBytes.ptr[i] = fBCD.bcdBytes.ptr[i + numDigits];
-        }
-        for (; i < precision; i++) {
-            fBCD.bcdBytes.ptr[i] = 0;
+        if (numDigits < precision) {
+            uprv_memmove(fBCD.bcdBytes.ptr, fBCD.bcdBytes.ptr + numDigits, precision - numDigits);
+            uprv_memset(fBCD.bcdBytes.ptr + precision - numDigits, 0, numDigits);
+        } else if (precision > 0) {
+            uprv_memset(fBCD.bcdBytes.ptr, 0, precision);
         }
     } else {
         fBCD.bcdLong >>= (numDigits * 4);
@@ -1037,10 +1132,7 @@ void DecimalQuantity::shiftRight(int32_t numDigits) {
 void DecimalQuantity::popFromLeft(int32_t numDigits) {
     U_ASSERT(numDigits <= precision);
     if (usingBytes) {
-        int i = precision - 1;
-        for (; i >= precision - numDigits; i--) {
-            fBCD.bcdBytes.ptr[i] = 0;
-        }
+        uprv_memset(fBCD.bcdBytes.ptr + precision - numDigits, 0, numDigits);
     } else {
         fBCD.bcdLong &= (static_cast<uint64_t>(1) << ((precision - numDigits) * 4)) - 1;
     }
@@ -1104,10 +1196,10 @@ void DecimalQuantity::readLongToBcd(int64_t n) {
 void DecimalQuantity::readDecNumberToBcd(const DecNum& decnum) {
     const decNumber* dn = decnum.getRawDecNumber();
     if (dn->digits > 16) {
+        // With one digit per unit, the decNumber units are the BCD bytes.
+        static_assert(DECDPUN == 1, "readDecNumberToBcd() requires one digit per decNumber unit");
         ensureCapacity(dn->digits);
-        for (int32_t i = 0; i < dn->digits; i++) {
-            fBCD.bcdBytes.ptr[i] = dn->lsu[i];
-        }
+        uprv_memcpy(fBCD.bcdBytes.ptr, dn->lsu, dn->digits);
     } else {
         uint64_t result = 0L;
         for (int32_t i = 0; i < dn->digits; i++) {
@@ -45,6 +45,12 @@ class U_I18N_API DecNum : public UMemory {
     /** Sets the decNumber to the BCD representation. */
     void setTo(const uint8_t* bcd, int32_t length, int32_t scale, bool isNegative, UErrorCode& status);
 
+    /**
+     * Sets the decNumber to digits stored one per byte, least significant first. This is the layout
+     * of the decNumber units, so the digits are copied as they are.
+     */
+    void setToUnits(const int8_t* units, int32_t length, int32_t scale, bool isNegative, UErrorCode& status);
+
     void normalize();
 
     void multiplyBy(const DecNum& rhs, UErrorCode& status);
@@ -67,6 +73,8 @@ class U_I18N_API DecNum : public UMemory {
     decContext fContext;
 
     void _setTo(const char* str, int32_t maxDigits, UErrorCode& status);
+
+    bool setHeader(int32_t length, int32_t scale, bool isNegative, UErrorCode& status);
 };
 
 } // namespace impl
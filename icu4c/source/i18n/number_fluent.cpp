@@ -7,6 +7,7 @@
 
 #include "uassert.h"
 #include "unicode/numberformatter.h"
+#include "unicode/ustring.h"
 #include "number_decimalquantity.h"
 #include "number_formatimpl.h"
 #include "umutex.h"
@@ -15,6 +16,7 @@
 #include "number_utypes.h"
 #include "util.h"
 #include "fphdlimp.h"
+#include "ustr_imp.h"
 
 using namespace icu;
 using namespace icu::number;
@@ -404,17 +406,20 @@ LocalizedNumberFormatter::LocalizedNumberFormatter(const NFS<LNF>& other)
 }
 
 LocalizedNumberFormatter::LocalizedNumberFormatter(LocalizedNumberFormatter&& src) U_NOEXCEPT
-        : LNF(static_cast<NFS<LNF>&&>(src)) {}
-
-LocalizedNumberFormatter::LocalizedNumberFormatter(NFS<LNF>&& src) U_NOEXCEPT
-        : NFS<LNF>(std::move(src)) {
+        : NFS<LNF>(static_cast<NFS<LNF>&&>(src)) {
     // For the move operators, copy over the compiled formatter.
     // Note: if the formatter is not compiled, call count information is lost.
-    if (static_cast<LNF&&>(src).fCompiled != nullptr) {
-        lnfMoveHelper(static_cast<LNF&&>(src));
+    if (src.fCompiled != nullptr) {
+        lnfMoveHelper(std::move(src));
     }
 }
 
+LocalizedNumberFormatter::LocalizedNumberFormatter(NFS<LNF>&& src) U_NOEXCEPT
+        : NFS<LNF>(std::move(src)) {
+    // The fluent setters use this constructor and then change the settings, so the compiled
+    // formatter is not copied over (let call count and compiled formatter reset to defaults).
+}
+
 LocalizedNumberFormatter& LocalizedNumberFormatter::operator=(const LNF& other) {
     NFS<LNF>::operator=(static_cast<const NFS<LNF>&>(other));
     // Reset to default values.
@@ -439,8 +444,10 @@ void LocalizedNumberFormatter::clear() {
     // Reset to default values.
     auto* callCount = reinterpret_cast<u_atomic_int32_t*>(fUnsafeCallCount);
     umtx_storeRelease(*callCount, 0);
-    delete fCompiled;
-    fCompiled = nullptr;
+    if (fCompiled != nullptr) {
+        fCompiled->removeRef();
+        fCompiled = nullptr;
+    }
 }
 
 void LocalizedNumberFormatter::lnfMoveHelper(LNF&& src) {
@@ -449,7 +456,9 @@ void LocalizedNumberFormatter::lnfMoveHelper(LNF&& src) {
     // The bits themselves appear to be platform-dependent, so copying them might not be safe.
     auto* callCount = reinterpret_cast<u_atomic_int32_t*>(fUnsafeCallCount);
     umtx_storeRelease(*callCount, INT32_MIN);
-    delete fCompiled;
+    if (fCompiled != nullptr) {
+        fCompiled->removeRef();
+    }
     fCompiled = src.fCompiled;
     // Reset the source object to leave it in a safe state.
     auto* srcCallCount = reinterpret_cast<u_atomic_int32_t*>(src.fUnsafeCallCount);
@@ -457,9 +466,40 @@ void LocalizedNumberFormatter::lnfMoveHelper(LNF&& src) {
     src.fCompiled = nullptr;
 }
 
+void LocalizedNumberFormatter::lnfCompileHelper(UErrorCode& status) {
+    if (U_FAILURE(status) || fCompiled != nullptr) {
+        return;
+    }
+    const NumberFormatterImpl* compiled = new NumberFormatterImpl(fMacros, status);
+    if (compiled == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    compiled->addRef();
+    if (U_FAILURE(status)) {
+        compiled->removeRef();
+        return;
+    }
+    fCompiled = compiled;
+    auto* callCount = reinterpret_cast<u_atomic_int32_t*>(fUnsafeCallCount);
+    umtx_storeRelease(*callCount, INT32_MIN);
+}
+
+void LocalizedNumberFormatter::lnfShareHelper(const LNF& src) {
+    // As in lnfMoveHelper(), but the compiled formatter stays with src as well.
+    U_ASSERT(src.fCompiled != nullptr);
+    clear();
+    src.fCompiled->addRef();
+    fCompiled = src.fCompiled;
+    auto* callCount = reinterpret_cast<u_atomic_int32_t*>(fUnsafeCallCount);
+    umtx_storeRelease(*callCount, INT32_MIN);
+}
+
 
 LocalizedNumberFormatter::~LocalizedNumberFormatter() {
-    delete fCompiled;
+    if (fCompiled != nullptr) {
+        fCompiled->removeRef();
+    }
 }
 
 LocalizedNumberFormatter::LocalizedNumberFormatter(const MacroProps& macros, const Locale& locale) {
@@ -605,7 +645,11 @@ FormattedNumber LocalizedNumberFormatter::formatInt(int64_t value, UErrorCode& s
         return FormattedNumber(status);
     }
     results->quantity.setToLong(value);
-    formatImpl(results, status);
+    if (formatSimpleInteger(value, results->getStringRef(), status)) {
+        results->getStringRef().writeTerminator(status);
+    } else {
+        formatImpl(results, status);
+    }
 
     // Do not save the results object if we encountered a failure.
     if (U_SUCCESS(status)) {
@@ -674,6 +718,230 @@ LocalizedNumberFormatter::formatDecimalQuantity(const DecimalQuantity& dq, UErro
     }
 }
 
+namespace {
+
+bool checkBuffer(const char16_t* dest, int32_t capacity, UErrorCode& status) {
+    if (U_FAILURE(status)) { return false; }
+    if (capacity < 0 || (dest == nullptr && capacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return false;
+    }
+    return true;
+}
+
+int32_t extractToBuffer(const FormattedStringBuilder& string, char16_t* dest, int32_t capacity,
+                        UErrorCode& status) {
+    if (U_FAILURE(status)) { return 0; }
+    int32_t length = string.length();
+    if (length <= capacity) {
+        u_memcpy(dest, string.chars(), length);
+    }
+    return u_terminateUChars(dest, capacity, length, &status);
+}
+
+void appendUTF8(const FormattedStringBuilder& string, ByteSink& sink, UErrorCode& status) {
+    if (U_FAILURE(status)) { return; }
+    // Convert from the builder's own buffer, which the temporary string aliases.
+    string.toTempUnicodeString().toUTF8(sink);
+}
+
+/**
+ * Writes the strings of a batch one after the other into the caller's buffer, and records where
+ * each of them starts. Once the buffer is full, only the lengths are counted.
+ */
+class BatchWriter {
+  public:
+    BatchWriter(char16_t* dest, int32_t capacity, int32_t* offsets)
+            : fDest(dest), fCapacity(capacity), fOffsets(offsets), fLength(0), fWritten(0) {}
+
+    // On an argument error, the offsets are still all set to 0 if they can be.
+    static bool checkArguments(const void* values, int32_t count, const char16_t* dest,
+                               int32_t capacity, int32_t* offsets, UErrorCode& status) {
+        if (U_SUCCESS(status) && (count < 0 || (values == nullptr && count > 0) || offsets == nullptr)) {
+            status = U_ILLEGAL_ARGUMENT_ERROR;
+        }
+        if (U_SUCCESS(status)) {
+            checkBuffer(dest, capacity, status);
+        }
+        if (U_FAILURE(status)) {
+            if (offsets != nullptr && count >= 0) {
+                for (int32_t i = 0; i <= count; i++) {
+                    offsets[i] = 0;
+                }
+            }
+            return false;
+        }
+        return true;
+    }
+
+    void append(int32_t index, const FormattedStringBuilder& string, UErrorCode& status) {
+        if (U_FAILURE(status)) { return; }
+        int32_t length = string.length();
+        if (length > INT32_MAX - fLength) {
+            status = U_INDEX_OUTOFBOUNDS_ERROR;
+            return;
+        }
+        fOffsets[index] = fLength;
+        if (length <= fCapacity - fLength) {
+            u_memcpy(fDest + fLength, string.chars(), length);
+        }
+        fLength += length;
+        fWritten = index + 1;
+    }
+
+    // After an error, the offsets of the values that were not formatted, and offsets[count],
+    // are set to the end of the last formatted string, so that those values read as empty.
+    int32_t finish(int32_t count, UErrorCode& status) {
+        if (U_FAILURE(status)) {
+            for (int32_t i = fWritten; i <= count; i++) {
+                fOffsets[i] = fLength;
+            }
+            return 0;
+        }
+        fOffsets[count] = fLength;
+        return u_terminateUChars(fDest, fCapacity, fLength, &status);
+    }
+
+  private:
+    char16_t* fDest;
+    int32_t fCapacity;
+    int32_t* fOffsets;
+    int32_t fLength;
+    int32_t fWritten;  // Number of values that were formatted.
+};
+
+} // namespace
+
+// The DecimalQuantity and the FormattedStringBuilder used by the following methods live on the
+// stack. Both keep short values in inline storage, so typical numbers are formatted without any
+// heap allocation.
+
+int32_t LocalizedNumberFormatter::formatInt(int64_t value, char16_t* dest, int32_t capacity,
+                                            UErrorCode& status) const {
+    if (!checkBuffer(dest, capacity, status)) { return 0; }
+    FormattedStringBuilder string;
+    formatIntToBuilder(value, string, status);
+    return extractToBuffer(string, dest, capacity, status);
+}
+
+int32_t LocalizedNumberFormatter::formatDouble(double value, char16_t* dest, int32_t capacity,
+                                               UErrorCode& status) const {
+    if (!checkBuffer(dest, capacity, status)) { return 0; }
+    DecimalQuantity quantity;
+    quantity.setToDouble(value);
+    FormattedStringBuilder string;
+    formatToBuilder(quantity, string, status);
+    return extractToBuffer(string, dest, capacity, status);
+}
+
+void LocalizedNumberFormatter::formatIntToUTF8(int64_t value, ByteSink& sink, UErrorCode& status) const {
+    if (U_FAILURE(status)) { return; }
+    FormattedStringBuilder string;
+    formatIntToBuilder(value, string, status);
+    appendUTF8(string, sink, status);
+}
+
+void LocalizedNumberFormatter::formatDoubleToUTF8(double value, ByteSink& sink, UErrorCode& status) const {
+    if (U_FAILURE(status)) { return; }
+    DecimalQuantity quantity;
+    quantity.setToDouble(value);
+    FormattedStringBuilder string;
+    formatToBuilder(quantity, string, status);
+    appendUTF8(string, sink, status);
+}
+
+// The batch methods format all of the values with a single DecimalQuantity and
+// FormattedStringBuilder, which are reset for each value.
+
+int32_t LocalizedNumberFormatter::formatIntBatch(const int64_t* values, int32_t count, char16_t* dest,
+                                                 int32_t capacity, int32_t* offsets,
+                                                 UErrorCode& status) const {
+    if (!BatchWriter::checkArguments(values, count, dest, capacity, offsets, status)) { return 0; }
+    BatchWriter writer(dest, capacity, offsets);
+    DecimalQuantity quantity;
+    FormattedStringBuilder string;
+    for (int32_t i = 0; i < count && U_SUCCESS(status); i++) {
+        string.clear();
+        if (!formatSimpleInteger(values[i], string, status)) {
+            quantity.clear();
+            quantity.setToLong(values[i]);
+            formatToBuilder(quantity, string, status);
+        }
+        writer.append(i, string, status);
+    }
+    return writer.finish(count, status);
+}
+
+int32_t LocalizedNumberFormatter::formatDoubleBatch(const double* values, int32_t count, char16_t* dest,
+                                                    int32_t capacity, int32_t* offsets,
+                                                    UErrorCode& status) const {
+    if (!BatchWriter::checkArguments(values, count, dest, capacity, offsets, status)) { return 0; }
+    BatchWriter writer(dest, capacity, offsets);
+    DecimalQuantity quantity;
+    FormattedStringBuilder string;
+    for (int32_t i = 0; i < count && U_SUCCESS(status); i++) {
+        string.clear();
+        quantity.clear();
+        quantity.setToDouble(values[i]);
+        formatToBuilder(quantity, string, status);
+        writer.append(i, string, status);
+    }
+    return writer.finish(count, status);
+}
+
+int32_t LocalizedNumberFormatter::formatDecimalBatch(const StringPiece* values, int32_t count,
+                                                     char16_t* dest, int32_t capacity, int32_t* offsets,
+                                                     UErrorCode& status) const {
+    if (!BatchWriter::checkArguments(values, count, dest, capacity, offsets, status)) { return 0; }
+    BatchWriter writer(dest, capacity, offsets);
+    DecimalQuantity quantity;
+    FormattedStringBuilder string;
+    for (int32_t i = 0; i < count && U_SUCCESS(status); i++) {
+        string.clear();
+        quantity.clear();
+        if (values[i].data() == nullptr && values[i].length() != 0) {
+            status = U_ILLEGAL_ARGUMENT_ERROR;
+            break;
+        }
+        quantity.setToDecNumber(values[i], status);
+        if (U_FAILURE(status)) { break; }
+        formatToBuilder(quantity, string, status);
+        writer.append(i, string, status);
+    }
+    return writer.finish(count, status);
+}
+
+void LocalizedNumberFormatter::formatToBuilder(DecimalQuantity& quantity, FormattedStringBuilder& string,
+                                               UErrorCode& status) const {
+    if (computeCompiled(status)) {
+        fCompiled->format(quantity, string, status);
+    } else {
+        NumberFormatterImpl::formatStatic(fMacros, quantity, string, status);
+    }
+}
+
+void LocalizedNumberFormatter::formatIntToBuilder(int64_t value, FormattedStringBuilder& string,
+                                                  UErrorCode& status) const {
+    if (formatSimpleInteger(value, string, status)) {
+        return;
+    }
+    DecimalQuantity quantity;
+    quantity.setToLong(value);
+    formatToBuilder(quantity, string, status);
+}
+
+bool LocalizedNumberFormatter::formatSimpleInteger(int64_t value, FormattedStringBuilder& string,
+                                                   UErrorCode& status) const {
+    // Only once the formatter has been compiled: until then, every call must go through
+    // computeCompiled() to be counted.
+    auto* callCount = reinterpret_cast<u_atomic_int32_t*>(
+            const_cast<LocalizedNumberFormatter*>(this)->fUnsafeCallCount);
+    if (umtx_loadAcquire(*callCount) >= 0) {
+        return false;
+    }
+    return fCompiled->formatSimpleInteger(value, string, status);
+}
+
 void LocalizedNumberFormatter::formatImpl(impl::UFormattedNumberData* results, UErrorCode& status) const {
     if (computeCompiled(status)) {
         fCompiled->format(results->quantity, results->getStringRef(), status);
@@ -734,6 +1002,7 @@ bool LocalizedNumberFormatter::computeCompiled(UErrorCode& status) const {
             status = U_MEMORY_ALLOCATION_ERROR;
             return false;
         }
+        compiled->addRef();
         U_ASSERT(fCompiled == nullptr);
         const_cast<LocalizedNumberFormatter*>(this)->fCompiled = compiled;
         umtx_storeRelease(*callCount, INT32_MIN);
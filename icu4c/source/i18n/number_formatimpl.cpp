@@ -64,6 +64,86 @@ int32_t NumberFormatterImpl::format(DecimalQuantity& inValue, FormattedStringBui
     return length;
 }
 
+namespace {
+
+// The two decimal digits of each number from 0 to 99.
+const char kDigitPairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+} // namespace
+
+bool NumberFormatterImpl::formatSimpleInteger(int64_t value, FormattedStringBuilder& outString,
+                                              UErrorCode& status) const {
+    if (!fSimpleInteger.fValid) { return false; }
+    if (U_FAILURE(status)) { return true; }
+
+    // Write the digits from the end of the buffer, two at a time.
+    char16_t digits[20];
+    int32_t start = UPRV_LENGTHOF(digits);
+    char16_t zero = fSimpleInteger.fZeroDigit;
+    uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+    while (magnitude >= 100) {
+        const char* pair = kDigitPairs + (magnitude % 100) * 2;
+        magnitude /= 100;
+        digits[--start] = static_cast<char16_t>(zero + (pair[1] - '0'));
+        digits[--start] = static_cast<char16_t>(zero + (pair[0] - '0'));
+    }
+    if (magnitude >= 10) {
+        const char* pair = kDigitPairs + magnitude * 2;
+        digits[--start] = static_cast<char16_t>(zero + (pair[1] - '0'));
+        digits[--start] = static_cast<char16_t>(zero + (pair[0] - '0'));
+    } else {
+        digits[--start] = static_cast<char16_t>(zero + magnitude);
+    }
+    int32_t digitCount = UPRV_LENGTHOF(digits) - start;
+
+    // Split the digits into groups, as Grouper::groupAtPosition() does: the first separator
+    // follows the last fGrouping1 digits, the others follow every fGrouping2 digits before.
+    int32_t grouping1 = fSimpleInteger.fGrouping1;
+    int32_t grouping2 = fSimpleInteger.fGrouping2;
+    int32_t groupLength = digitCount;
+    if (grouping1 > 0 && digitCount > grouping1 && digitCount - grouping1 >= fSimpleInteger.fMinGrouping) {
+        groupLength = (digitCount - grouping1) % grouping2;
+        if (groupLength == 0) {
+            groupLength = grouping2;
+        }
+    }
+    UnicodeString digitString(FALSE, digits, UPRV_LENGTHOF(digits));
+    int32_t length = 0;
+    for (;;) {
+        length += outString.insert(
+                length,
+                digitString,
+                start,
+                start + groupLength,
+                {UFIELD_CATEGORY_NUMBER, UNUM_INTEGER_FIELD},
+                status);
+        start += groupLength;
+        if (start == UPRV_LENGTHOF(digits)) {
+            break;
+        }
+        length += outString.insert(
+                length,
+                fSimpleInteger.fGroupingSeparator,
+                {UFIELD_CATEGORY_NUMBER, UNUM_GROUPING_SEPARATOR_FIELD},
+                status);
+        groupLength = UPRV_LENGTHOF(digits) - start == grouping1 ? grouping1 : grouping2;
+    }
+
+    Signum signum = value < 0 ? SIGNUM_NEG : value == 0 ? SIGNUM_POS_ZERO : SIGNUM_POS;
+    fSimpleInteger.fModifiers[signum]->apply(outString, 0, length, status);
+    return true;
+}
+
 void NumberFormatterImpl::preProcess(DecimalQuantity& inValue, MicroProps& microsOut,
                                      UErrorCode& status) const {
     if (U_FAILURE(status)) { return; }
@@ -163,8 +243,18 @@ NumberFormatterImpl::macrosToMicroGenerator(const MacroProps& macros, bool safe,
     fMicros.nsName[8] = 0; // guarantee NUL-terminated
 
     // Resolve the symbols. Do this here because currency may need to customize them.
-    if (macros.symbols.isDecimalFormatSymbols()) {
+    // A safe (compiled) formatter owns a copy of the symbols, since it can outlive the
+    // macros when it is shared between formatters; see LocalizedNumberFormatter::lnfShareHelper().
+    if (macros.symbols.isDecimalFormatSymbols() && !safe) {
         fMicros.symbols = macros.symbols.getDecimalFormatSymbols();
+    } else if (macros.symbols.isDecimalFormatSymbols()) {
+        LocalPointer<DecimalFormatSymbols> newSymbols(
+            new DecimalFormatSymbols(*macros.symbols.getDecimalFormatSymbols()), status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        fMicros.symbols = newSymbols.getAlias();
+        fSymbols.adoptInstead(newSymbols.orphan());
     } else {
         LocalPointer<DecimalFormatSymbols> newSymbols(
             new DecimalFormatSymbols(macros.locale, *ns, status), status);
@@ -399,9 +489,56 @@ NumberFormatterImpl::macrosToMicroGenerator(const MacroProps& macros, bool safe,
         chain = patternModifier;
     }
 
+    if (safe) {
+        setupSimpleIntegerPlan(macros, precision, status);
+    }
+
     return chain;
 }
 
+void NumberFormatterImpl::setupSimpleIntegerPlan(const MacroProps& macros, const Precision& precision,
+                                                 UErrorCode& status) {
+    if (U_FAILURE(status)) { return; }
+
+    // Nothing may change the digits of an integer, or add anything but the pattern affixes.
+    if (fScientificHandler.isValid() || fLongNameHandler.isValid() || fCompactHandler.isValid() ||
+            macros.scale.isValid() || fMicros.padding.isValid() ||
+            fMicros.decimal != UNUM_DECIMAL_SEPARATOR_AUTO || fPatternModifier->needsPlurals()) {
+        return;
+    }
+    if (precision.fType != Precision::RND_NONE &&
+            (precision.fType != Precision::RND_FRACTION || precision.fUnion.fracSig.fMinFrac != 0)) {
+        return;
+    }
+    const IntegerWidth& integerWidth = fMicros.integerWidth;
+    if (integerWidth.fHasError || integerWidth.fUnion.minMaxInt.fMinInt > 1 ||
+            (integerWidth.fUnion.minMaxInt.fMaxInt != -1 && integerWidth.fUnion.minMaxInt.fMaxInt < 19)) {
+        // Zero-filling, or truncation of int64 values.
+        return;
+    }
+    UChar32 zeroDigit = fMicros.symbols->getCodePointZero();
+    if (zeroDigit == -1 || !U_IS_BMP(zeroDigit)) {
+        return;
+    }
+    const Grouper& grouping = fMicros.grouping;
+    if (grouping.fGrouping1 > 0 && grouping.fGrouping2 <= 0) {
+        return;
+    }
+
+    fSimpleInteger.fZeroDigit = static_cast<char16_t>(zeroDigit);
+    fSimpleInteger.fGroupingSeparator = fMicros.symbols->getSymbol(fMicros.useCurrency
+            ? DecimalFormatSymbols::ENumberFormatSymbol::kMonetaryGroupingSeparatorSymbol
+            : DecimalFormatSymbols::ENumberFormatSymbol::kGroupingSeparatorSymbol);
+    fSimpleInteger.fGrouping1 = grouping.fGrouping1;
+    fSimpleInteger.fGrouping2 = grouping.fGrouping2;
+    fSimpleInteger.fMinGrouping = grouping.fMinGrouping;
+    for (int32_t i = 0; i < SIGNUM_COUNT; i++) {
+        fSimpleInteger.fModifiers[i] =
+                fImmutablePatternModifier->getModifier(static_cast<Signum>(i), StandardPlural::OTHER);
+    }
+    fSimpleInteger.fValid = true;
+}
+
 const PluralRules*
 NumberFormatterImpl::resolvePluralRules(const PluralRules* rulesPtr, const Locale& locale,
                                         UErrorCode& status) {
@@ -15,6 +15,7 @@
 #include "number_longnames.h"
 #include "number_compact.h"
 #include "number_microprops.h"
+#include "sharedobject.h"
 
 U_NAMESPACE_BEGIN namespace number {
 namespace impl {
@@ -22,12 +23,15 @@ namespace impl {
 /**
  * This is the "brain" of the number formatting pipeline. It ties all the pieces together, taking in a MacroProps and a
  * DecimalQuantity and outputting a properly formatted number string.
+ *
+ * A compiled NumberFormatterImpl is reference-counted, so that LocalizedNumberFormatters created for the same
+ * skeleton and locale can share it.
  */
-class NumberFormatterImpl : public UMemory {
+class NumberFormatterImpl : public SharedObject {
   public:
     /**
      * Builds a "safe" MicroPropsGenerator, which is thread-safe and can be used repeatedly.
-     * The caller owns the returned NumberFormatterImpl.
+     * The caller must addRef() the returned NumberFormatterImpl, and removeRef() it when done.
      */
     NumberFormatterImpl(const MacroProps &macros, UErrorCode &status);
 
@@ -53,6 +57,16 @@ class NumberFormatterImpl : public UMemory {
      */
     int32_t format(DecimalQuantity& inValue, FormattedStringBuilder& outString, UErrorCode& status) const;
 
+    /**
+     * Formats an integer directly with the precomputed "simple integer" plan, skipping the
+     * MicroPropsGenerator chain and the DecimalQuantity. The plan exists only for the "safe" object,
+     * and only when the settings can not change how an integer is printed beyond grouping and the
+     * pattern affixes.
+     *
+     * @return false if there is no plan; the caller must then use format().
+     */
+    bool formatSimpleInteger(int64_t value, FormattedStringBuilder& outString, UErrorCode& status) const;
+
     /**
      * Like format(), but saves the result into an output MicroProps without additional processing.
      */
@@ -104,6 +118,18 @@ class NumberFormatterImpl : public UMemory {
         CurrencySymbols fCurrencySymbols;
     } fWarehouse;
 
+    // The plan used by formatSimpleInteger():
+    struct SimpleIntegerPlan {
+        bool fValid = false;
+        char16_t fZeroDigit;
+        UnicodeString fGroupingSeparator;
+        int16_t fGrouping1;
+        int16_t fGrouping2;
+        int16_t fMinGrouping;
+        // Pattern modifiers, indexed by Signum.
+        const Modifier* fModifiers[SIGNUM_COUNT];
+    } fSimpleInteger;
+
 
     NumberFormatterImpl(const MacroProps &macros, bool safe, UErrorCode &status);
 
@@ -135,6 +161,13 @@ class NumberFormatterImpl : public UMemory {
     const MicroPropsGenerator *
     macrosToMicroGenerator(const MacroProps &macros, bool safe, UErrorCode &status);
 
+    /**
+     * Sets up fSimpleInteger if integers formatted with these settings need nothing more than
+     * digits, grouping separators and the pattern modifier. Called at the end of
+     * macrosToMicroGenerator() for the "safe" object.
+     */
+    void setupSimpleIntegerPlan(const MacroProps& macros, const Precision& precision, UErrorCode& status);
+
     static int32_t
     writeIntegerDigits(const MicroProps &micros, DecimalQuantity &quantity, FormattedStringBuilder &string,
                        int32_t index, UErrorCode &status);
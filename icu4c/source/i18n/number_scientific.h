@@ -52,7 +52,9 @@ class ScientificHandler : public UMemory, public MicroPropsGenerator, public Mul
     int32_t getMultiplier(int32_t magnitude) const U_OVERRIDE;
 
   private:
-    const Notation::ScientificSettings& fSettings;
+    // A copy: the notation may belong to a formatter that no longer exists
+    // when a shared NumberFormatterImpl is used.
+    const Notation::ScientificSettings fSettings;
     const DecimalFormatSymbols *fSymbols;
     const MicroPropsGenerator *fParent;
 
@@ -24,6 +24,9 @@
 #include "unicode/errorcode.h"
 #include "util.h"
 #include "measunit_impl.h"
+#include "number_formatimpl.h"
+#include "sharedobject.h"
+#include "unifiedcache.h"
 
 using namespace icu;
 using namespace icu::number;
@@ -1723,6 +1726,115 @@ NumberFormatter::forSkeleton(const UnicodeString& skeleton, UParseError& perror,
     return skeleton::create(skeleton, &perror, status);
 }
 
+U_NAMESPACE_BEGIN
+namespace number {
+namespace impl {
+
+/**
+ * A compiled LocalizedNumberFormatter for a skeleton and locale, shared through the UnifiedCache.
+ */
+class SkeletonFormatterCacheData : public SharedObject {
+  public:
+    SkeletonFormatterCacheData(const UnicodeString& skeleton, const Locale& locale, UErrorCode& status)
+            : fFormatter(skeleton::create(skeleton, nullptr, status).locale(locale)) {
+        fFormatter.lnfCompileHelper(status);
+    }
+
+    virtual ~SkeletonFormatterCacheData();
+
+    /** Returns a formatter sharing the compiled formatter. */
+    LocalizedNumberFormatter createFormatter() const {
+        LocalizedNumberFormatter result(fFormatter);
+        result.lnfShareHelper(fFormatter);
+        return result;
+    }
+
+  private:
+    LocalizedNumberFormatter fFormatter;
+};
+
+SkeletonFormatterCacheData::~SkeletonFormatterCacheData() = default;
+
+class SkeletonFormatterCacheKey : public LocaleCacheKey<SkeletonFormatterCacheData> {
+  public:
+    SkeletonFormatterCacheKey(const Locale& locale, const UnicodeString& skeleton)
+            : LocaleCacheKey<SkeletonFormatterCacheData>(locale), fSkeleton(skeleton) {}
+
+    SkeletonFormatterCacheKey(const SkeletonFormatterCacheKey& other)
+            : LocaleCacheKey<SkeletonFormatterCacheData>(other), fSkeleton(other.fSkeleton) {}
+
+    virtual ~SkeletonFormatterCacheKey();
+
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)LocaleCacheKey<SkeletonFormatterCacheData>::hashCode() +
+                         (uint32_t)fSkeleton.hashCode());
+    }
+
+    virtual UBool operator==(const CacheKeyBase& other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey<SkeletonFormatterCacheData>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        return static_cast<const SkeletonFormatterCacheKey&>(other).fSkeleton == fSkeleton;
+    }
+
+    virtual CacheKeyBase* clone() const {
+        return new SkeletonFormatterCacheKey(*this);
+    }
+
+    virtual const SkeletonFormatterCacheData* createObject(const void* /*unused*/,
+                                                           UErrorCode& status) const {
+        LocalPointer<SkeletonFormatterCacheData> data(
+                new SkeletonFormatterCacheData(fSkeleton, fLoc, status), status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        SkeletonFormatterCacheData* result = data.orphan();
+        result->addRef();
+        return result;
+    }
+
+  private:
+    UnicodeString fSkeleton;
+};
+
+SkeletonFormatterCacheKey::~SkeletonFormatterCacheKey() = default;
+
+} // namespace impl
+} // namespace number
+
+template<> U_I18N_API
+const number::impl::SkeletonFormatterCacheData*
+LocaleCacheKey<number::impl::SkeletonFormatterCacheData>::createObject(
+        const void* /*creationContext*/, UErrorCode& status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return nullptr;
+}
+
+U_NAMESPACE_END
+
+LocalizedNumberFormatter
+NumberFormatter::forSkeleton(const UnicodeString& skeleton, const Locale& locale, UErrorCode& status) {
+    if (U_FAILURE(status)) {
+        return {};
+    }
+    const UnifiedCache* cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return {};
+    }
+    const SkeletonFormatterCacheData* data = nullptr;
+    cache->get(SkeletonFormatterCacheKey(locale, skeleton), data, status);
+    if (U_FAILURE(status)) {
+        return {};
+    }
+    LocalizedNumberFormatter result = data->createFormatter();
+    data->removeRef();
+    return result;
+}
+
 #if (U_PF_WINDOWS <= U_PLATFORM && U_PLATFORM <= U_PF_CYGWIN) && defined(_MSC_VER)
 // Warning 4661.
 #pragma warning(pop)
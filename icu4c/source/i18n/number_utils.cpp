@@ -190,6 +190,27 @@ void DecNum::_setTo(const char* str, int32_t maxDigits, UErrorCode& status) {
 
 void
 DecNum::setTo(const uint8_t* bcd, int32_t length, int32_t scale, bool isNegative, UErrorCode& status) {
+    if (!setHeader(length, scale, isNegative, status)) {
+        return;
+    }
+    uprv_decNumberSetBCD(fData, bcd, static_cast<uint32_t>(length));
+    if (fContext.status != 0) {
+        // Some error occurred while constructing the decNumber.
+        status = U_INTERNAL_PROGRAM_ERROR;
+    }
+}
+
+void
+DecNum::setToUnits(const int8_t* units, int32_t length, int32_t scale, bool isNegative, UErrorCode& status) {
+    // With one digit per unit, the units are the digits, least significant first.
+    static_assert(DECDPUN == 1, "DecNum::setToUnits() requires one digit per decNumber unit");
+    if (!setHeader(length, scale, isNegative, status)) {
+        return;
+    }
+    uprv_memcpy(fData.getAlias()->lsu, units, length);
+}
+
+bool DecNum::setHeader(int32_t length, int32_t scale, bool isNegative, UErrorCode& status) {
     if (length > kDefaultDigits) {
         fData.resize(length, 0);
         fContext.digits = length;
@@ -201,7 +222,7 @@ DecNum::setTo(const uint8_t* bcd, int32_t length, int32_t scale, bool isNegative
     if (length < 1 || length > 999999999) {
         // Too large for decNumber
         status = U_UNSUPPORTED_ERROR;
-        return;
+        return false;
     }
     // "The exponent field holds the exponent of the number. Its range is limited by the requirement that
     // "the range of the adjusted exponent of the number be balanced and fit within a whole number of
@@ -211,17 +232,13 @@ DecNum::setTo(const uint8_t* bcd, int32_t length, int32_t scale, bool isNegative
     if (scale > 999999999 - length + 1 || scale < -999999999 - length + 1) {
         // Too large for decNumber
         status = U_UNSUPPORTED_ERROR;
-        return;
+        return false;
     }
 
     fData.getAlias()->digits = length;
     fData.getAlias()->exponent = scale;
     fData.getAlias()->bits = static_cast<uint8_t>(isNegative ? DECNEG : 0);
-    uprv_decNumberSetBCD(fData, bcd, static_cast<uint32_t>(length));
-    if (fContext.status != 0) {
-        // Some error occurred while constructing the decNumber.
-        status = U_INTERNAL_PROGRAM_ERROR;
-    }
+    return true;
 }
 
 void DecNum::normalize() {
@@ -222,6 +222,44 @@ void NumberParserImpl::addMatcher(NumberParseMatcher& matcher) {
 
 void NumberParserImpl::freeze() {
     fFrozen = true;
+
+    // Run the smoke tests once for each Latin-1 lead character, which covers the digits, signs and
+    // separators of most input.
+    if (fNumMatchers > 64) {
+        return;
+    }
+    UnicodeString lead;
+    for (UChar32 c = 0; c < UPRV_LENGTHOF(fLatin1Candidates); c++) {
+        lead.setTo(static_cast<char16_t>(c));
+        StringSegment segment(lead, 0 != (fParseFlags & PARSE_FLAG_IGNORE_CASE));
+        uint64_t candidates = 0;
+        for (int32_t i = 0; i < fNumMatchers; i++) {
+            if (fMatchers[i]->smokeTest(segment)) {
+                candidates |= static_cast<uint64_t>(1) << i;
+            }
+        }
+        fLatin1Candidates[c] = candidates;
+    }
+    fHasLatin1Candidates = true;
+}
+
+int32_t NumberParserImpl::nextCandidate(const StringSegment& segment, int32_t i) const {
+    char16_t lead = segment.charAt(0);
+    if (fHasLatin1Candidates && lead < UPRV_LENGTHOF(fLatin1Candidates)) {
+        if (i >= fNumMatchers) {
+            return fNumMatchers;
+        }
+        uint64_t candidates = fLatin1Candidates[lead] >> i;
+        if (candidates == 0) {
+            return fNumMatchers;
+        }
+        for (; (candidates & 1) == 0; candidates >>= 1) {
+            i++;
+        }
+        return i;
+    }
+    for (; i < fNumMatchers && !fMatchers[i]->smokeTest(segment); i++) {}
+    return i;
 }
 
 parse_flags_t NumberParserImpl::getParseFlags() const {
@@ -265,12 +303,12 @@ void NumberParserImpl::parseGreedy(StringSegment& segment, ParsedNumber& result,
         if (segment.length() == 0) {
             return;
         }
-        const NumberParseMatcher* matcher = fMatchers[i];
-        if (!matcher->smokeTest(segment)) {
-            // Matcher failed smoke test: try the next one
-            i++;
-            continue;
+        // Skip the matchers that fail the smoke test
+        i = nextCandidate(segment, i);
+        if (i == fNumMatchers) {
+            break;
         }
+        const NumberParseMatcher* matcher = fMatchers[i];
         int32_t initialOffset = segment.getOffset();
         matcher->match(segment, result, status);
         if (U_FAILURE(status)) {
@@ -309,11 +347,8 @@ void NumberParserImpl::parseLongestRecursive(StringSegment& segment, ParsedNumbe
     ParsedNumber candidate;
 
     int initialOffset = segment.getOffset();
-    for (int32_t i = 0; i < fNumMatchers; i++) {
+    for (int32_t i = nextCandidate(segment, 0); i < fNumMatchers; i = nextCandidate(segment, i + 1)) {
         const NumberParseMatcher* matcher = fMatchers[i];
-        if (!matcher->smokeTest(segment)) {
-            continue;
-        }
 
         // In a non-greedy parse, we attempt all possible matches and pick the best.
         for (int32_t charsToConsume = 0; charsToConsume < segment.length();) {
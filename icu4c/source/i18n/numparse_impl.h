@@ -69,6 +69,12 @@ class U_I18N_API NumberParserImpl : public MutableMatcherCollection, public UMem
     MaybeStackArray<const NumberParseMatcher*, 10> fMatchers;
     bool fFrozen = false;
 
+    // The smoke tests of the matchers only look at the first code point of the segment. For each
+    // Latin-1 lead character, freeze() records the matchers that pass as bits: bit i for fMatchers[i].
+    // Only filled in if there are at most 64 matchers.
+    uint64_t fLatin1Candidates[0x100];
+    bool fHasLatin1Candidates = false;
+
     // WARNING: All of these matchers start in an undefined state (default-constructed).
     // You must use an assignment operator on them before using.
     struct {
@@ -96,6 +102,9 @@ class U_I18N_API NumberParserImpl : public MutableMatcherCollection, public UMem
 
     explicit NumberParserImpl(parse_flags_t parseFlags);
 
+    /** Returns the index of the first matcher starting at i that passes its smoke test, or fNumMatchers. */
+    int32_t nextCandidate(const StringSegment& segment, int32_t i) const;
+
     void parseGreedy(StringSegment& segment, ParsedNumber& result, UErrorCode& status) const;
 
     void parseLongestRecursive(
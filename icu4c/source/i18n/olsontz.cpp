@@ -79,8 +79,60 @@ U_NAMESPACE_BEGIN
 
 #define SECONDS_PER_DAY (24*60*60)
 
+// Number of years after finalStartYear for which the UTC offset index
+// precomputes the finalZone transitions.  Later dates are computed by
+// finalZone on each call.
+#ifndef OLSONTZ_OFFSET_INDEX_YEARS
+#define OLSONTZ_OFFSET_INDEX_YEARS 100
+#endif
+
+// Number of UTC offset lookups on one instance before the index is built,
+// so that zones used only a few times do not pay for it.
+#define OFFSET_INDEX_MIN_LOOKUPS 64
+
+// Width of one bucket of the UTC offset index, and the maximum number of
+// buckets.  Zones whose indexed range is longer than that are not indexed.
+#define OFFSET_INDEX_BUCKET_MILLIS (365.0 * U_MILLIS_PER_DAY)
+#define OFFSET_INDEX_MAX_BUCKETS 1000
+
 static const int32_t ZEROS[] = {0,0};
 
+/*
+ * UTC offset lookup index.  It holds the sorted list of offset changes in
+ * [startMillis, limitMillis): the historic transitions before
+ * finalStartMillis, then the finalZone offset at finalStartMillis and the
+ * finalZone transitions up to OLSONTZ_OFFSET_INDEX_YEARS later.
+ * bucketChanges[b] is the last change at or before the start of bucket b,
+ * so a lookup only steps over the few changes within one bucket.
+ */
+struct OlsonTimeZone::OffsetIndex : public UMemory {
+    struct Change {
+        UDate time;
+        int32_t rawOffset;
+        int32_t dstOffset;
+    };
+
+    UDate startMillis;
+    UDate limitMillis;
+    int32_t changeCount;
+    LocalMemory<Change> changes;
+    LocalMemory<int32_t> bucketChanges;
+
+    UBool getOffset(UDate date, int32_t& rawoff, int32_t& dstoff) const {
+        // The negated range check also rejects NaN.
+        if (!(date >= startMillis && date < limitMillis)) {
+            return FALSE;
+        }
+        int32_t changeIdx = bucketChanges[(int32_t)((date - startMillis) / OFFSET_INDEX_BUCKET_MILLIS)];
+        while (changeIdx + 1 < changeCount && date >= changes[changeIdx + 1].time) {
+            changeIdx++;
+        }
+        rawoff = changes[changeIdx].rawOffset;
+        dstoff = changes[changeIdx].dstOffset;
+        return TRUE;
+    }
+};
+
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(OlsonTimeZone)
 
 /**
@@ -294,6 +346,11 @@ OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
 
     clearTransitionRules();
 
+    delete offsetIndex;
+    offsetIndex = NULL;
+    offsetIndexInitOnce.reset();
+    offsetLookupCount = 0;
+
     return *this;
 }
 
@@ -302,6 +359,7 @@ OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
  */
 OlsonTimeZone::~OlsonTimeZone() {
     deleteTransitionRules();
+    delete offsetIndex;
     delete finalZone;
 }
 
@@ -390,6 +448,12 @@ void OlsonTimeZone::getOffset(UDate date, UBool local, int32_t& rawoff,
     if (U_FAILURE(ec)) {
         return;
     }
+    if (!local) {
+        const OffsetIndex *index = getOffsetIndex();
+        if (index != NULL && index->getOffset(date, rawoff, dstoff)) {
+            return;
+        }
+    }
     if (finalZone != NULL && date >= finalStartMillis) {
         finalZone->getOffset(date, local, rawoff, dstoff, ec);
     } else {
@@ -598,7 +662,7 @@ OlsonTimeZone::getDSTSavings() const{
  * TimeZone API.
  */
 UBool OlsonTimeZone::inDaylightTime(UDate date, UErrorCode& ec) const {
-    int32_t raw, dst;
+    int32_t raw = 0, dst = 0;
     getOffset(date, FALSE, raw, dst, ec);
     return dst != 0;
 }
@@ -874,6 +938,116 @@ OlsonTimeZone::initTransitionRules(UErrorCode& status) {
     }
 }
 
+/*
+ * Lazy UTC offset index initializer
+ */
+
+static void U_CALLCONV initOffsetIndexOnce(OlsonTimeZone *This, UErrorCode &status) {
+    This->initOffsetIndex(status);
+}
+
+const OlsonTimeZone::OffsetIndex *
+OlsonTimeZone::getOffsetIndex() const {
+    OlsonTimeZone *ncThis = const_cast<OlsonTimeZone *>(this);
+    if (ncThis->offsetIndexInitOnce.isReset()
+            && umtx_atomic_inc(&ncThis->offsetLookupCount) < OFFSET_INDEX_MIN_LOOKUPS) {
+        return NULL;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    umtx_initOnce(ncThis->offsetIndexInitOnce, &initOffsetIndexOnce, ncThis, status);
+    return U_SUCCESS(status) ? offsetIndex : NULL;
+}
+
+void
+OlsonTimeZone::initOffsetIndex(UErrorCode& status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int16_t historicCount = transitionCount();
+    if (finalZone != NULL) {
+        // Transitions at or after finalStartMillis are superseded by finalZone
+        while (historicCount > 0 && transitionTime(historicCount - 1) >= finalStartMillis) {
+            historicCount--;
+        }
+    }
+
+    UDate startMillis, limitMillis;
+    int32_t maxChangeCount = historicCount;
+    if (finalZone != NULL) {
+        startMillis = historicCount > 0 ? transitionTime(0) : finalStartMillis;
+        limitMillis = Grego::fieldsToDay(finalStartYear + OLSONTZ_OFFSET_INDEX_YEARS, 0, 1) * U_MILLIS_PER_DAY;
+        // The offset at finalStartMillis, plus at most two transitions per year
+        maxChangeCount += 1 + 2 * (OLSONTZ_OFFSET_INDEX_YEARS + 1);
+    } else if (historicCount > 1) {
+        // The offsets after the last transition never change, and
+        // getHistoricalOffset finds that transition first anyway.
+        startMillis = transitionTime(0);
+        limitMillis = transitionTime(historicCount - 1);
+    } else {
+        return;
+    }
+    if (!(startMillis < limitMillis)
+            || (limitMillis - startMillis) / OFFSET_INDEX_BUCKET_MILLIS >= OFFSET_INDEX_MAX_BUCKETS) {
+        return;
+    }
+    int32_t bucketCount = (int32_t)((limitMillis - startMillis) / OFFSET_INDEX_BUCKET_MILLIS) + 1;
+
+    LocalPointer<OffsetIndex> index(new OffsetIndex(), status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (index->changes.allocateInsteadAndReset(maxChangeCount) == NULL
+            || index->bucketChanges.allocateInsteadAndReset(bucketCount) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    index->startMillis = startMillis;
+    index->limitMillis = limitMillis;
+
+    OffsetIndex::Change *changes = index->changes.getAlias();
+    int32_t changeCount = 0;
+    for (int16_t transIdx = 0; transIdx < historicCount; transIdx++) {
+        changes[changeCount].time = transitionTime(transIdx);
+        changes[changeCount].rawOffset = rawOffsetAt(transIdx) * U_MILLIS_PER_SECOND;
+        changes[changeCount].dstOffset = dstOffsetAt(transIdx) * U_MILLIS_PER_SECOND;
+        changeCount++;
+    }
+    if (finalZone != NULL) {
+        // Take the offsets from finalZone->getOffset() itself, so that the
+        // index agrees with the non-indexed path.
+        UDate time = finalStartMillis;
+        TimeZoneTransition tzt;
+        while (TRUE) {
+            changes[changeCount].time = time;
+            finalZone->getOffset(time, FALSE,
+                changes[changeCount].rawOffset, changes[changeCount].dstOffset, status);
+            changeCount++;
+            if (changeCount == maxChangeCount
+                    || !finalZone->getNextTransition(time, FALSE, tzt)
+                    || tzt.getTime() >= limitMillis) {
+                break;
+            }
+            time = tzt.getTime();
+        }
+        if (U_FAILURE(status)) {
+            return;
+        }
+    }
+    index->changeCount = changeCount;
+
+    int32_t *bucketChanges = index->bucketChanges.getAlias();
+    int32_t changeIdx = 0;
+    for (int32_t bucket = 0; bucket < bucketCount; bucket++) {
+        UDate bucketStart = startMillis + bucket * OFFSET_INDEX_BUCKET_MILLIS;
+        while (changeIdx + 1 < changeCount && changes[changeIdx + 1].time <= bucketStart) {
+            changeIdx++;
+        }
+        bucketChanges[bucket] = changeIdx;
+    }
+
+    offsetIndex = index.orphan();
+}
+
 UBool
 OlsonTimeZone::getNextTransition(UDate base, UBool inclusive, TimeZoneTransition& result) const {
     UErrorCode status = U_ZERO_ERROR;
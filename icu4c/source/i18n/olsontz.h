@@ -399,6 +399,23 @@ class U_I18N_API OlsonTimeZone: public BasicTimeZone {
     int16_t             historicRuleCount;
     SimpleTimeZone      *finalZoneWithStartYear; // hack
     UInitOnce           transitionRulesInitOnce = U_INITONCE_INITIALIZER;
+
+    /* UTC offset lookup index support */
+    struct OffsetIndex;
+    const OffsetIndex *getOffsetIndex() const;
+
+  public:    // Internal, for access from plain C code
+    void initOffsetIndex(UErrorCode& status);
+  private:
+
+    /**
+     * Year-bucketed table of UTC offsets, built lazily once this zone
+     * has answered enough UTC lookups.  NULL until then, or if the zone's
+     * transitions span too many years to index.
+     */
+    OffsetIndex         *offsetIndex = NULL;
+    UInitOnce           offsetIndexInitOnce = U_INITONCE_INITIALIZER;
+    u_atomic_int32_t    offsetLookupCount = ATOMIC_INT32_T_INITIALIZER(0);
 };
 
 inline int16_t
@@ -39,6 +39,7 @@
 #include "regexcst.h"   // Contains state table for the regex pattern parser.
                         //   generated by a Perl script.
 #include "regexcmp.h"
+#include "regexdfa.h"
 #include "regexst.h"
 #include "regextxt.h"
 
@@ -316,6 +317,11 @@ void    RegexCompile::compile(
     //
     matchStartType();
 
+    //
+    // Optimization pass 3: literal string that must appear in any match
+    //
+    requiredString();
+
     //
     // Set up fast latin-1 range sets
     //
@@ -332,6 +338,10 @@ void    RegexCompile::compile(
         fRXPat->fSets8[i].init(s);
     }
 
+    //
+    // DFA for matching without backtracking, for patterns simple enough to have one.
+    //
+    fRXPat->fDFA = RegexDFA::createInstance(*fRXPat, *fStatus);
 }
 
 
@@ -3187,6 +3197,136 @@ void   RegexCompile::matchStartType() {
 }
 
 
+//------------------------------------------------------------------------------
+//
+//   requiredString    Find the longest literal string that must appear somewhere
+//                     in any match. Used by find() to skip input that can not
+//                     contain a match.
+//
+//                     A literal op is required if every path through the compiled
+//                     pattern passes through it. Paths move forward only by falling
+//                     through to the next op or by jumping, so an op is required
+//                     if no forward jump passes over it.
+//
+//                     Patterns with look-around are skipped; literals inside a
+//                     look-around block need not be part of the match.
+//
+//                     Also find bounds on the string's distance from the start of
+//                     the match, from the lengths that the ops before it can match.
+//                     find() uses them to skip start positions that are too far
+//                     before an occurrence of the string.
+//
+//------------------------------------------------------------------------------
+void   RegexCompile::requiredString() {
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
+    if (fRXPat->fStartType == START_STRING) {
+        // find() already searches for the string that begins every match.
+        return;
+    }
+
+    int32_t patSize = fRXPat->fCompiledPat->size();
+    UVector32 jumpedOver(*fStatus);        // Per op, number of forward jumps passing over it,
+    jumpedOver.setSize(patSize + 1);       //    as +1 at the op after the jump, -1 at its target.
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
+    for (int32_t i = 0; i <= patSize; i++) {
+        jumpedOver.setElementAt(0, i);
+    }
+
+    int32_t loc;
+    for (loc = 0; loc < patSize; loc++) {
+        int32_t op = (int32_t)fRXPat->fCompiledPat->elementAti(loc);
+        int32_t opType = URX_TYPE(op);
+        int32_t dest = -1;
+        switch (opType) {
+        case URX_STATE_SAVE:
+        case URX_JMP:
+        case URX_JMP_SAV:
+        case URX_JMP_SAV_X:
+        case URX_JMPX:
+            dest = URX_VAL(op);
+            break;
+
+        case URX_CTR_INIT:
+        case URX_CTR_INIT_NG:
+            {
+                // A loop with a minimum count of zero can be skipped entirely.
+                int32_t loopEndLoc = URX_VAL(fRXPat->fCompiledPat->elementAti(loc+1));
+                if (fRXPat->fCompiledPat->elementAti(loc+2) == 0) {
+                    dest = loopEndLoc + 1;
+                }
+            }
+            break;
+
+        case URX_LA_START:
+        case URX_LB_START:
+            return;
+
+        default:
+            break;
+        }
+        if (dest > loc + 1) {
+            jumpedOver.setElementAt(jumpedOver.elementAti(loc+1) + 1, loc+1);
+            jumpedOver.setElementAt(jumpedOver.elementAti(dest) - 1, dest);
+        }
+    }
+
+    int32_t   bestLoc = -1;
+    int32_t   bestIdx = -1;
+    int32_t   bestLen = 0;
+    UChar32   bestChar = 0;
+    int32_t   jumps = 0;
+    for (loc = 0; loc < patSize; loc++) {
+        jumps += jumpedOver.elementAti(loc);
+        int32_t op = (int32_t)fRXPat->fCompiledPat->elementAti(loc);
+        int32_t opType = URX_TYPE(op);
+        if (jumps != 0) {
+            continue;
+        }
+        if (opType == URX_STRING) {
+            int32_t stringLen = URX_VAL(fRXPat->fCompiledPat->elementAti(loc+1));
+            if (stringLen > bestLen) {
+                bestLoc = loc;
+                bestIdx = URX_VAL(op);
+                bestLen = stringLen;
+            }
+        } else if (opType == URX_ONECHAR) {
+            UChar32 c = URX_VAL(op);
+            if (U16_LENGTH(c) > bestLen) {
+                bestLoc  = loc;
+                bestIdx  = -1;
+                bestLen  = U16_LENGTH(c);
+                bestChar = c;
+            }
+        }
+    }
+
+    if (bestLen == 0) {
+        return;
+    }
+    if (bestIdx < 0) {
+        // A single character. Make it available as literal text.
+        bestIdx = fRXPat->fLiteralText.length();
+        fRXPat->fLiteralText.append(bestChar);
+    }
+    fRXPat->fRequiredStringIdx = bestIdx;
+    fRXPat->fRequiredStringLen = bestLen;
+
+    // The pattern's ops begin at location 3. The maximum is measured through the
+    //   string op itself, so that it includes forward jumps that land on it, and then
+    //   the string's own length is taken back off.
+    fRXPat->fRequiredStringMinOffset = bestLoc > 3 ? minMatchLength(3, bestLoc-1) : 0;
+    int32_t maxOffset = maxMatchLength(3, bestLoc);
+    if (maxOffset != INT32_MAX) {
+        maxOffset -= maxMatchLength(bestLoc, bestLoc);
+    }
+    fRXPat->fRequiredStringMaxOffset = maxOffset;
+}
+
+
 
 //------------------------------------------------------------------------------
 //
@@ -0,0 +1,1652 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  regexdfa.cpp
+//
+//  This file contains the classes RegexDFA and RegexDFACache.
+//
+//  These classes are internal to the regular expression implementation.
+//  For the public Regular Expression API, see the file "unicode/regex.h"
+//
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/regex.h"
+#include "unicode/uchar.h"
+#include "unicode/uniset.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "uarrsort.h"
+#include "uassert.h"
+#include "ucase.h"
+#include "uvectr64.h"
+#include "regeximp.h"
+#include "regexst.h"
+#include "regextxt.h"
+#include "regexdfa.h"
+
+U_NAMESPACE_BEGIN
+
+// Limits on the size of an NFA. Counted loops are unrolled, one copy of the
+//   loop body for each iteration, unless that would take more than
+//   MAX_UNROLLED_OPS pattern operations.
+static const int32_t MAX_NODES        = 0x8000;
+static const int32_t MAX_UNROLLED_OPS = 2000;
+
+// The most input positions that RegexDFACache::searchTail() looks at: those
+//   before a final CR/LF, and the end.
+static const int32_t MAX_TAIL_POSITIONS = 4;
+
+// Test for any of the Unicode line terminating characters, as in rematch.cpp.
+static inline UBool isLineTerminator(UChar32 c) {
+    return (c<=0x0d && c>=0x0a) || c==0x85 || c==0x2028 || c==0x2029;
+}
+
+//------------------------------------------------------------------------------
+//
+//   RegexDFA
+//
+//------------------------------------------------------------------------------
+RegexDFA::RegexDFA(UErrorCode &status) :
+        fNodes(status), fSets(uprv_deleteUObject, NULL, status), fPatternStarts(status), fStartNode(0),
+        fUnsupported(FALSE), fDecidesMatches(FALSE), fHasAssertions(FALSE),
+        fContextNeeds(0), fLineEndSet(-1), fCRSet(-1), fLFSet(-1), fWordSet(-1), fExtendSet(-1),
+        fMultiFolds(status), fClassCount(0),
+        fRangeStarts(status), fRangeClasses(status) {
+    uprv_memset(fLatin1Class, 0, sizeof(fLatin1Class));
+}
+
+RegexDFA::~RegexDFA() {
+}
+
+
+RegexDFA *RegexDFA::createInstance(const RegexPattern &pattern, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    LocalPointer<RegexDFA> dfa(new RegexDFA(status), status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    UBool isExact;
+    if (!dfa->addPattern(pattern, 0, isExact, status) || !dfa->finish(status) || U_FAILURE(status)) {
+        return NULL;
+    }
+    dfa->fDecidesMatches = isExact && pattern.fGroupMap->size() == 0;
+    return dfa.orphan();
+}
+
+
+UBool RegexDFA::scanMatchesFind(const RegexPattern &pattern) {
+    return pattern.fStartType != START_LINE;
+}
+
+
+int32_t RegexDFA::addNode(int32_t type, int32_t arg, int32_t next, int32_t alt, UErrorCode &status) {
+    int32_t n = nodeCount();
+    fNodes.addElement(type, status);
+    fNodes.addElement(arg, status);
+    fNodes.addElement(next, status);
+    fNodes.addElement(alt, status);
+    return n;
+}
+
+void RegexDFA::setNode(int32_t n, int32_t type, int32_t arg, int32_t next, int32_t alt) {
+    fNodes.setElementAt(type, n*4);
+    fNodes.setElementAt(arg,  n*4+1);
+    fNodes.setElementAt(next, n*4+2);
+    fNodes.setElementAt(alt,  n*4+3);
+}
+
+
+//
+//  addSet    Adopt a set, returning its index.
+//            Sets equal to one already present are merged.
+//
+int32_t RegexDFA::addSet(UnicodeSet *adoptSet, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        delete adoptSet;
+        return 0;
+    }
+    if (adoptSet == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    for (int32_t i = 0; i < fSets.size(); i++) {
+        if (*(UnicodeSet *)fSets.elementAt(i) == *adoptSet) {
+            delete adoptSet;
+            return i;
+        }
+    }
+    fSets.addElement(adoptSet, status);
+    if (U_FAILURE(status)) {
+        delete adoptSet;
+        return 0;
+    }
+    return fSets.size() - 1;
+}
+
+int32_t RegexDFA::addCharSet(UChar32 c, UErrorCode &status) {
+    return addSet(new UnicodeSet(c, c), status);
+}
+
+
+//
+//  addAssertion    Add an NFA_ASSERT node, and the character sets that its
+//                  context depends on.
+//
+int32_t RegexDFA::addAssertion(int32_t assertion, int32_t next, UErrorCode &status) {
+    UBool needLineEnds = FALSE;
+    UBool needCR       = FALSE;
+    UBool needLF       = FALSE;
+    UBool needWord     = FALSE;
+    if (assertion != ASSERT_NEXT_LF && assertion != ASSERT_NEXT_NOT_LF) {
+        fHasAssertions = TRUE;
+    }
+    switch (assertion) {
+    case ASSERT_CARET:
+        fContextNeeds |= CONTEXT_START;
+        break;
+    case ASSERT_CARET_M:
+        fContextNeeds |= CONTEXT_START | CONTEXT_PREV_LT;
+        needLineEnds = TRUE;
+        break;
+    case ASSERT_CARET_M_UNIX:
+        fContextNeeds |= CONTEXT_START | CONTEXT_PREV_LF;
+        needLF = TRUE;
+        break;
+    case ASSERT_DOLLAR:
+        fContextNeeds |= CONTEXT_FINAL_LT;
+        break;
+    case ASSERT_DOLLAR_D:
+        fContextNeeds |= CONTEXT_FINAL_LF;
+        break;
+    case ASSERT_DOLLAR_M:
+        fContextNeeds |= CONTEXT_START | CONTEXT_PREV_CR;
+        needLineEnds = needCR = needLF = TRUE;
+        break;
+    case ASSERT_DOLLAR_MD:
+    case ASSERT_NEXT_LF:
+    case ASSERT_NEXT_NOT_LF:
+        needLF = TRUE;
+        break;
+    case ASSERT_WORD_BOUNDARY:
+    case ASSERT_NOT_WORD_BOUNDARY:
+        fContextNeeds |= CONTEXT_PREV_WORD;
+        needWord = TRUE;
+        break;
+    default:
+        break;
+    }
+
+    if (needLineEnds && fLineEndSet < 0) {
+        UnicodeSet *set = new UnicodeSet(0x0a, 0x0d);
+        if (set != NULL) {
+            set->add(0x85).add(0x2028, 0x2029);
+        }
+        fLineEndSet = addSet(set, status);
+    }
+    if (needCR && fCRSet < 0) {
+        fCRSet = addCharSet(0x0d, status);
+    }
+    if (needLF && fLFSet < 0) {
+        fLFSet = addCharSet(0x0a, status);
+    }
+    if (needWord && fWordSet < 0) {
+        fWordSet = addSet(RegexStaticSets::gStaticSets->fPropSets[URX_ISWORD_SET].cloneAsThawed(), status);
+        UnicodeSet *set = new UnicodeSet();
+        if (set != NULL) {
+            UnicodeSet formatChars;
+            set->applyIntPropertyValue(UCHAR_GRAPHEME_EXTEND, 1, status);
+            formatChars.applyIntPropertyValue(UCHAR_GENERAL_CATEGORY_MASK, U_GC_CF_MASK, status);
+            set->addAll(formatChars);
+        }
+        fExtendSet = addSet(set, status);
+    }
+    return addNode(NFA_ASSERT, assertion, next, -1, status);
+}
+
+
+//
+//  addAnyChar    Add nodes for '.' in dot-matches-all mode, which consumes any
+//                character, except that a CR is consumed together with a LF that follows.
+//
+int32_t RegexDFA::addAnyChar(int32_t next, UErrorCode &status) {
+    int32_t lfNode    = addNode(NFA_CONSUME, addCharSet(0x0a, status), next, -1, status);
+    int32_t crLFNode  = addAssertion(ASSERT_NEXT_LF, lfNode, status);
+    int32_t crOnlyNode = addAssertion(ASSERT_NEXT_NOT_LF, next, status);
+    int32_t crNode    = addNode(NFA_CONSUME, addCharSet(0x0d, status),
+                                addNode(NFA_SPLIT, 0, crLFNode, crOnlyNode, status), -1, status);
+    UnicodeSet *set = new UnicodeSet(0, 0x10ffff);
+    if (set != NULL) {
+        set->remove(0x0d);
+    }
+    int32_t otherNode = addNode(NFA_CONSUME, addSet(set, status), next, -1, status);
+    return addNode(NFA_SPLIT, 0, otherNode, crNode, status);
+}
+
+
+//
+//  addFoldedString    Add nodes for a case-insensitive string, as matched by the engine's
+//                     URX_STRING_I: the full case foldings of the input characters,
+//                     one after another, must be exactly the case folded string s.
+//                     Returns the first node.
+//
+int32_t RegexDFA::addFoldedString(const UChar *s, int32_t length, int32_t next, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return next;
+    }
+    UVector32 chars(status);
+    for (int32_t i = 0; i < length;) {
+        UChar32 c;
+        U16_NEXT(s, i, length, c);
+        chars.addElement(c, status);
+    }
+
+    // The characters with a full case folding of more than one code point are
+    //   the only ones that can match more than one character of the string.
+    //   Changes_When_Casefolded is defined on the NFD form, and so misses
+    //   precomposed characters like U+1FE7, which do change when case mapped.
+    if (fMultiFolds.size() == 0) {
+        UnicodeSet changes;
+        changes.applyIntPropertyValue(UCHAR_CHANGES_WHEN_CASEFOLDED, 1, status);
+        UnicodeSet mapped;
+        mapped.applyIntPropertyValue(UCHAR_CHANGES_WHEN_CASEMAPPED, 1, status);
+        changes.addAll(mapped);
+        for (int32_t r = 0; r < changes.getRangeCount(); r++) {
+            for (UChar32 c = changes.getRangeStart(r); c <= changes.getRangeEnd(r); c++) {
+                const UChar *folding;
+                int32_t foldLength = ucase_toFullFolding(c, &folding, U_FOLD_CASE_DEFAULT);
+                if (foldLength >= 0 && foldLength < UCASE_MAX_STRING_LENGTH) {
+                    fMultiFolds.addElement(c, status);
+                }
+            }
+        }
+    }
+
+    // charNodes[i] matches the string from its i'th code point.
+    int32_t count = chars.size();
+    UVector32 charNodes(status);
+    charNodes.setSize(count + 1);
+    charNodes.setElementAt(next, count);
+    for (int32_t i = count - 1; i >= 0 && U_SUCCESS(status); i--) {
+        UChar32 patternChar = chars.elementAti(i);
+
+        // The characters whose full folding is this code point.
+        UnicodeSet closure(patternChar, patternChar);
+        closure.closeOver(USET_CASE_INSENSITIVE);
+        UnicodeSet *set = new UnicodeSet();
+        if (set == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return next;
+        }
+        for (int32_t r = 0; r < closure.getRangeCount(); r++) {
+            for (UChar32 c = closure.getRangeStart(r); c <= closure.getRangeEnd(r); c++) {
+                const UChar *folding;
+                int32_t folded = ucase_toFullFolding(c, &folding, U_FOLD_CASE_DEFAULT);
+                if (folded < 0) {
+                    folded = ~folded;
+                } else if (folded < UCASE_MAX_STRING_LENGTH) {
+                    continue;
+                }
+                if (folded == patternChar) {
+                    set->add(c);
+                }
+            }
+        }
+        int32_t node = addNode(NFA_CONSUME, addSet(set, status), charNodes.elementAti(i + 1), -1, status);
+
+        // The characters whose folding is a string that occurs here.
+        for (int32_t m = 0; m < fMultiFolds.size(); m++) {
+            UChar32 c = fMultiFolds.elementAti(m);
+            const UChar *folding;
+            int32_t foldLength = ucase_toFullFolding(c, &folding, U_FOLD_CASE_DEFAULT);
+            int32_t end = i;
+            int32_t f = 0;
+            while (f < foldLength && end < count) {
+                UChar32 foldChar;
+                int32_t foldStart = f;
+                U16_NEXT(folding, f, foldLength, foldChar);
+                if (foldChar != chars.elementAti(end)) {
+                    f = foldStart;
+                    break;
+                }
+                end++;
+            }
+            if (f == foldLength && end > i) {
+                int32_t multiNode = addNode(NFA_CONSUME, addCharSet(c, status), charNodes.elementAti(end), -1, status);
+                node = addNode(NFA_SPLIT, 0, node, multiNode, status);
+            }
+        }
+        charNodes.setElementAt(node, i);
+    }
+    return charNodes.elementAti(0);
+}
+
+
+//
+//  canSkip    True if the node to can be reached from the node from without
+//             consuming any input.
+//
+UBool RegexDFA::canSkip(int32_t from, int32_t to) {
+    UErrorCode status = U_ZERO_ERROR;
+    UVector32 stack(status);
+    LocalMemory<uint8_t> reached;
+    if (reached.allocateInsteadAndReset(nodeCount()) == NULL) {
+        return TRUE;
+    }
+    stack.push(from, status);
+    while (!stack.empty() && U_SUCCESS(status)) {
+        int32_t n = stack.popi();
+        if (n == to) {
+            return TRUE;
+        }
+        if (n < 0 || reached[n]) {
+            continue;
+        }
+        reached[n] = 1;
+        int32_t type = nodeType(n);
+        if (type == NFA_SPLIT || type == NFA_ASSERT) {
+            stack.push(nodeNext(n), status);
+            stack.push(nodeAlt(n), status);
+        }
+    }
+    return U_FAILURE(status);
+}
+
+
+//
+//  nodeFor    The node for the op at pc of a range. A jump to the end of the range goes
+//             to its exit. Anything else outside of it can not be translated.
+//
+int32_t RegexDFA::nodeFor(const Range &range, int32_t pc) {
+    if (pc == range.fLimit) {
+        return range.fExit;
+    }
+    if (pc < range.fStart || pc > range.fLimit) {
+        fUnsupported = TRUE;
+        return -1;
+    }
+    return range.fBase + pc;
+}
+
+
+//
+//  addCountedLoop    Add the nodes for the counted loop x{min,max} whose URX_CTR_INIT or
+//                    URX_CTR_INIT_NG is at pc. Returns the first node.
+//                    The loop body is copied for each iteration. A loop without a maximum
+//                    ends with a loop back over a last copy.
+//
+int32_t RegexDFA::addCountedLoop(const RegexPattern &pattern, int32_t pc, int32_t exit,
+                                 int32_t patternIndex, UBool &isExact, UErrorCode &status) {
+    const UVector64 &pat = *pattern.fCompiledPat;
+    UBool   greedy   = URX_TYPE(pat.elementAti(pc)) == URX_CTR_INIT;
+    int32_t loopLoc  = URX_VAL(pat.elementAti(pc+1));
+    int32_t minCount = (int32_t)pat.elementAti(pc+2);
+    int32_t maxCount = (int32_t)pat.elementAti(pc+3);
+    int32_t bodyStart = pc + 4;
+
+    int64_t copies = maxCount == -1 ? (int64_t)minCount + 1 : maxCount;
+    if (copies * (loopLoc - bodyStart) > MAX_UNROLLED_OPS) {
+        // Too big to unroll.
+        fUnsupported = TRUE;
+        return exit;
+    }
+
+    int32_t entry = exit;
+    if (maxCount == -1) {
+        int32_t loop = addNode(NFA_SPLIT, 0, -1, -1, status);
+        int32_t body = translate(pattern, bodyStart, loopLoc, loop, patternIndex, isExact, status);
+        if (greedy) {
+            setNode(loop, NFA_SPLIT, 0, body, exit);
+        } else {
+            setNode(loop, NFA_SPLIT, 0, exit, body);
+        }
+        if (canSkip(body, loop)) {
+            // The engine stops an unbounded loop after an iteration that consumes nothing.
+            //   The NFA does not, but that can only change which match is preferred.
+            isExact = FALSE;
+        }
+        entry = loop;
+    } else {
+        for (int32_t i = minCount; i < maxCount && !fUnsupported && U_SUCCESS(status); i++) {
+            int32_t optional = addNode(NFA_SPLIT, 0, -1, -1, status);
+            int32_t body = translate(pattern, bodyStart, loopLoc, entry, patternIndex, isExact, status);
+            if (greedy) {
+                setNode(optional, NFA_SPLIT, 0, body, exit);
+            } else {
+                setNode(optional, NFA_SPLIT, 0, exit, body);
+            }
+            entry = optional;
+        }
+    }
+    for (int32_t i = 0; i < minCount && !fUnsupported && U_SUCCESS(status); i++) {
+        entry = translate(pattern, bodyStart, loopLoc, entry, patternIndex, isExact, status);
+    }
+    return entry;
+}
+
+
+//
+//  addPattern    Translate a compiled pattern into NFA nodes, with its NFA_MATCH
+//                node marked with patternIndex.
+//                Returns FALSE, adding nothing, if the pattern contains an operation
+//                that depends on more than the input position and the characters next to it.
+//                The NFA reaches the same input positions as the pattern. isExact is
+//                set FALSE if it may prefer a different match among them, where the
+//                match engine's choice depends on the progress made by a loop.
+//
+UBool RegexDFA::addPattern(const RegexPattern &pattern, int32_t patternIndex, UBool &isExact,
+                           UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    int32_t nodesBase    = nodeCount();
+    int32_t setsBase     = fSets.size();
+    int32_t contextNeeds = fContextNeeds;
+    UBool   hasAssertions = fHasAssertions;
+    isExact = TRUE;
+    fUnsupported = FALSE;
+
+    int32_t start = translate(pattern, 0, pattern.fCompiledPat->size(), -1, patternIndex, isExact, status);
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    if (fUnsupported || nodeCount() > MAX_NODES) {
+        fNodes.setSize(nodesBase * 4);
+        while (fSets.size() > setsBase) {
+            fSets.removeElementAt(fSets.size() - 1);
+        }
+        fContextNeeds = contextNeeds;
+        fHasAssertions = hasAssertions;
+        int32_t *sets[] = {&fLineEndSet, &fCRSet, &fLFSet, &fWordSet, &fExtendSet};
+        for (int32_t i = 0; i < UPRV_LENGTHOF(sets); i++) {
+            if (*sets[i] >= setsBase) {
+                *sets[i] = -1;
+            }
+        }
+        return FALSE;
+    }
+    fPatternStarts.addElement(start, status);
+    return U_SUCCESS(status);
+}
+
+
+//
+//  translate    Translate the ops at [start, limit) of a compiled pattern into NFA nodes,
+//               with exit as the node that follows. Returns the node for the op at start.
+//               Sets fUnsupported if an op can not be translated.
+//
+int32_t RegexDFA::translate(const RegexPattern &pattern, int32_t start, int32_t limit, int32_t exit,
+                            int32_t patternIndex, UBool &isExact, UErrorCode &status) {
+    if (start >= limit || U_FAILURE(status)) {
+        return exit;
+    }
+    const UVector64 &pat = *pattern.fCompiledPat;
+    const UChar *litText = pattern.fLiteralText.getBuffer();
+    Range range = {start, limit, nodeCount() - start, exit};
+
+    // One node for each op. Operand slots remain NFA_FAIL; they are never a jump target.
+    for (int32_t pc = start; pc < limit; pc++) {
+        addNode(NFA_FAIL, 0, -1, -1, status);
+    }
+    if (nodeCount() > MAX_NODES) {
+        fUnsupported = TRUE;
+    }
+
+    UnicodeSet lineEnds(0x0a, 0x0d);
+    lineEnds.add(0x85).add(0x2028, 0x2029);
+
+    for (int32_t pc = start; pc < limit && U_SUCCESS(status) && !fUnsupported; pc++) {
+        int32_t op      = (int32_t)pat.elementAti(pc);
+        int32_t opType  = URX_TYPE(op);
+        int32_t opValue = URX_VAL(op);
+        int32_t node    = range.fBase + pc;
+        UnicodeSet *set = NULL;
+
+        switch (opType) {
+        case URX_NOP:
+        case URX_START_CAPTURE:
+        case URX_END_CAPTURE:
+        case URX_STO_INP_LOC:
+            setNode(node, NFA_SPLIT, 0, nodeFor(range, pc+1), -1);
+            break;
+
+        case URX_END:
+            setNode(node, NFA_MATCH, patternIndex, -1, -1);
+            break;
+
+        case URX_FAIL:
+        case URX_BACKTRACK:
+            break;
+
+        case URX_ONECHAR:
+            setNode(node, NFA_CONSUME, addCharSet(opValue, status), nodeFor(range, pc+1), -1);
+            break;
+
+        case URX_ONECHAR_I:
+            {
+                // The characters whose simple case folding is the pattern char.
+                UnicodeSet closure(opValue, opValue);
+                closure.closeOver(USET_CASE_INSENSITIVE);
+                set = new UnicodeSet();
+                for (int32_t r = 0; set != NULL && r < closure.getRangeCount(); r++) {
+                    for (UChar32 c = closure.getRangeStart(r); c <= closure.getRangeEnd(r); c++) {
+                        if (u_foldCase(c, U_FOLD_CASE_DEFAULT) == opValue) {
+                            set->add(c);
+                        }
+                    }
+                }
+                setNode(node, NFA_CONSUME, addSet(set, status), nodeFor(range, pc+1), -1);
+            }
+            break;
+
+        case URX_STRING:
+            {
+                // A chain of nodes, one per code point of the string.
+                int32_t stringLen = URX_VAL(pat.elementAti(pc+1));
+                const UChar *s = litText + opValue;
+                int32_t i = 0;
+                int32_t strNode = node;
+                UChar32 c;
+                U16_NEXT(s, i, stringLen, c);
+                while (i < stringLen) {
+                    int32_t nextNode = addNode(NFA_FAIL, 0, -1, -1, status);
+                    setNode(strNode, NFA_CONSUME, addCharSet(c, status), nextNode, -1);
+                    strNode = nextNode;
+                    U16_NEXT(s, i, stringLen, c);
+                }
+                setNode(strNode, NFA_CONSUME, addCharSet(c, status), nodeFor(range, pc+2), -1);
+                pc++;               // Skip the URX_STRING_LEN
+            }
+            break;
+
+        case URX_STRING_I:
+            {
+                int32_t stringLen = URX_VAL(pat.elementAti(pc+1));
+                int32_t stringNode = addFoldedString(litText + opValue, stringLen, nodeFor(range, pc+2), status);
+                setNode(node, NFA_SPLIT, 0, stringNode, -1);
+                pc++;               // Skip the URX_STRING_LEN
+            }
+            break;
+
+        case URX_STATE_SAVE:
+            setNode(node, NFA_SPLIT, 0, nodeFor(range, pc+1), nodeFor(range, opValue));
+            break;
+
+        case URX_JMP:
+            setNode(node, NFA_SPLIT, 0, nodeFor(range, opValue), -1);
+            break;
+
+        case URX_JMP_SAV:
+            setNode(node, NFA_SPLIT, 0, nodeFor(range, opValue), nodeFor(range, pc+1));
+            break;
+
+        case URX_JMP_SAV_X:
+            // The engine only repeats the loop if it made progress. Ignoring that
+            //   admits only zero length iterations, which reach no new input positions,
+            //   but can change which match is preferred.
+            setNode(node, NFA_SPLIT, 0, nodeFor(range, opValue), nodeFor(range, pc+1));
+            isExact = FALSE;
+            break;
+
+        case URX_JMPX:
+            // Conditional on loop progress, as for URX_JMP_SAV_X.
+            setNode(node, NFA_SPLIT, 0, nodeFor(range, opValue), -1);
+            isExact = FALSE;
+            pc++;                   // Skip the data location operand
+            break;
+
+        case URX_SETREF:
+            set = new UnicodeSet(*(const UnicodeSet *)pattern.fSets->elementAt(opValue));
+            setNode(node, NFA_CONSUME, addSet(set, status), nodeFor(range, pc+1), -1);
+            break;
+
+        case URX_STATIC_SETREF:
+        case URX_STAT_SETREF_N:
+            // The static sets are frozen; complement() needs a thawed copy.
+            set = RegexStaticSets::gStaticSets->fPropSets[opValue & ~URX_NEG_SET].cloneAsThawed();
+            if (set != NULL && (opType == URX_STAT_SETREF_N || (opValue & URX_NEG_SET) != 0)) {
+                set->complement();
+            }
+            setNode(node, NFA_CONSUME, addSet(set, status), nodeFor(range, pc+1), -1);
+            break;
+
+        case URX_DOTANY:
+            set = new UnicodeSet(lineEnds);
+            if (set != NULL) {
+                set->complement();
+            }
+            setNode(node, NFA_CONSUME, addSet(set, status), nodeFor(range, pc+1), -1);
+            break;
+
+        case URX_DOTANY_UNIX:
+            set = new UnicodeSet(0x0a, 0x0a);
+            if (set != NULL) {
+                set->complement();
+            }
+            setNode(node, NFA_CONSUME, addSet(set, status), nodeFor(range, pc+1), -1);
+            break;
+
+        case URX_DOTANY_ALL:
+            setNode(node, NFA_SPLIT, 0, addAnyChar(nodeFor(range, pc+1), status), -1);
+            break;
+
+        case URX_BACKSLASH_D:
+            set = new UnicodeSet();
+            if (set != NULL) {
+                set->applyIntPropertyValue(UCHAR_GENERAL_CATEGORY_MASK, U_GC_ND_MASK, status);
+                if (opValue != 0) {
+                    set->complement();
+                }
+            }
+            setNode(node, NFA_CONSUME, addSet(set, status), nodeFor(range, pc+1), -1);
+            break;
+
+        case URX_BACKSLASH_H:
+            set = new UnicodeSet();
+            if (set != NULL) {
+                set->applyIntPropertyValue(UCHAR_GENERAL_CATEGORY_MASK, U_GC_ZS_MASK, status);
+                set->add(9);
+                if (opValue != 0) {
+                    set->complement();
+                }
+            }
+            setNode(node, NFA_CONSUME, addSet(set, status), nodeFor(range, pc+1), -1);
+            break;
+
+        case URX_BACKSLASH_V:
+            set = new UnicodeSet(lineEnds);
+            if (set != NULL && opValue != 0) {
+                set->complement();
+            }
+            setNode(node, NFA_CONSUME, addSet(set, status), nodeFor(range, pc+1), -1);
+            break;
+
+        case URX_LOOP_SR_I:
+        case URX_LOOP_DOT_I:
+            {
+                // [set]* or .*, greedy.  The URX_LOOP_C that follows is only used for backtracking.
+                U_ASSERT(URX_TYPE(pat.elementAti(pc+1)) == URX_LOOP_C);
+                int32_t bodyNode;
+                if (opType == URX_LOOP_DOT_I && (opValue & 1) == 1) {
+                    // Dot-matches-All mode. The engine never stops the loop between a CR and a LF.
+                    bodyNode = addAnyChar(node, status);
+                } else {
+                    if (opType == URX_LOOP_SR_I) {
+                        set = new UnicodeSet(*(const UnicodeSet *)pattern.fSets->elementAt(opValue));
+                    } else {
+                        set = new UnicodeSet((opValue & 2) != 0 ? UnicodeSet(0x0a, 0x0a) : lineEnds);
+                        if (set != NULL) {
+                            set->complement();
+                        }
+                    }
+                    bodyNode = addNode(NFA_CONSUME, addSet(set, status), node, -1, status);
+                }
+                setNode(node, NFA_SPLIT, 0, bodyNode, nodeFor(range, pc+2));
+                pc++;               // Skip the URX_LOOP_C
+            }
+            break;
+
+        case URX_CARET:
+            setNode(node, NFA_SPLIT, 0, addAssertion(ASSERT_CARET, nodeFor(range, pc+1), status), -1);
+            break;
+
+        case URX_CARET_M:
+            setNode(node, NFA_SPLIT, 0, addAssertion(ASSERT_CARET_M, nodeFor(range, pc+1), status), -1);
+            break;
+
+        case URX_CARET_M_UNIX:
+            setNode(node, NFA_SPLIT, 0, addAssertion(ASSERT_CARET_M_UNIX, nodeFor(range, pc+1), status), -1);
+            break;
+
+        case URX_DOLLAR:
+            setNode(node, NFA_SPLIT, 0, addAssertion(ASSERT_DOLLAR, nodeFor(range, pc+1), status), -1);
+            break;
+
+        case URX_DOLLAR_D:
+            setNode(node, NFA_SPLIT, 0, addAssertion(ASSERT_DOLLAR_D, nodeFor(range, pc+1), status), -1);
+            break;
+
+        case URX_DOLLAR_M:
+            setNode(node, NFA_SPLIT, 0, addAssertion(ASSERT_DOLLAR_M, nodeFor(range, pc+1), status), -1);
+            break;
+
+        case URX_DOLLAR_MD:
+            setNode(node, NFA_SPLIT, 0, addAssertion(ASSERT_DOLLAR_MD, nodeFor(range, pc+1), status), -1);
+            break;
+
+        case URX_BACKSLASH_Z:
+            setNode(node, NFA_SPLIT, 0, addAssertion(ASSERT_END, nodeFor(range, pc+1), status), -1);
+            break;
+
+        case URX_BACKSLASH_B:
+            setNode(node, NFA_SPLIT, 0,
+                    addAssertion(opValue != 0 ? ASSERT_NOT_WORD_BOUNDARY : ASSERT_WORD_BOUNDARY,
+                                 nodeFor(range, pc+1), status), -1);
+            break;
+
+        case URX_CTR_INIT:
+        case URX_CTR_INIT_NG:
+            {
+                int32_t loopLoc = URX_VAL(pat.elementAti(pc+1));
+                if (loopLoc < pc + 4 || loopLoc >= limit) {
+                    fUnsupported = TRUE;
+                    break;
+                }
+                int32_t loopExit = nodeFor(range, loopLoc+1);
+                setNode(node, NFA_SPLIT, 0,
+                        addCountedLoop(pattern, pc, loopExit, patternIndex, isExact, status), -1);
+                pc = loopLoc;       // Skip the loop body and the URX_CTR_LOOP
+            }
+            break;
+
+        default:
+            // Look-around, back references, atomic groups, \G, \X, \R and
+            //   Unicode word boundaries.
+            fUnsupported = TRUE;
+            break;
+        }
+    }
+    return range.fBase + start;
+}
+
+
+//
+//  finish    Set up the start node and the character classes, once all patterns
+//            have been added.
+//
+UBool RegexDFA::finish(UErrorCode &status) {
+    if (U_FAILURE(status) || fPatternStarts.size() == 0) {
+        return FALSE;
+    }
+    // With more than one pattern, a chain of splits leads to the start of each.
+    fStartNode = fPatternStarts.elementAti(0);
+    for (int32_t i = 1; i < fPatternStarts.size(); i++) {
+        fStartNode = addNode(NFA_SPLIT, 0, fPatternStarts.elementAti(i), fStartNode, status);
+    }
+    return buildClasses(status);
+}
+
+
+//
+//  buildClasses    Partition Unicode into classes of characters that belong to
+//                  exactly the same sets, so that DFA transitions are per class
+//                  rather than per character.
+//
+UBool RegexDFA::buildClasses(UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+
+    // Every set boundary starts a new range.
+    UVector32 bounds(status);
+    bounds.addElement(0, status);
+    int32_t setCount = fSets.size();
+    for (int32_t i = 0; i < setCount; i++) {
+        const UnicodeSet *set = (const UnicodeSet *)fSets.elementAt(i);
+        for (int32_t r = 0; r < set->getRangeCount(); r++) {
+            bounds.addElement(set->getRangeStart(r), status);
+            if (set->getRangeEnd(r) < 0x10ffff) {
+                bounds.addElement(set->getRangeEnd(r) + 1, status);
+            }
+        }
+    }
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    uprv_sortArray(bounds.getBuffer(), bounds.size(), sizeof(int32_t),
+                   uprv_int32Comparator, NULL, FALSE, &status);
+
+    // Ranges whose characters are in the same sets share a class.
+    // The class of a range is keyed by its set membership signature.
+    Hashtable signatures(status);
+    UVector32 classReps(status);        // A member of each class.
+    UnicodeString signature;
+    int32_t prevStart = -1;
+    for (int32_t b = 0; b < bounds.size() && U_SUCCESS(status); b++) {
+        UChar32 start = bounds.elementAti(b);
+        if (start == prevStart) {
+            continue;
+        }
+        prevStart = start;
+        signature.remove();
+        for (int32_t i = 0; i < setCount; i++) {
+            signature.append(((const UnicodeSet *)fSets.elementAt(i))->contains(start) ? (UChar)0x31 : (UChar)0x30);
+        }
+        int32_t cls = signatures.geti(signature) - 1;
+        if (cls < 0) {
+            cls = classReps.size();
+            classReps.addElement(start, status);
+            signatures.puti(signature, cls + 1, status);
+        }
+        if (fRangeClasses.size() > 0 && fRangeClasses.peeki() == cls) {
+            continue;                   // Same class as the previous range, merge them.
+        }
+        fRangeStarts.addElement(start, status);
+        fRangeClasses.addElement(cls, status);
+    }
+    fClassCount = classReps.size();
+    if (U_FAILURE(status) || fClassCount >= 0xffff) {
+        return FALSE;
+    }
+
+    for (UChar32 c = 0; c < 256; c++) {
+        int32_t r = 0;
+        while (r + 1 < fRangeStarts.size() && fRangeStarts.elementAti(r + 1) <= c) {
+            r++;
+        }
+        fLatin1Class[c] = (uint16_t)fRangeClasses.elementAti(r);
+    }
+
+    if (fClassSets.allocateInsteadAndReset(setCount * fClassCount) == NULL && setCount > 0) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return FALSE;
+    }
+    for (int32_t i = 0; i < setCount; i++) {
+        const UnicodeSet *set = (const UnicodeSet *)fSets.elementAt(i);
+        for (int32_t cls = 0; cls < fClassCount; cls++) {
+            fClassSets[i * fClassCount + cls] = set->contains(classReps.elementAti(cls));
+        }
+    }
+    return TRUE;
+}
+
+
+UBool RegexDFA::assertionHolds(int32_t assertion, int32_t context, int32_t cls, int32_t &events) const {
+    UBool atEnd   = cls == fClassCount;
+    UBool atStart = (context & CONTEXT_START) != 0;
+    switch (assertion) {
+    case ASSERT_CARET:
+        return atStart;
+    case ASSERT_CARET_M:
+        return atStart || (!atEnd && (context & CONTEXT_PREV_LT) != 0);
+    case ASSERT_CARET_M_UNIX:
+        return atStart || (context & CONTEXT_PREV_LF) != 0;
+    case ASSERT_DOLLAR:
+    case ASSERT_DOLLAR_D:
+    case ASSERT_END:
+        {
+            int32_t final = assertion == ASSERT_DOLLAR ? CONTEXT_FINAL_LT :
+                            assertion == ASSERT_DOLLAR_D ? CONTEXT_FINAL_LF : 0;
+            if (atEnd || (context & final) != 0) {
+                events |= EVENT_HIT_END | EVENT_REQUIRE_END;
+                return TRUE;
+            }
+            return FALSE;
+        }
+    case ASSERT_DOLLAR_M:
+        if (atEnd) {
+            events |= EVENT_HIT_END | EVENT_REQUIRE_END;
+            return TRUE;
+        }
+        // Not between the CR and LF of a CR/LF.
+        return classInSet(cls, fLineEndSet) &&
+            !(classInSet(cls, fLFSet) && !atStart && (context & CONTEXT_PREV_CR) != 0);
+    case ASSERT_DOLLAR_MD:
+        if (atEnd) {
+            events |= EVENT_HIT_END | EVENT_REQUIRE_END;
+            return TRUE;
+        }
+        return classInSet(cls, fLFSet);
+    case ASSERT_WORD_BOUNDARY:
+    case ASSERT_NOT_WORD_BOUNDARY:
+        {
+            // As RegexMatcher::isWordBoundary(). There is no boundary before a
+            //   combining character.
+            UBool isBoundary;
+            UBool prevIsWord = (context & CONTEXT_PREV_WORD) != 0;
+            if (atEnd) {
+                events |= EVENT_HIT_END;
+                isBoundary = prevIsWord;
+            } else if (classInSet(cls, fExtendSet)) {
+                isBoundary = FALSE;
+            } else {
+                isBoundary = classInSet(cls, fWordSet) != prevIsWord;
+            }
+            return isBoundary == (assertion == ASSERT_WORD_BOUNDARY);
+        }
+    case ASSERT_NEXT_LF:
+        return classInSet(cls, fLFSet);
+    case ASSERT_NEXT_NOT_LF:
+        return !classInSet(cls, fLFSet);
+    default:
+        return FALSE;
+    }
+}
+
+
+int32_t RegexDFA::contextAfter(int32_t context, int32_t cls) const {
+    int32_t result = 0;
+    if (classInSet(cls, fLineEndSet)) {
+        result |= CONTEXT_PREV_LT;
+    }
+    if (classInSet(cls, fCRSet)) {
+        result |= CONTEXT_PREV_CR;
+    }
+    if (classInSet(cls, fLFSet)) {
+        result |= CONTEXT_PREV_LF;
+    }
+    if (classInSet(cls, fExtendSet)) {
+        result |= context & CONTEXT_PREV_WORD;
+    } else if (classInSet(cls, fWordSet)) {
+        result |= CONTEXT_PREV_WORD;
+    }
+    return result & fContextNeeds;
+}
+
+
+int32_t RegexDFA::contextAt(UText *input, int64_t regionStart, int64_t limit, int64_t pos) const {
+    int32_t context = 0;
+    if (pos <= regionStart) {
+        context |= CONTEXT_START;
+    } else {
+        UTEXT_SETNATIVEINDEX(input, pos);
+        context |= contextAfter(0, classOf(UTEXT_PREVIOUS32(input))) & ~CONTEXT_PREV_WORD;
+    }
+    if ((fContextNeeds & CONTEXT_PREV_WORD) != 0) {
+        // The last character before pos that is not combining.
+        UTEXT_SETNATIVEINDEX(input, pos);
+        while (UTEXT_GETNATIVEINDEX(input) > regionStart) {
+            int32_t cls = classOf(UTEXT_PREVIOUS32(input));
+            if (!classInSet(cls, fExtendSet)) {
+                if (classInSet(cls, fWordSet)) {
+                    context |= CONTEXT_PREV_WORD;
+                }
+                break;
+            }
+        }
+    }
+    if ((fContextNeeds & (CONTEXT_FINAL_LT | CONTEXT_FINAL_LF)) != 0) {
+        int64_t finalLT;
+        int64_t finalLF;
+        finalPositions(input, regionStart, limit, finalLT, finalLF);
+        if (pos == finalLT) {
+            context |= CONTEXT_FINAL_LT;
+        }
+        if (pos == finalLF) {
+            context |= CONTEXT_FINAL_LF;
+        }
+    }
+    return context & fContextNeeds;
+}
+
+
+void RegexDFA::finalPositions(UText *input, int64_t regionStart, int64_t limit,
+                              int64_t &finalLT, int64_t &finalLF) const {
+    finalLT = -1;
+    finalLF = -1;
+    if (limit <= regionStart) {
+        return;
+    }
+    UTEXT_SETNATIVEINDEX(input, limit);
+    UChar32 c = UTEXT_PREVIOUS32(input);
+    int64_t pos = UTEXT_GETNATIVEINDEX(input);
+    if (c == 0x0a) {
+        finalLF = pos;
+    }
+    if (isLineTerminator(c)) {
+        // $ matches before a final CR/LF, but not between its CR and LF.
+        finalLT = pos;
+        if (c == 0x0a && pos > regionStart && UTEXT_PREVIOUS32(input) == 0x0d) {
+            finalLT = UTEXT_GETNATIVEINDEX(input);
+        }
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   RegexDFACache
+//
+//------------------------------------------------------------------------------
+RegexDFACache::RegexDFACache(const RegexDFA &dfa, UErrorCode &status) :
+        fDFA(dfa), fStateMap(status), fStateNodes(status), fStateStarts(status),
+        fStateFlags(status), fTransitions(status), fTransitionData(status),
+        fWorkNodes(status), fWorkOrigins(status), fWorkMatched(status), fWorkStack(status),
+        fFlushNodes(status), fGeneration(0), fTailGeneration(0) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int32_t nodeCount = dfa.nodeCount();
+    if (fMarks.allocateInsteadAndReset(nodeCount) == NULL ||
+            fThreadMarks.allocateInsteadAndReset(nodeCount) == NULL ||
+            fStarts.allocateInsteadAndReset(nodeCount) == NULL ||
+            fNextStarts.allocateInsteadAndReset(nodeCount) == NULL ||
+            fTailMarks.allocateInsteadAndReset(nodeCount * MAX_TAIL_POSITIONS) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    reset(status);
+}
+
+RegexDFACache::~RegexDFACache() {
+}
+
+
+//
+//  reset    Discard all states, leaving just the dead state.
+//
+void RegexDFACache::reset(UErrorCode &status) {
+    fStateMap.removeAll();
+    fStateNodes.removeAllElements();
+    fStateStarts.removeAllElements();
+    fStateFlags.removeAllElements();
+    fTransitions.removeAllElements();
+    fTransitionData.removeAllElements();
+
+    fStateStarts.addElement(0, status);
+    fWorkNodes.removeAllElements();
+    int32_t dead = addState(0, status);
+    (void)dead;
+    U_ASSERT(U_FAILURE(status) || dead == DEAD_STATE);
+}
+
+
+//
+//  addState    Find or create the state with the threads in fWorkNodes.
+//              If there are too many states, returns BUDGET_STATE without
+//              adding one.
+//
+int32_t RegexDFACache::addState(int32_t flags, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return BUDGET_STATE;
+    }
+    if (fWorkNodes.size() == 0 && (flags & STATE_FLOATING) == 0 && fStateFlags.size() > 0) {
+        return DEAD_STATE;
+    }
+    if ((flags >> 8) == MODE_ALL) {
+        // The order of threads only matters to the ordered modes.
+        uprv_sortArray(fWorkNodes.getBuffer(), fWorkNodes.size(), sizeof(int32_t),
+                       uprv_int32Comparator, NULL, FALSE, &status);
+    }
+    UnicodeString key((UChar)flags);
+    for (int32_t i = 0; i < fWorkNodes.size(); i++) {
+        int32_t n = fWorkNodes.elementAti(i);
+        key.append((UChar)(n >> 16)).append((UChar)n);
+    }
+    int32_t state = fStateMap.geti(key) - 1;
+    if (state >= 0) {
+        return state;
+    }
+    state = fStateFlags.size();
+    if (state >= MAX_STATES || fTransitionData.size() >= MAX_TRANSITION_DATA) {
+        return BUDGET_STATE;
+    }
+
+    for (int32_t i = 0; i < fWorkNodes.size(); i++) {
+        fStateNodes.addElement(fWorkNodes.elementAti(i), status);
+    }
+    fStateStarts.addElement(fStateNodes.size(), status);
+    fStateFlags.addElement(flags, status);
+    for (int32_t cls = 0; cls <= fDFA.classCount(); cls++) {
+        fTransitions.addElement(UNKNOWN_TRANSITION, status);
+    }
+    fStateMap.puti(key, state + 1, status);
+    return U_SUCCESS(status) ? state : BUDGET_STATE;
+}
+
+
+//
+//  flushingAddState    addState(), discarding all other states first if there are
+//                      too many.
+//
+int32_t RegexDFACache::flushingAddState(int32_t flags, UErrorCode &status) {
+    int32_t state = addState(flags, status);
+    if (state == BUDGET_STATE && U_SUCCESS(status)) {
+        fFlushNodes.assign(fWorkNodes, status);
+        reset(status);
+        fWorkNodes.assign(fFlushNodes, status);
+        state = addState(flags, status);
+    }
+    return state;
+}
+
+
+//
+//  startState    The state at the start of a scan. Anchored, it has the single thread of
+//                the pattern start. Otherwise it has none, and floats.
+//
+int32_t RegexDFACache::startState(int32_t mode, UBool anchored, int32_t context, UErrorCode &status) {
+    fWorkNodes.removeAllElements();
+    if (anchored) {
+        fWorkNodes.addElement(fDFA.startNode(), status);
+    }
+    return flushingAddState((mode << 8) | (anchored ? 0 : STATE_FLOATING) | context, status);
+}
+
+
+//
+//  changeFlags    The state with the same threads as state, and other flags.
+//
+int32_t RegexDFACache::changeFlags(int32_t state, int32_t flags, UErrorCode &status) {
+    if (fStateFlags.elementAti(state) == flags) {
+        return state;
+    }
+    fWorkNodes.removeAllElements();
+    int32_t limit = fStateStarts.elementAti(state + 1);
+    for (int32_t i = fStateStarts.elementAti(state); i < limit; i++) {
+        fWorkNodes.addElement(fStateNodes.elementAti(i), status);
+    }
+    return flushingAddState(flags, status);
+}
+
+
+//
+//  buildTransition    Compute the transition from state on a character of class cls, or
+//                     at the end of input, and return the offset of its record.
+//                     The threads of the state are expanded through the non-consuming
+//                     nodes, in order, so that a node reached by a thread is not
+//                     reached again by a later one, and the consuming nodes that accept
+//                     the character give the threads of the next state.
+//                     Returns -1 on an error.
+//
+int32_t RegexDFACache::buildTransition(int32_t state, int32_t cls, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+    int32_t flags    = fStateFlags.elementAti(state);
+    int32_t mode     = flags >> 8;
+    int32_t context  = flags & RegexDFA::CONTEXT_MASK;
+    UBool   floating = (flags & STATE_FLOATING) != 0;
+    UBool   atEnd    = cls == fDFA.endClass();
+
+    fGeneration++;
+    fWorkNodes.removeAllElements();
+    fWorkOrigins.removeAllElements();
+    fWorkMatched.removeAllElements();
+    int32_t matchOrigin = NO_MATCH;
+    int32_t events = 0;
+    UBool   cut = FALSE;
+
+    int32_t first = fStateStarts.elementAti(state);
+    int32_t count = fStateStarts.elementAti(state + 1) - first;
+    for (int32_t i = 0; i <= count && !cut; i++) {
+        int32_t origin = i;
+        if (i == count) {
+            if (!floating) {
+                break;
+            }
+            origin = START_HERE;        // A match may also begin here, least preferred.
+        }
+        fWorkStack.removeAllElements();
+        fWorkStack.push(origin == START_HERE ? fDFA.startNode() : fStateNodes.elementAti(first + i), status);
+        while (!fWorkStack.empty() && !cut && U_SUCCESS(status)) {
+            int32_t n = fWorkStack.popi();
+            if (n < 0 || fMarks[n] == fGeneration) {
+                continue;
+            }
+            fMarks[n] = fGeneration;
+            switch (fDFA.nodeType(n)) {
+            case RegexDFA::NFA_SPLIT:
+                fWorkStack.push(fDFA.nodeAlt(n), status);
+                fWorkStack.push(fDFA.nodeNext(n), status);
+                break;
+            case RegexDFA::NFA_ASSERT:
+                if (fDFA.assertionHolds(fDFA.nodeArg(n), context, cls, events)) {
+                    fWorkStack.push(fDFA.nodeNext(n), status);
+                }
+                break;
+            case RegexDFA::NFA_CONSUME:
+                if (atEnd) {
+                    events |= RegexDFA::EVENT_HIT_END;
+                } else if (fDFA.classInSet(cls, fDFA.nodeArg(n))) {
+                    int32_t next = fDFA.nodeNext(n);
+                    if (next >= 0 && fThreadMarks[next] != fGeneration) {
+                        fThreadMarks[next] = fGeneration;
+                        fWorkNodes.addElement(next, status);
+                        fWorkOrigins.addElement(origin, status);
+                    }
+                }
+                break;
+            case RegexDFA::NFA_MATCH:
+                if (mode == MODE_ALL) {
+                    fWorkMatched.addElement(fDFA.nodeArg(n), status);
+                    matchOrigin = origin;
+                } else if (mode == MODE_FIRST || atEnd) {
+                    // The engine would stop here. Less preferred threads are dropped.
+                    matchOrigin = origin;
+                    cut = TRUE;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+
+    int32_t nextFlags = (mode << 8) | fDFA.contextAfter(context, cls);
+    if (floating && !(mode == MODE_FIRST && matchOrigin != NO_MATCH)) {
+        nextFlags |= STATE_FLOATING;
+    }
+    if (atEnd) {
+        fWorkNodes.removeAllElements();
+        fWorkOrigins.removeAllElements();
+        nextFlags = 0;
+    }
+    int32_t next = addState(nextFlags, status);
+    UBool flushed = FALSE;
+    if (next == BUDGET_STATE && U_SUCCESS(status)) {
+        // Out of room for more states. Discard them all, keeping only the new one.
+        //   The transition record is still made, for the caller's use.
+        next = flushingAddState(nextFlags, status);
+        flushed = TRUE;
+    }
+    if (next < 0 || U_FAILURE(status)) {
+        return -1;
+    }
+
+    int32_t record = fTransitionData.size();
+    fTransitionData.addElement(next, status);
+    fTransitionData.addElement(matchOrigin, status);
+    fTransitionData.addElement(events, status);
+    if (mode == MODE_ALL) {
+        fTransitionData.addElement(0, status);
+    } else {
+        fTransitionData.addElement(fWorkOrigins.size(), status);
+        for (int32_t i = 0; i < fWorkOrigins.size(); i++) {
+            fTransitionData.addElement(fWorkOrigins.elementAti(i), status);
+        }
+    }
+    fTransitionData.addElement(fWorkMatched.size(), status);
+    for (int32_t i = 0; i < fWorkMatched.size(); i++) {
+        fTransitionData.addElement(fWorkMatched.elementAti(i), status);
+    }
+    if (!flushed) {
+        fTransitions.setElementAt(record, state * (fDFA.classCount() + 1) + cls);
+    }
+    return U_SUCCESS(status) ? record : -1;
+}
+
+
+inline int32_t RegexDFACache::transition(int32_t state, int32_t cls, UErrorCode &status) {
+    int32_t record = fTransitions.elementAti(state * (fDFA.classCount() + 1) + cls);
+    if (record == UNKNOWN_TRANSITION) {
+        record = buildTransition(state, cls, status);
+    }
+    return record;
+}
+
+
+//
+//  tailStart    The position from which the scan for a match hands over to searchTail():
+//               the end of the input, or the position before a final line terminator
+//               where the pattern's $ would match. Before it, no assertion or match
+//               operation has a side effect on hitEnd() or requireEnd().
+//
+int64_t RegexDFACache::tailStart(const RegexDFAInput &input, int64_t &finalLT, int64_t &finalLF) const {
+    finalLT = -1;
+    finalLF = -1;
+    int64_t tail = input.fLimit;
+    int32_t needs = fDFA.contextNeeds();
+    if ((needs & (RegexDFA::CONTEXT_FINAL_LT | RegexDFA::CONTEXT_FINAL_LF)) != 0) {
+        fDFA.finalPositions(input.fText, input.fRegionStart, input.fLimit, finalLT, finalLF);
+        if ((needs & RegexDFA::CONTEXT_FINAL_LT) != 0 && finalLT >= 0 && finalLT < tail) {
+            tail = finalLT;
+        }
+        if ((needs & RegexDFA::CONTEXT_FINAL_LF) != 0 && finalLF >= 0 && finalLF < tail) {
+            tail = finalLF;
+        }
+    }
+    return tail;
+}
+
+
+//
+//  searchTail    Continue the threads of state, at pos, to the end of the input, by a
+//                depth first search of the NFA in the order of the match engine. As
+//                with the engine, the search stops at the first match, and the side
+//                effects of the paths tried before it are collected in events.
+//                A path that reaches a node at a position that an earlier path
+//                reached can not do any better, and is not tried.
+//                starts has the start position of each thread, or is NULL if they
+//                all start at defaultStart.
+//
+UBool RegexDFACache::searchTail(const RegexDFAInput &input, int64_t pos, int32_t state,
+                                const int64_t *starts, int64_t defaultStart, UBool toEnd,
+                                int64_t &matchStart, int64_t &matchEnd, int32_t &events) {
+    UErrorCode status = U_ZERO_ERROR;
+    UText *text = input.fText;
+
+    // The positions from pos to the end, the class of the character at each,
+    //   and their contexts, when needed.
+    int64_t positions[MAX_TAIL_POSITIONS];
+    int32_t classes[MAX_TAIL_POSITIONS];
+    int32_t contexts[MAX_TAIL_POSITIONS];
+    int32_t positionCount = 0;
+    UTEXT_SETNATIVEINDEX(text, pos);
+    for (;;) {
+        positions[positionCount] = pos;
+        contexts[positionCount] = -1;
+        if (pos >= input.fLimit || positionCount == MAX_TAIL_POSITIONS - 1) {
+            U_ASSERT(pos >= input.fLimit);
+            classes[positionCount++] = fDFA.endClass();
+            break;
+        }
+        classes[positionCount++] = fDFA.classOf(UTEXT_NEXT32(text));
+        pos = UTEXT_GETNATIVEINDEX(text);
+    }
+
+    fTailGeneration++;
+    int32_t first = fStateStarts.elementAti(state);
+    int32_t count = fStateStarts.elementAti(state + 1) - first;
+    for (int32_t i = 0; i < count; i++) {
+        fWorkStack.removeAllElements();
+        fWorkStack.push(fStateNodes.elementAti(first + i), status);
+        fWorkStack.push(0, status);
+        while (!fWorkStack.empty() && U_SUCCESS(status)) {
+            int32_t p = fWorkStack.popi();
+            int32_t n = fWorkStack.popi();
+            if (n < 0 || fTailMarks[n * MAX_TAIL_POSITIONS + p] == fTailGeneration) {
+                continue;
+            }
+            fTailMarks[n * MAX_TAIL_POSITIONS + p] = fTailGeneration;
+            switch (fDFA.nodeType(n)) {
+            case RegexDFA::NFA_SPLIT:
+                fWorkStack.push(fDFA.nodeAlt(n), status);
+                fWorkStack.push(p, status);
+                fWorkStack.push(fDFA.nodeNext(n), status);
+                fWorkStack.push(p, status);
+                break;
+            case RegexDFA::NFA_ASSERT:
+                if (contexts[p] < 0) {
+                    contexts[p] = fDFA.contextAt(text, input.fRegionStart, input.fLimit, positions[p]);
+                }
+                if (fDFA.assertionHolds(fDFA.nodeArg(n), contexts[p], classes[p], events)) {
+                    fWorkStack.push(fDFA.nodeNext(n), status);
+                    fWorkStack.push(p, status);
+                }
+                break;
+            case RegexDFA::NFA_CONSUME:
+                if (classes[p] == fDFA.endClass()) {
+                    events |= RegexDFA::EVENT_HIT_END;
+                } else if (fDFA.classInSet(classes[p], fDFA.nodeArg(n))) {
+                    fWorkStack.push(fDFA.nodeNext(n), status);
+                    fWorkStack.push(p + 1, status);
+                }
+                break;
+            case RegexDFA::NFA_MATCH:
+                if (!toEnd || positions[p] >= input.fLimit) {
+                    matchStart = starts != NULL ? starts[i] : defaultStart;
+                    matchEnd   = positions[p];
+                    return TRUE;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    return FALSE;
+}
+
+
+//
+//  scan    The scan of matchAt() and find(). Threads are followed through the DFA
+//          up to the tail of the input, and through the NFA from there.
+//
+int32_t RegexDFACache::scan(const RegexDFAInput &input, int64_t startIdx, int32_t mode, UBool floating,
+                            int64_t lastStart, RegexDFAResult &result, UErrorCode &status) {
+    result.fHitEnd     = FALSE;
+    result.fRequireEnd = FALSE;
+    result.fResumeIdx  = startIdx;
+    if (U_FAILURE(status)) {
+        return RESULT_NO_MATCH;
+    }
+    int64_t finalLT;
+    int64_t finalLF;
+    int64_t tail = tailStart(input, finalLT, finalLF);
+    int32_t context = 0;
+    if (fDFA.contextNeeds() != 0 && startIdx < tail) {
+        context = fDFA.contextAt(input.fText, input.fRegionStart, input.fLimit, startIdx);
+    }
+
+    // A floating scan tracks the start position of each thread.
+    UBool    tracking   = floating;
+    int64_t *starts     = fStarts.getAlias();
+    int64_t *nextStarts = fNextStarts.getAlias();
+    int64_t  matchStart = -1;
+    int64_t  matchEnd   = -1;
+    int64_t  pos        = startIdx;
+    int32_t  state      = startState(mode, !floating, context, status);
+    if (state < 0) {
+        return RESULT_NO_MATCH;
+    }
+
+    UText         *text    = input.fText;
+    const uint8_t *utf8    = input.fUTF8;
+    int32_t        columns = fDFA.classCount() + 1;
+    if (utf8 == NULL) {
+        UTEXT_SETNATIVEINDEX(text, pos);
+    }
+    while (state != DEAD_STATE && pos < tail) {
+        if (floating && pos > lastStart) {
+            // No more matches may start.
+            floating = FALSE;
+            state = changeFlags(state, fStateFlags.elementAti(state) & ~STATE_FLOATING, status);
+            if (state < 0) {
+                return RESULT_NO_MATCH;
+            }
+            continue;
+        }
+        UChar32 c;
+        int64_t nextPos = pos;
+        if (utf8 != NULL) {
+            U8_NEXT_OR_FFFD(utf8, nextPos, input.fUTF8Length, c);
+        } else {
+            c = UTEXT_NEXT32(text);
+            nextPos = UTEXT_GETNATIVEINDEX(text);
+        }
+        int32_t cls = fDFA.classOf(c);
+        int32_t record = fTransitions.elementAti(state * columns + cls);
+        if (record == UNKNOWN_TRANSITION) {
+            record = buildTransition(state, cls, status);
+            if (record < 0) {
+                return RESULT_NO_MATCH;
+            }
+        }
+        const int32_t *r = fTransitionData.getBuffer() + record;
+        if (r[TR_MATCH] != NO_MATCH) {
+            matchStart = !tracking ? startIdx : r[TR_MATCH] == START_HERE ? pos : starts[r[TR_MATCH]];
+            matchEnd   = pos;
+            floating   = FALSE;
+        }
+        if (tracking) {
+            // Carry the start positions over to the threads of the next state.
+            int32_t threadCount = r[TR_THREADS];
+            for (int32_t i = 0; i < threadCount; i++) {
+                int32_t origin = r[TR_THREADS + 1 + i];
+                nextStarts[i] = origin == START_HERE ? pos : starts[origin];
+            }
+            int64_t *swap = starts;
+            starts = nextStarts;
+            nextStarts = swap;
+        }
+        state = r[TR_NEXT];
+        pos = nextPos;
+    }
+
+    if (state != DEAD_STATE) {
+        // At the tail, with threads that are preferred to any match found so far.
+        int32_t events = 0;
+        if (searchTail(input, pos, state, tracking ? starts : NULL, startIdx, mode == MODE_TO_END,
+                       matchStart, matchEnd, events)) {
+            floating = FALSE;
+        }
+        result.fHitEnd     = (events & RegexDFA::EVENT_HIT_END) != 0;
+        result.fRequireEnd = (events & RegexDFA::EVENT_REQUIRE_END) != 0;
+        if (floating && pos <= lastStart) {
+            // Matches may still start in the tail, where the caller tries them.
+            result.fResumeIdx = pos;
+            return RESULT_RESUME;
+        }
+    }
+    if (matchEnd < 0) {
+        return RESULT_NO_MATCH;
+    }
+    result.fStart = matchStart;
+    result.fEnd   = matchEnd;
+    return RESULT_MATCH;
+}
+
+
+int32_t RegexDFACache::matchAt(const RegexDFAInput &input, int64_t startIdx, UBool toEnd,
+                               RegexDFAResult &result, UErrorCode &status) {
+    return scan(input, startIdx, toEnd ? MODE_TO_END : MODE_FIRST, FALSE, startIdx, result, status);
+}
+
+
+int32_t RegexDFACache::find(const RegexDFAInput &input, int64_t startIdx, int64_t lastStart,
+                            RegexDFAResult &result, UErrorCode &status) {
+    return scan(input, startIdx, MODE_FIRST, TRUE, lastStart, result, status);
+}
+
+
+UBool RegexDFACache::mayMatch(const RegexDFAInput &input, int64_t startIdx, UBool anchored, UBool toEnd,
+                              UBool &hitEnd, UBool &requireEnd, UErrorCode &status) {
+    hitEnd = FALSE;
+    requireEnd = FALSE;
+    if (U_FAILURE(status)) {
+        return TRUE;
+    }
+    int64_t finalLT;
+    int64_t finalLF;
+    tailStart(input, finalLT, finalLF);
+    int32_t context = 0;
+    if (fDFA.contextNeeds() != 0) {
+        context = fDFA.contextAt(input.fText, input.fRegionStart, input.fLimit, startIdx);
+    }
+
+    int32_t state = startState(MODE_ALL, anchored, context, status);
+    int32_t events = 0;
+    int64_t pos = startIdx;
+    UText *text = input.fText;
+    const uint8_t *utf8 = input.fUTF8;
+    if (utf8 == NULL) {
+        UTEXT_SETNATIVEINDEX(text, pos);
+    }
+    while (state != DEAD_STATE) {
+        if (state < 0 || U_FAILURE(status)) {
+            return TRUE;
+        }
+        if (pos == finalLT || pos == finalLF) {
+            int32_t flags = fStateFlags.elementAti(state);
+            flags |= fDFA.contextNeeds() & ((pos == finalLT ? RegexDFA::CONTEXT_FINAL_LT : 0) |
+                                            (pos == finalLF ? RegexDFA::CONTEXT_FINAL_LF : 0));
+            state = changeFlags(state, flags, status);
+            if (state < 0) {
+                return TRUE;
+            }
+        }
+        int32_t cls = fDFA.endClass();
+        int64_t nextPos = pos;
+        if (pos < input.fLimit) {
+            UChar32 c;
+            if (utf8 != NULL) {
+                U8_NEXT_OR_FFFD(utf8, nextPos, input.fUTF8Length, c);
+            } else {
+                c = UTEXT_NEXT32(text);
+                nextPos = UTEXT_GETNATIVEINDEX(text);
+            }
+            cls = fDFA.classOf(c);
+        }
+        int32_t record = transition(state, cls, status);
+        if (record < 0) {
+            return TRUE;
+        }
+        const int32_t *r = fTransitionData.getBuffer() + record;
+        events |= r[TR_EVENTS];
+        if (r[TR_MATCH] != NO_MATCH && (!toEnd || cls == fDFA.endClass())) {
+            return TRUE;
+        }
+        if (cls == fDFA.endClass()) {
+            break;
+        }
+        state = r[TR_NEXT];
+        pos = nextPos;
+    }
+    hitEnd     = (events & RegexDFA::EVENT_HIT_END) != 0;
+    requireEnd = (events & RegexDFA::EVENT_REQUIRE_END) != 0;
+    return FALSE;
+}
+
+
+int32_t RegexDFACache::findMatches(const RegexDFAInput &input, int64_t startIdx,
+                                   UBool *matched, int32_t remaining, UErrorCode &status) {
+    int32_t found = 0;
+    if (U_FAILURE(status) || remaining <= 0) {
+        return found;
+    }
+    int64_t finalLT;
+    int64_t finalLF;
+    tailStart(input, finalLT, finalLF);
+    int32_t context = 0;
+    if (fDFA.contextNeeds() != 0) {
+        context = fDFA.contextAt(input.fText, input.fRegionStart, input.fLimit, startIdx);
+    }
+
+    int32_t state = startState(MODE_ALL, FALSE, context, status);
+    int64_t pos = startIdx;
+    UText *text = input.fText;
+    const uint8_t *utf8 = input.fUTF8;
+    if (utf8 == NULL) {
+        UTEXT_SETNATIVEINDEX(text, pos);
+    }
+    for (;;) {
+        if (state < 0 || U_FAILURE(status)) {
+            return found;
+        }
+        if (pos == finalLT || pos == finalLF) {
+            int32_t flags = fStateFlags.elementAti(state);
+            flags |= fDFA.contextNeeds() & ((pos == finalLT ? RegexDFA::CONTEXT_FINAL_LT : 0) |
+                                            (pos == finalLF ? RegexDFA::CONTEXT_FINAL_LF : 0));
+            state = changeFlags(state, flags, status);
+            if (state < 0) {
+                return found;
+            }
+        }
+        int32_t cls = fDFA.endClass();
+        int64_t nextPos = pos;
+        if (pos < input.fLimit) {
+            UChar32 c;
+            if (utf8 != NULL) {
+                U8_NEXT_OR_FFFD(utf8, nextPos, input.fUTF8Length, c);
+            } else {
+                c = UTEXT_NEXT32(text);
+                nextPos = UTEXT_GETNATIVEINDEX(text);
+            }
+            cls = fDFA.classOf(c);
+        }
+        int32_t record = transition(state, cls, status);
+        if (record < 0) {
+            return found;
+        }
+        const int32_t *r = fTransitionData.getBuffer() + record;
+        if (r[TR_MATCH] != NO_MATCH) {
+            // Report each pattern that matched here.
+            const int32_t *patterns = r + TR_THREADS + 1 + r[TR_THREADS];
+            for (int32_t i = 1; i <= patterns[0]; i++) {
+                if (!matched[patterns[i]]) {
+                    matched[patterns[i]] = TRUE;
+                    if (++found == remaining) {
+                        return found;
+                    }
+                }
+            }
+        }
+        if (cls == fDFA.endClass()) {
+            return found;
+        }
+        state = r[TR_NEXT];
+        pos = nextPos;
+    }
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_REGULAR_EXPRESSIONS
@@ -0,0 +1,374 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  regexdfa.h
+//
+//  This file contains declarations for the classes RegexDFA and RegexDFACache.
+//
+//  These classes are internal to the regular expression implementation.
+//  For the public Regular Expression API, see the file "unicode/regex.h"
+//
+//  A RegexDFA is built by the pattern compiler for patterns whose compiled
+//   form uses only operations that look at no more than the input position
+//   and the characters next to it: literals and sets, with or without case
+//   folding, alternation, loops, counted loops, anchors and word boundaries.
+//   Back references, look-around, atomic groups and Unicode word boundaries
+//   are not handled. It is a Thompson NFA over a small alphabet of character
+//   classes, derived from the UnicodeSets used by the pattern. A RegexSet
+//   builds a single RegexDFA from many patterns.
+//
+//  A RegexDFACache belongs to a single RegexMatcher, and lazily builds DFA
+//   states from the RegexDFA as input is scanned. The NFA threads of a state
+//   are kept in the order that the backtracking match engine would try them,
+//   so that a single scan of the input finds the same match that the engine
+//   would, leftmost first, in time linear in the length of the input.
+//   For a pattern without capture groups, whose NFA matches exactly the same
+//   input, the scan decides find(), lookingAt() and matches() by itself; the
+//   last characters of the input, where the engine's hitEnd() and requireEnd()
+//   results are decided, are searched directly in the NFA in the engine's order.
+//   For other patterns a scan only tells whether there can be a match, and the
+//   backtracking engine is run only where there is one.
+//
+
+#ifndef REGEXDFA_H
+#define REGEXDFA_H
+
+#include "unicode/utypes.h"
+#include "unicode/utext.h"
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/uobject.h"
+#include "cmemory.h"
+#include "hash.h"
+#include "uvector.h"
+#include "uvectr32.h"
+
+U_NAMESPACE_BEGIN
+
+class  RegexPattern;
+class  UnicodeSet;
+
+
+class RegexDFA : public UMemory {
+public:
+    // Build the NFA for a compiled pattern.
+    // Returns NULL, with no error, if the pattern uses operations that the DFA
+    //   can not handle.
+    static RegexDFA *createInstance(const RegexPattern &pattern, UErrorCode &status);
+
+    // Build the NFA for several patterns: add each pattern, then finish().
+    RegexDFA(UErrorCode &status);
+    UBool    addPattern(const RegexPattern &pattern, int32_t patternIndex, UBool &isExact,
+                        UErrorCode &status);
+    UBool    finish(UErrorCode &status);
+    ~RegexDFA();
+
+    // NFA node types.
+    enum {
+        NFA_FAIL,       // Dead end.
+        NFA_MATCH,      // The end of the pattern fArg was reached.
+        NFA_SPLIT,      // Epsilon transitions to fNext and, if >= 0, fAlt, in that order of preference.
+        NFA_CONSUME,    // Consume a character in the class set fArg, then go to fNext.
+        NFA_ASSERT      // Go to fNext if the assertion fArg holds at the input position.
+    };
+
+    // Assertions, the fArg of NFA_ASSERT nodes. Each behaves as the match
+    //   engine operation of the same name.
+    enum {
+        ASSERT_CARET,           // ^
+        ASSERT_CARET_M,         // ^ in multi-line mode.
+        ASSERT_CARET_M_UNIX,    // ^ in multi-line and UNIX_LINES mode.
+        ASSERT_DOLLAR,          // $ and \Z
+        ASSERT_DOLLAR_D,        // $ in UNIX_LINES mode.
+        ASSERT_DOLLAR_M,        // $ in multi-line mode.
+        ASSERT_DOLLAR_MD,       // $ in multi-line and UNIX_LINES mode.
+        ASSERT_END,             // \z
+        ASSERT_WORD_BOUNDARY,   // \b
+        ASSERT_NOT_WORD_BOUNDARY,   // \B
+        ASSERT_NEXT_LF,         // The next character is a LF. For the CR/LF that '.'
+        ASSERT_NEXT_NOT_LF      //   consumes as one character in dot-matches-all mode.
+    };
+
+    // What assertions need to know of the input around a position, besides
+    //   the character that follows.
+    enum {
+        CONTEXT_START       = 0x01,     // The position is the start of the region.
+        CONTEXT_PREV_LT     = 0x02,     // The preceding character is a line terminator,
+        CONTEXT_PREV_CR     = 0x04,     //   a CR,
+        CONTEXT_PREV_LF     = 0x08,     //   a LF.
+        CONTEXT_PREV_WORD   = 0x10,     // The last preceding character that is not a combining
+                                        //   or format character is a word character.
+        CONTEXT_FINAL_LT    = 0x20,     // The position is before the line terminator that ends
+                                        //   the input, where $ matches.
+        CONTEXT_FINAL_LF    = 0x40,     // The position is before a LF that ends the input.
+        CONTEXT_MASK        = 0x7f
+    };
+
+    // Side effects of assertions and of reading past the end of the input,
+    //   as they set the matcher's hitEnd() and requireEnd().
+    enum {
+        EVENT_HIT_END       = 1,
+        EVENT_REQUIRE_END   = 2
+    };
+
+    int32_t  nodeCount() const        { return fNodes.size() / 4; }
+    int32_t  nodeType(int32_t n) const { return fNodes.elementAti(n*4); }
+    int32_t  nodeArg(int32_t n) const  { return fNodes.elementAti(n*4+1); }
+    int32_t  nodeNext(int32_t n) const { return fNodes.elementAti(n*4+2); }
+    int32_t  nodeAlt(int32_t n) const  { return fNodes.elementAti(n*4+3); }
+    int32_t  startNode() const        { return fStartNode; }
+
+    int32_t  classCount() const       { return fClassCount; }
+    inline int32_t classOf(UChar32 c) const;
+
+    // The class used for the end of the input, one past the character classes.
+    int32_t  endClass() const         { return fClassCount; }
+
+    // True if characters of class cls belong to the character set setIndex.
+    UBool    classInSet(int32_t cls, int32_t setIndex) const {
+        return setIndex >= 0 && cls < fClassCount && fClassSets[setIndex * fClassCount + cls] != 0;
+    }
+
+    // True if the NFA of a single pattern matches exactly what the pattern does, and
+    //   the pattern has no capture groups, so that a DFA scan can stand in for the
+    //   backtracking engine.
+    UBool    decidesMatches() const   { return fDecidesMatches; }
+
+    // True if scanning for matches that start at any position finds the same as
+    //   RegexMatcher::find(). It does not for patterns that start with ^ in multi-line
+    //   mode, where find() only tries the line starts that it finds itself.
+    static UBool scanMatchesFind(const RegexPattern &pattern);
+
+    // True if the pattern has anchors or word boundaries, which depend on the matcher's
+    //   anchoring and look-around bounds.
+    UBool    hasAssertions() const    { return fHasAssertions; }
+
+    // The CONTEXT_ bits that the pattern's assertions depend on. Zero if it has none.
+    int32_t  contextNeeds() const     { return fContextNeeds; }
+
+    // Evaluate an assertion at a position with the given context, followed by
+    //   a character of class cls, or by the end of input if cls is endClass().
+    //   Adds the EVENT_ bits of any side effects to events.
+    UBool    assertionHolds(int32_t assertion, int32_t context, int32_t cls, int32_t &events) const;
+
+    // The context following a character of class cls.
+    int32_t  contextAfter(int32_t context, int32_t cls) const;
+
+    // The context of a position in the region [regionStart, limit) of the input,
+    //   as needed by the pattern.
+    int32_t  contextAt(UText *input, int64_t regionStart, int64_t limit, int64_t pos) const;
+
+    // The positions where CONTEXT_FINAL_LT and CONTEXT_FINAL_LF hold, or -1.
+    void     finalPositions(UText *input, int64_t regionStart, int64_t limit,
+                            int64_t &finalLT, int64_t &finalLF) const;
+
+private:
+    RegexDFA(const RegexDFA &other);              // forbid copying of this class
+    RegexDFA &operator=(const RegexDFA &other);   // forbid copying of this class
+
+    // The nodes for the ops at [fStart, fLimit) of a compiled pattern begin at fBase.
+    //   A jump to fLimit goes to the node fExit.
+    struct Range {
+        int32_t  fStart;
+        int32_t  fLimit;
+        int32_t  fBase;
+        int32_t  fExit;
+    };
+
+    int32_t  addNode(int32_t type, int32_t arg, int32_t next, int32_t alt, UErrorCode &status);
+    void     setNode(int32_t n, int32_t type, int32_t arg, int32_t next, int32_t alt);
+    int32_t  addSet(UnicodeSet *adoptSet, UErrorCode &status);
+    int32_t  addCharSet(UChar32 c, UErrorCode &status);
+    int32_t  addAssertion(int32_t assertion, int32_t next, UErrorCode &status);
+    int32_t  addAnyChar(int32_t next, UErrorCode &status);
+    int32_t  translate(const RegexPattern &pattern, int32_t start, int32_t limit, int32_t exit,
+                       int32_t patternIndex, UBool &isExact, UErrorCode &status);
+    int32_t  nodeFor(const Range &range, int32_t pc);
+    int32_t  addCountedLoop(const RegexPattern &pattern, int32_t pc, int32_t exit,
+                            int32_t patternIndex, UBool &isExact, UErrorCode &status);
+    int32_t  addFoldedString(const UChar *s, int32_t length, int32_t next, UErrorCode &status);
+    UBool    canSkip(int32_t from, int32_t to);
+    UBool    buildClasses(UErrorCode &status);
+
+    UVector32    fNodes;          // NFA nodes, four entries per node: type, arg, next, alt.
+    UVector      fSets;           // UnicodeSets consumed by NFA_CONSUME nodes. Owned.
+    UVector32    fPatternStarts;  // The start node of each added pattern.
+    int32_t      fStartNode;
+    UBool        fUnsupported;    // Set by translate() on an operation it can not handle.
+    UBool        fDecidesMatches;
+    UBool        fHasAssertions;
+
+    int32_t      fContextNeeds;
+    int32_t      fLineEndSet;     // Sets of the characters that the context depends on,
+    int32_t      fCRSet;          //   or -1 if not needed.
+    int32_t      fLFSet;
+    int32_t      fWordSet;
+    int32_t      fExtendSet;      // Grapheme extenders and format characters, which \b skips.
+    UVector32    fMultiFolds;     // Characters whose full case folding is a string.
+
+    int32_t      fClassCount;     // Number of character classes. All characters in a class
+                                  //   belong to exactly the same sets.
+    uint16_t     fLatin1Class[256];   // Class of each Latin-1 character.
+    UVector32    fRangeStarts;    // Code point ranges, sorted by start, covering all of Unicode,
+    UVector32    fRangeClasses;   //   and the class of each.
+    LocalMemory<uint8_t> fClassSets;  // fSets.size() * fClassCount set membership flags.
+};
+
+
+inline int32_t RegexDFA::classOf(UChar32 c) const {
+    if ((uint32_t)c < 256) {
+        return fLatin1Class[c];
+    }
+    // Binary search for the last range starting at or before c.
+    int32_t lo = 0;
+    int32_t hi = fRangeStarts.size();
+    while (hi - lo > 1) {
+        int32_t mid = (lo + hi) / 2;
+        if (fRangeStarts.elementAti(mid) <= c) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return fRangeClasses.elementAti(lo);
+}
+
+
+//  The input to a scan: the text, also as UTF-8 bytes if it is held that way,
+//   and the region of it to be matched. Assertions see the region as the whole
+//   input, as with the matcher's default anchoring and opaque bounds.
+struct RegexDFAInput {
+    UText           *fText;
+    const uint8_t   *fUTF8;         // The bytes of UTF-8 input text, or NULL.
+    int64_t          fUTF8Length;
+    int64_t          fRegionStart;
+    int64_t          fLimit;
+};
+
+//  The outcome of RegexDFACache::matchAt() and find().
+struct RegexDFAResult {
+    int64_t          fStart;        // The match, when there is one.
+    int64_t          fEnd;
+    int64_t          fResumeIdx;    // For RESULT_RESUME.
+    UBool            fHitEnd;       // Whether the match engine would have set hitEnd() or
+    UBool            fRequireEnd;   //   requireEnd() in getting the same result.
+};
+
+
+class RegexDFACache : public UMemory {
+public:
+    RegexDFACache(const RegexDFA &dfa, UErrorCode &status);
+    ~RegexDFACache();
+
+    enum {
+        RESULT_NO_MATCH,
+        RESULT_MATCH,
+        RESULT_RESUME       // find() only: no match starts before fResumeIdx, which is near the
+                            //   end of the input. The caller tries the remaining start positions.
+    };
+
+    // For patterns where RegexDFA::decidesMatches():
+    //
+    //  matchAt     Match starting at startIdx, as MatchAt() does. If toEnd, the match must
+    //              extend to the limit.
+    //
+    //  find        Find the first match that starts at or after startIdx, and at or
+    //              before lastStart.
+    int32_t matchAt(const RegexDFAInput &input, int64_t startIdx, UBool toEnd,
+                    RegexDFAResult &result, UErrorCode &status);
+    int32_t find(const RegexDFAInput &input, int64_t startIdx, int64_t lastStart,
+                 RegexDFAResult &result, UErrorCode &status);
+
+    //  mayMatch    Scan the input from startIdx up to the limit.
+    //              Returns FALSE only if no match is possible:
+    //                anchored:   no match starting at startIdx.
+    //                            If toEnd, no match ending at limit.
+    //                !anchored:  no match starting at or after startIdx.
+    //              Returns TRUE if a match exists.
+    //              When FALSE is returned, hitEnd and requireEnd are set as the match
+    //                engine would set them in failing to find a match.
+    UBool mayMatch(const RegexDFAInput &input, int64_t startIdx, UBool anchored, UBool toEnd,
+                   UBool &hitEnd, UBool &requireEnd, UErrorCode &status);
+
+    //  findMatches    Scan the input from startIdx up to limit for matches of all the
+    //                 patterns of a RegexDFA built from several patterns.
+    //                 Sets matched[i] TRUE for each pattern i with a match not already
+    //                 set, and returns the number of them. Stops early once
+    //                 remaining patterns have been found.
+    int32_t findMatches(const RegexDFAInput &input, int64_t startIdx,
+                        UBool *matched, int32_t remaining, UErrorCode &status);
+
+private:
+    RegexDFACache(const RegexDFACache &other);              // forbid copying of this class
+    RegexDFACache &operator=(const RegexDFACache &other);   // forbid copying of this class
+
+    enum {
+        DEAD_STATE          = 0,        // The state with no NFA threads.
+        UNKNOWN_TRANSITION  = -1,       // Transition not computed yet.
+        BUDGET_STATE        = -2,       // From addState(): no room for another state.
+        MAX_STATES          = 512,      // When reached, all states are discarded and rebuilt as needed.
+        MAX_TRANSITION_DATA = 0x40000,  //   Also when the transition records reach this size.
+
+        // How a state orders its threads, and what it reports.
+        MODE_ALL            = 0,        // All matches; threads are unordered.
+        MODE_FIRST          = 1,        // The first match in the match engine's order.
+        MODE_TO_END         = 2,        // The first match that ends at the limit.
+
+        STATE_FLOATING      = 0x80,     // State flags, besides the mode and the CONTEXT_ bits:
+                                        //   a match may start at any position, not just at the scan start.
+
+        NO_MATCH            = -2,       // Transition record match origins.
+        START_HERE          = -1
+    };
+
+    // A transition record, in fTransitionData:
+    //   next state, match origin, EVENT_ bits, thread count n, n thread origins,
+    //   matched pattern count m, m pattern indexes.
+    // The origin of a thread of the next state, or of the match, is the index of the thread of the
+    //   current state that it continues, or START_HERE if it begins at the current position.
+    enum {
+        TR_NEXT, TR_MATCH, TR_EVENTS, TR_THREADS
+    };
+
+    void     reset(UErrorCode &status);
+    int32_t  addState(int32_t flags, UErrorCode &status);
+    int32_t  flushingAddState(int32_t flags, UErrorCode &status);
+    int32_t  startState(int32_t mode, UBool anchored, int32_t context, UErrorCode &status);
+    int32_t  changeFlags(int32_t state, int32_t flags, UErrorCode &status);
+    int32_t  transition(int32_t state, int32_t cls, UErrorCode &status);
+    int32_t  buildTransition(int32_t state, int32_t cls, UErrorCode &status);
+    int64_t  tailStart(const RegexDFAInput &input, int64_t &finalLT, int64_t &finalLF) const;
+    int32_t  scan(const RegexDFAInput &input, int64_t startIdx, int32_t mode, UBool floating,
+                  int64_t lastStart, RegexDFAResult &result, UErrorCode &status);
+    UBool    searchTail(const RegexDFAInput &input, int64_t pos, int32_t state, const int64_t *starts,
+                        int64_t defaultStart, UBool toEnd,
+                        int64_t &matchStart, int64_t &matchEnd, int32_t &events);
+
+    const RegexDFA &fDFA;
+
+    Hashtable    fStateMap;       // Map from state key to state number + 1.
+    UVector32    fStateNodes;     // NFA nodes of all states' threads, concatenated.
+    UVector32    fStateStarts;    // Start of each state's nodes in fStateNodes; one extra at end.
+    UVector32    fStateFlags;     // Per state, mode << 8 | STATE_FLOATING | CONTEXT_ bits.
+    UVector32    fTransitions;    // Per state, classCount() + 1 offsets of transition records,
+                                  //   or UNKNOWN_TRANSITION. The last is for the end of input.
+    UVector32    fTransitionData; // Transition records.
+
+    UVector32    fWorkNodes;      // Scratch: threads of a state under construction,
+    UVector32    fWorkOrigins;    //   and their origins.
+    UVector32    fWorkMatched;    // Scratch: matched patterns.
+    UVector32    fWorkStack;      // Scratch: closure and search stack.
+    UVector32    fFlushNodes;     // Scratch: threads of the state being kept when discarding states.
+    LocalMemory<int32_t> fMarks;        // Scratch: per NFA node, generation when last reached,
+    LocalMemory<int32_t> fThreadMarks;  //   and when last added as a thread.
+    int32_t      fGeneration;
+    LocalMemory<int64_t> fStarts;       // Scratch: start positions of the threads of find(),
+    LocalMemory<int64_t> fNextStarts;   //   and of the next state.
+    LocalMemory<int32_t> fTailMarks;    // Scratch: per NFA node and tail position, generation of
+    int32_t      fTailGeneration;       //   searchTail() when reached.
+};
+
+
+U_NAMESPACE_END
+#endif   // !UCONFIG_NO_REGULAR_EXPRESSIONS
+#endif   // REGEXDFA_H
@@ -0,0 +1,223 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  file:  regexset.cpp
+//
+//  class RegexSet, matching of many regular expressions in a single pass.
+//
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/regex.h"
+#include "unicode/regexset.h"
+#include "cmemory.h"
+#include "uassert.h"
+#include "uvector.h"
+#include "uvectr32.h"
+#include "regexdfa.h"
+
+U_NAMESPACE_BEGIN
+
+RegexSet::RegexSet(UErrorCode &status) :
+        fPatterns(NULL), fMatchers(NULL), fInDFA(NULL), fDFAPatternCount(0),
+        fDFA(NULL), fDFACache(NULL) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    fPatterns = new UVector(uprv_deleteUObject, NULL, status);
+    fMatchers = new UVector(uprv_deleteUObject, NULL, status);
+    fInDFA    = new UVector32(status);
+    if (U_SUCCESS(status) && (fPatterns == NULL || fMatchers == NULL || fInDFA == NULL)) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
+
+RegexSet::~RegexSet() {
+    // The matchers refer to the patterns; delete them first.
+    delete fMatchers;
+    delete fPatterns;
+    delete fInDFA;
+    delete fDFACache;
+    delete fDFA;
+}
+
+
+//
+//  compile    Compile each pattern, and add those that the DFA can handle to a single
+//             combined RegexDFA. The others, and those where the DFA may report
+//             matches that the pattern would not make, each get a RegexMatcher.
+//
+RegexSet * U_EXPORT2 RegexSet::compile(const UnicodeString patterns[],
+                                       int32_t              count,
+                                       uint32_t             flags,
+                                       UParseError          &pe,
+                                       UErrorCode           &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    if (count < 0 || (patterns == NULL && count > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    LocalPointer<RegexSet> set(new RegexSet(status), status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    LocalPointer<RegexDFA> dfa(new RegexDFA(status), status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+
+    for (int32_t i = 0; i < count; i++) {
+        RegexPattern *pattern = RegexPattern::compile(patterns[i], flags, pe, status);
+        if (U_FAILURE(status)) {
+            delete pattern;
+            return NULL;
+        }
+        set->fPatterns->addElement(pattern, status);
+        if (U_FAILURE(status)) {
+            delete pattern;
+            return NULL;
+        }
+
+        UBool isExact = FALSE;
+        UBool inDFA = dfa->addPattern(*pattern, i, isExact, status);
+        set->fInDFA->addElement(inDFA, status);
+        if (inDFA) {
+            set->fDFAPatternCount++;
+        }
+        RegexMatcher *matcher = NULL;
+        if (!inDFA || !isExact || !RegexDFA::scanMatchesFind(*pattern)) {
+            matcher = pattern->matcher(status);
+        }
+        set->fMatchers->addElement(matcher, status);
+        if (U_FAILURE(status)) {
+            delete matcher;
+            return NULL;
+        }
+    }
+
+    if (set->fDFAPatternCount > 0) {
+        if (!dfa->finish(status)) {
+            // Too complex for the DFA. Use a matcher for every pattern.
+            if (U_FAILURE(status)) {
+                return NULL;
+            }
+            for (int32_t i = 0; i < count; i++) {
+                set->fInDFA->setElementAt(0, i);
+                if (set->fMatchers->elementAt(i) == NULL) {
+                    RegexMatcher *matcher = ((RegexPattern *)set->fPatterns->elementAt(i))->matcher(status);
+                    if (U_FAILURE(status)) {
+                        delete matcher;
+                        return NULL;
+                    }
+                    set->fMatchers->setElementAt(matcher, i);
+                }
+            }
+            set->fDFAPatternCount = 0;
+        } else {
+            set->fDFACache = new RegexDFACache(*dfa, status);
+            if (U_SUCCESS(status) && set->fDFACache == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+            }
+            if (U_FAILURE(status)) {
+                return NULL;
+            }
+            set->fDFA = dfa.orphan();
+        }
+    }
+    return set.orphan();
+}
+
+
+int32_t RegexSet::size() const {
+    return fPatterns->size();
+}
+
+
+const RegexPattern &RegexSet::getPattern(int32_t index) const {
+    U_ASSERT(index >= 0 && index < fPatterns->size());
+    return *(const RegexPattern *)fPatterns->elementAt(index);
+}
+
+
+int32_t RegexSet::findAll(const UnicodeString &input, UBool *matched, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    UText inputText = UTEXT_INITIALIZER;
+    utext_openConstUnicodeString(&inputText, &input, &status);
+    int32_t found = findAll(&inputText, matched, status);
+    utext_close(&inputText);
+    return found;
+}
+
+
+//
+//  findAll    One scan of the input by the combined DFA finds which of its patterns
+//             match. Patterns with their own matcher are then checked individually,
+//             unless the DFA has already ruled them out.
+//             inputUTF8 is the byte buffer of input when the caller passed UTF-8 text,
+//             otherwise NULL. With it the input bytes are scanned in place.
+//
+int32_t RegexSet::findAll(UText *input, UBool *matched, UErrorCode &status) {
+    return findAll(input, NULL, matched, status);
+}
+
+
+int32_t RegexSet::findAllUTF8(StringPiece input, UBool *matched, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    UText inputText = UTEXT_INITIALIZER;
+    utext_openUTF8(&inputText, input.data(), input.length(), &status);
+    int32_t found = findAll(&inputText, input.data(), matched, status);
+    utext_close(&inputText);
+    return found;
+}
+
+
+int32_t RegexSet::findAll(UText *input, const char *inputUTF8, UBool *matched, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    int32_t count = fPatterns->size();
+    if (input == NULL || (matched == NULL && count > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    for (int32_t i = 0; i < count; i++) {
+        matched[i] = FALSE;
+    }
+    if (fDFACache != NULL) {
+        int64_t length = utext_nativeLength(input);
+        RegexDFAInput dfaInput = {input, (const uint8_t *)inputUTF8, length, 0, length};
+        fDFACache->findMatches(dfaInput, 0, matched, fDFAPatternCount, status);
+    }
+
+    int32_t found = 0;
+    for (int32_t i = 0; i < count && U_SUCCESS(status); i++) {
+        RegexMatcher *matcher = (RegexMatcher *)fMatchers->elementAt(i);
+        if (matcher != NULL && (matched[i] || fInDFA->elementAti(i) == 0)) {
+            if (inputUTF8 != NULL) {
+                matcher->resetUTF8(inputUTF8, utext_nativeLength(input), status);
+            } else {
+                matcher->reset(input);
+            }
+            matched[i] = U_SUCCESS(status) && matcher->find(status);
+        }
+        if (matched[i]) {
+            found++;
+        }
+    }
+    return U_SUCCESS(status) ? found : 0;
+}
+
+
+UOBJECT_DEFINE_RTTI_IMPLEMENTATION(RegexSet)
+
+U_NAMESPACE_END
+#endif  // !UCONFIG_NO_REGULAR_EXPRESSIONS
@@ -124,6 +124,7 @@ RegexStaticSets::RegexStaticSets(UErrorCode *status) {
     
     // Finally, initialize an empty UText string for utility purposes
     fEmptyText = utext_openUChars(nullptr, nullptr, 0, status);
+    fEmptyUTF8Text = utext_openUTF8(nullptr, nullptr, 0, status);
     
 }
 
@@ -131,6 +132,7 @@ RegexStaticSets::RegexStaticSets(UErrorCode *status) {
 RegexStaticSets::~RegexStaticSets() {
     fRuleDigitsAlias = nullptr;
     utext_close(fEmptyText);
+    utext_close(fEmptyUTF8Text);
 }
 
 
@@ -50,6 +50,8 @@ class RegexStaticSets : public UMemory {
     UnicodeSet    *fRuleDigitsAlias {};
     UText         *fEmptyText {};                  // An empty string, to be used when a matcher
                                                    //   is created with no input.
+    UText         *fEmptyUTF8Text {};              // An empty UTF-8 UText, for recognizing input
+                                                   //   UTexts that are backed by UTF-8 bytes.
 
 };
 
@@ -23,12 +23,14 @@
 #include "unicode/rbbi.h"
 #include "unicode/utf.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "uassert.h"
 #include "cmemory.h"
 #include "cstr.h"
 #include "uvector.h"
 #include "uvectr32.h"
 #include "uvectr64.h"
+#include "regexdfa.h"
 #include "regeximp.h"
 #include "regexst.h"
 #include "regextxt.h"
@@ -179,6 +181,7 @@ RegexMatcher::~RegexMatcher() {
     delete fWordBreakItr;
     delete fGCBreakItr;
     #endif
+    delete fDFACache;
 }
 
 //
@@ -224,6 +227,9 @@ void RegexMatcher::init(UErrorCode &status) {
     fData              = fSmallData;
     fWordBreakItr      = NULL;
     fGCBreakItr        = NULL;
+    fDFACache          = NULL;
+    fInputUTF8         = NULL;
+    fRequiredStringPos = -1;
 
     fStack             = NULL;
     fInputText         = NULL;
@@ -257,6 +263,17 @@ void RegexMatcher::init2(UText *input, UErrorCode &status) {
         return;
     }
 
+    if (fPattern->fDFA != NULL) {
+        fDFACache = new RegexDFACache(*fPattern->fDFA, status);
+        if (fDFACache == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        if (U_FAILURE(status)) {
+            fDeferredStatus = status;
+            return;
+        }
+    }
+
     reset(input);
     setStackLimit(DEFAULT_BACKTRACK_STACK_CAPACITY, status);
     if (U_FAILURE(status)) {
@@ -680,16 +697,49 @@ UBool RegexMatcher::find(UErrorCode &status) {
     int64_t testStartLimit;
     if (UTEXT_USES_U16(fInputText)) {
         testStartLimit = fActiveLimit - fPattern->fMinMatchLen;
-        if (startPos > testStartLimit) {
-            fMatch = FALSE;
-            fHitEnd = TRUE;
-            return FALSE;
-        }
     } else {
         // We don't know exactly how long the minimum match length is in native characters.
         // Treat anything > 0 as 1.
         testStartLimit = fActiveLimit - (fPattern->fMinMatchLen > 0 ? 1 : 0);
     }
+    if (startPos > testStartLimit) {
+        fMatch = FALSE;
+        fHitEnd = TRUE;
+        return FALSE;
+    }
+
+    // UTF-8 input is scanned in place, in its byte buffer, when looking for
+    //   positions where a match could start.
+    const uint8_t *inputUTF8 = fInputUTF8;
+
+    // Rule out input that can not contain a match before trying any match positions.
+    //   Not done when there are callbacks, which expect to observe the progress of
+    //   the match engine.
+    if (fCallbackFn == NULL && fFindProgressCallbackFn == NULL) {
+        // A match must contain the pattern's required string, if it has one.
+        //   Not checked where find() only tries the start of the input, and so may
+        //   fail without setting hitEnd(), nor where the DFA decides requireEnd() for
+        //   a pattern with anchors. Start positions too far before the string are
+        //   skipped; matches from them could not reach it.
+        if (fPattern->fRequiredStringLen > 0 && fPattern->fStartType != START_START &&
+                !(dfaUsable() && fPattern->fDFA->decidesMatches() && fPattern->fDFA->hasAssertions()) &&
+                (!findRequiredString(startPos) || startPos > testStartLimit)) {
+            fMatch = FALSE;
+            fHitEnd = TRUE;
+            return FALSE;
+        }
+
+        // If the pattern has a DFA, find the match with it in a single scan of the input,
+        //   or, when the DFA can not decide matches, check that there is one at all.
+        if (dfaUsable() && findUsingDFA(startPos, testStartLimit, status)) {
+            return fMatch;
+        }
+
+        if (inputUTF8 != NULL && (fPattern->fStartType == START_SET ||
+                fPattern->fStartType == START_CHAR || fPattern->fStartType == START_STRING)) {
+            return findUTF8(inputUTF8, startPos, testStartLimit, status);
+        }
+    }
 
     UChar32  c;
     U_ASSERT(startPos >= 0);
@@ -912,6 +962,336 @@ UBool RegexMatcher::find(int64_t start, UErrorCode &status) {
 }
 
 
+//--------------------------------------------------------------------------------
+//
+//   findUTF8()   find() for UTF-8 input text and patterns that start with a known
+//                character or with a character from a set. Possible match start
+//                positions are found by scanning the input bytes directly, without
+//                going through UText. The match engine is tried at each of them.
+//                Only this start position scan works on the bytes: the backtracking
+//                engine in MatchAt() still reads the input through UText, and has
+//                no separate UTF-8 byte loop.
+//
+//                Used only when the input was set with resetUTF8(), which records
+//                the byte buffer in fInputUTF8.
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::findUTF8(const uint8_t *input, int64_t startPos, int64_t testStartLimit,
+                             UErrorCode &status) {
+    U_ASSERT(fPattern->fMinMatchLen > 0);
+    UBool   isSet   = fPattern->fStartType == START_SET;
+    UChar32 theChar = fPattern->fInitialChar;
+
+    if (!isSet && theChar != 0xfffd && !U_IS_SURROGATE(theChar)) {
+        // Search for the bytes of the start character. Its lead byte can not occur
+        //   inside any other character, so there is no need to decode the input.
+        //   U+FFFD is excluded because ill-formed input bytes also read as U+FFFD.
+        uint8_t charUTF8[U8_MAX_LENGTH];
+        int32_t charLen = 0;
+        U8_APPEND_UNSAFE(charUTF8, charLen, theChar);
+        while (startPos <= testStartLimit) {
+            const uint8_t *p = (const uint8_t *)uprv_memchr(input + startPos, charUTF8[0],
+                                                            (size_t)(testStartLimit - startPos + 1));
+            if (p == NULL) {
+                break;
+            }
+            int64_t pos = p - input;
+            startPos = pos + 1;
+            if (fActiveLimit - pos >= charLen && uprv_memcmp(p + 1, charUTF8 + 1, charLen - 1) == 0) {
+                MatchAt(pos, FALSE, status);
+                if (U_FAILURE(status)) {
+                    return FALSE;
+                }
+                if (fMatch) {
+                    return TRUE;
+                }
+                startPos = pos + charLen;
+            }
+        }
+        fMatch = FALSE;
+        fHitEnd = TRUE;
+        return FALSE;
+    }
+
+    while (startPos <= testStartLimit) {
+        int64_t pos = startPos;
+        UChar32 c;
+        U8_NEXT_OR_FFFD(input, startPos, fActiveLimit, c);
+        if (isSet ? ((c<256 && fPattern->fInitialChars8->contains(c)) ||
+                     (c>=256 && fPattern->fInitialChars->contains(c))) :
+                    c == theChar) {
+            MatchAt(pos, FALSE, status);
+            if (U_FAILURE(status)) {
+                return FALSE;
+            }
+            if (fMatch) {
+                return TRUE;
+            }
+        }
+    }
+    fMatch = FALSE;
+    fHitEnd = TRUE;
+    return FALSE;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   findRequiredString()  Check that the pattern's required string occurs in the
+//                         active region where a match from startIdx on could contain
+//                         it. Every match contains the string, so without it find()
+//                         can fail without trying the match engine at any position.
+//
+//                         If found, move startIdx up to the first position from which
+//                         a match could reach that occurrence of the string.
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::findRequiredString(int64_t &startIdx) {
+    // The pattern's offset bounds for the string are in UTF-16 code units. They apply
+    //   to UTF-8 input too, in bytes, with the maximum tripled.
+    int64_t minOffset = 0;
+    int64_t maxOffset = INT32_MAX;
+    if (UTEXT_USES_U16(fInputText) || fInputUTF8 != NULL) {
+        minOffset = fPattern->fRequiredStringMinOffset;
+        if (fPattern->fRequiredStringMaxOffset != INT32_MAX) {
+            maxOffset = (int64_t)fPattern->fRequiredStringMaxOffset * (fInputUTF8 != NULL ? 3 : 1);
+        }
+    }
+    if (fRequiredStringPos < startIdx + minOffset && !findRequiredStringFrom(startIdx + minOffset)) {
+        return FALSE;
+    }
+    if (maxOffset != INT32_MAX && fRequiredStringPos - maxOffset > startIdx) {
+        // Setting the index moves it back to the start of a code point.
+        UTEXT_SETNATIVEINDEX(fInputText, fRequiredStringPos - maxOffset);
+        startIdx = UTEXT_GETNATIVEINDEX(fInputText);
+    }
+    return TRUE;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   findRequiredStringFrom()  Find the first occurrence of the pattern's required
+//                             string in the active region at or after startIdx,
+//                             and save its position in fRequiredStringPos.
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::findRequiredStringFrom(int64_t startIdx) {
+    const UChar *reqString = fPattern->fLiteralText.getBuffer() + fPattern->fRequiredStringIdx;
+    int32_t      reqLen    = fPattern->fRequiredStringLen;
+    if (startIdx > fActiveLimit) {
+        return FALSE;
+    }
+
+    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
+        const UChar *inputBuf = fInputText->chunkContents;
+        const UChar *found = u_strFindFirst(inputBuf + startIdx, (int32_t)(fActiveLimit - startIdx),
+                                            reqString, reqLen);
+        if (found == NULL) {
+            return FALSE;
+        }
+        fRequiredStringPos = found - inputBuf;
+        return TRUE;
+    }
+
+    // UTF-8 input, search its bytes for the UTF-8 form of the string.
+    //   A U+FFFD in the string could match ill-formed input bytes, and is left to
+    //   the code point scan.
+    const uint8_t *inputUTF8 = fInputUTF8;
+    if (inputUTF8 != NULL && u_memchr(reqString, 0xfffd, reqLen) == NULL) {
+        char        reqUTF8[64];
+        int32_t     reqUTF8Len = 0;
+        UErrorCode  status = U_ZERO_ERROR;
+        u_strToUTF8(reqUTF8, UPRV_LENGTHOF(reqUTF8), &reqUTF8Len, reqString, reqLen, &status);
+        if (U_SUCCESS(status)) {
+            int64_t pos = startIdx;
+            while (fActiveLimit - pos >= reqUTF8Len) {
+                const uint8_t *p = (const uint8_t *)uprv_memchr(inputUTF8 + pos, (uint8_t)reqUTF8[0],
+                                                                (size_t)(fActiveLimit - pos - reqUTF8Len + 1));
+                if (p == NULL) {
+                    break;
+                }
+                pos = p - inputUTF8;
+                if (uprv_memcmp(p + 1, reqUTF8 + 1, reqUTF8Len - 1) == 0) {
+                    fRequiredStringPos = pos;
+                    return TRUE;
+                }
+                pos++;
+            }
+            return FALSE;
+        }
+    }
+
+    // Input text in some other form, scan it a code point at a time.
+    UChar32 firstChar;
+    int32_t firstLen = 0;
+    U16_NEXT(reqString, firstLen, reqLen, firstChar);
+    UTEXT_SETNATIVEINDEX(fInputText, startIdx);
+    for (;;) {
+        int64_t pos = UTEXT_GETNATIVEINDEX(fInputText);
+        if (pos >= fActiveLimit) {
+            return FALSE;
+        }
+        if (UTEXT_NEXT32(fInputText) != firstChar) {
+            continue;
+        }
+        int64_t nextPos = UTEXT_GETNATIVEINDEX(fInputText);
+        int32_t i = firstLen;
+        UBool   matched = TRUE;
+        while (matched && i < reqLen) {
+            UChar32 c;
+            U16_NEXT(reqString, i, reqLen, c);
+            matched = UTEXT_GETNATIVEINDEX(fInputText) < fActiveLimit && UTEXT_NEXT32(fInputText) == c;
+        }
+        if (matched) {
+            fRequiredStringPos = pos;
+            return TRUE;
+        }
+        UTEXT_SETNATIVEINDEX(fInputText, nextPos);
+    }
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   dfaUsable()    Check whether the pattern's DFA can stand in for the match engine.
+//                  Not with callbacks, which expect to observe the engine's progress,
+//                  and, for patterns with anchors or word boundaries, only with the
+//                  default anchoring and look-around bounds, which the DFA assumes.
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::dfaUsable() const {
+    if (fDFACache == NULL || fCallbackFn != NULL || fFindProgressCallbackFn != NULL) {
+        return FALSE;
+    }
+    return !fPattern->fDFA->hasAssertions() ||
+        (fAnchorStart == fActiveStart && fLookStart == fActiveStart &&
+         fAnchorLimit == fActiveLimit && fLookLimit == fActiveLimit);
+}
+
+void RegexMatcher::setDFAInput(RegexDFAInput &input) const {
+    input.fText        = fInputText;
+    input.fUTF8        = fInputUTF8;
+    input.fUTF8Length  = fInputLength;
+    input.fRegionStart = fActiveStart;
+    input.fLimit       = fActiveLimit;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   findUsingDFA()   The DFA part of find(). Returns TRUE if find() is decided,
+//                    with the result in fMatch.
+//
+//                    For patterns where the DFA decides matches, the match is found
+//                    by a single scan of the input. The scan may leave the last few
+//                    start positions to the match engine, moving startPos up to them.
+//                    For other patterns, the scan only checks that there is a match.
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::findUsingDFA(int64_t &startPos, int64_t testStartLimit, UErrorCode &status) {
+    RegexDFAInput input;
+    setDFAInput(input);
+    int32_t startType = fPattern->fStartType;
+    if (fPattern->fDFA->decidesMatches() && startType != START_START &&
+            RegexDFA::scanMatchesFind(*fPattern)) {
+        // The last start position that find() would try. For START_NO_INFO,
+        //   the first one at or past testStartLimit.
+        int64_t lastStart = testStartLimit;
+        if (startType == START_NO_INFO) {
+            if (startPos >= testStartLimit) {
+                lastStart = startPos;
+            } else {
+                UTEXT_SETNATIVEINDEX(fInputText, testStartLimit);
+                if (UTEXT_GETNATIVEINDEX(fInputText) < testStartLimit) {
+                    (void)UTEXT_NEXT32(fInputText);
+                    lastStart = UTEXT_GETNATIVEINDEX(fInputText);
+                }
+            }
+        }
+        RegexDFAResult result;
+        int32_t outcome = fDFACache->find(input, startPos, lastStart, result, status);
+        if (U_FAILURE(status)) {
+            fMatch = FALSE;
+            return TRUE;
+        }
+        fHitEnd     |= result.fHitEnd;
+        fRequireEnd |= result.fRequireEnd;
+        if (outcome == RegexDFACache::RESULT_RESUME) {
+            startPos = result.fResumeIdx;
+            return FALSE;
+        }
+        fMatch = outcome == RegexDFACache::RESULT_MATCH;
+        if (fMatch) {
+            fLastMatchEnd = fMatchEnd;
+            fMatchStart   = result.fStart;
+            fMatchEnd     = result.fEnd;
+        } else {
+            fHitEnd = TRUE;
+        }
+        return TRUE;
+    }
+
+    if (startType == START_START) {
+        // Left to MatchAt(); find() may not try any position.
+        return FALSE;
+    }
+    UBool hitEnd;
+    UBool requireEnd;
+    if (!fDFACache->mayMatch(input, startPos, FALSE, FALSE, hitEnd, requireEnd, status) &&
+            !requireEnd) {
+        // The engine would fail too, setting hitEnd(). requireEnd() is left to the engine,
+        //   which may try fewer start positions than the scan.
+        fMatch = FALSE;
+        fHitEnd = TRUE;
+        return TRUE;
+    }
+    return U_FAILURE(status);
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   matchUsingDFA()   MatchAt() for patterns where the DFA decides matches.
+//
+//--------------------------------------------------------------------------------
+void RegexMatcher::matchUsingDFA(int64_t startIdx, UBool toEnd, UErrorCode &status) {
+    RegexDFAInput input;
+    setDFAInput(input);
+    RegexDFAResult result;
+    int32_t outcome = fDFACache->matchAt(input, startIdx, toEnd, result, status);
+    fMatch = U_SUCCESS(status) && outcome == RegexDFACache::RESULT_MATCH;
+    fHitEnd     |= result.fHitEnd;
+    fRequireEnd |= result.fRequireEnd;
+    if (fMatch) {
+        fLastMatchEnd = fMatchEnd;
+        fMatchStart   = startIdx;
+        fMatchEnd     = result.fEnd;
+    }
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   dfaRulesOutMatch()   For MatchAt(), check with the DFA that there can be no match
+//                        starting at startIdx. If so, set hitEnd() and requireEnd() as
+//                        the engine would have.
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::dfaRulesOutMatch(int64_t startIdx, UBool toEnd, UErrorCode &status) {
+    RegexDFAInput input;
+    setDFAInput(input);
+    UBool hitEnd;
+    UBool requireEnd;
+    if (fDFACache->mayMatch(input, startIdx, TRUE, toEnd, hitEnd, requireEnd, status) || U_FAILURE(status)) {
+        return FALSE;
+    }
+    fHitEnd     |= hitEnd;
+    fRequireEnd |= requireEnd;
+    return TRUE;
+}
+
+
 //--------------------------------------------------------------------------------
 //
 //   findUsingChunk() -- like find(), but with the advance knowledge that the
@@ -967,6 +1347,37 @@ UBool RegexMatcher::findUsingChunk(UErrorCode &status) {
         return FALSE;
     }
 
+    // Rule out input that can not contain a match before trying any match positions.
+    //   Not done when there are callbacks, which expect to observe the progress of
+    //   the match engine.
+    if (fCallbackFn == NULL && fFindProgressCallbackFn == NULL) {
+        // A match must contain the pattern's required string, if it has one.
+        //   Not checked where find() only tries the start of the input, and so may
+        //   fail without setting hitEnd(), nor where the DFA decides requireEnd() for
+        //   a pattern with anchors. Start positions too far before the string are
+        //   skipped; matches from them could not reach it.
+        if (fPattern->fRequiredStringLen > 0 && fPattern->fStartType != START_START &&
+                !(dfaUsable() && fPattern->fDFA->decidesMatches() && fPattern->fDFA->hasAssertions())) {
+            int64_t requiredStartPos = startPos;
+            if (!findRequiredString(requiredStartPos) || requiredStartPos > testLen) {
+                fMatch = FALSE;
+                fHitEnd = TRUE;
+                return FALSE;
+            }
+            startPos = (int32_t)requiredStartPos;
+        }
+
+        // If the pattern has a DFA, find the match with it in a single scan of the input,
+        //   or, when the DFA can not decide matches, check that there is one at all.
+        if (dfaUsable()) {
+            int64_t resumePos = startPos;
+            if (findUsingDFA(resumePos, testLen, status)) {
+                return fMatch;
+            }
+            startPos = (int32_t)resumePos;
+        }
+    }
+
     UChar32  c;
     U_ASSERT(startPos >= 0);
 
@@ -1826,6 +2237,7 @@ RegexMatcher &RegexMatcher::reset() {
 
 void RegexMatcher::resetPreserveRegion() {
     fMatchStart     = 0;
+    fRequiredStringPos = -1;
     fMatchEnd       = 0;
     fLastMatchEnd   = -1;
     fAppendPosition = 0;
@@ -1840,6 +2252,7 @@ void RegexMatcher::resetPreserveRegion() {
 
 RegexMatcher &RegexMatcher::reset(const UnicodeString &input) {
     fInputText = utext_openConstUnicodeString(fInputText, &input, &fDeferredStatus);
+    fInputUTF8 = NULL;
     if (fPattern->fNeedsAltInput) {
         fAltInputText = utext_clone(fAltInputText, fInputText, FALSE, TRUE, &fDeferredStatus);
     }
@@ -1872,12 +2285,19 @@ RegexMatcher &RegexMatcher::reset(const UnicodeString &input) {
 RegexMatcher &RegexMatcher::reset(UText *input) {
     if (fInputText != input) {
         fInputText = utext_clone(fInputText, input, FALSE, TRUE, &fDeferredStatus);
+        fInputUTF8 = NULL;
         if (fPattern->fNeedsAltInput) fAltInputText = utext_clone(fAltInputText, fInputText, FALSE, TRUE, &fDeferredStatus);
         if (U_FAILURE(fDeferredStatus)) {
             return *this;
         }
         fInputLength = utext_nativeLength(fInputText);
 
+        // A UText from utext_openUTF8() has the UTF-8 bytes as its context, and their
+        //   offsets as its native indexes. Find can scan the bytes directly.
+        if (fInputText->pFuncs == RegexStaticSets::gStaticSets->fEmptyUTF8Text->pFuncs) {
+            fInputUTF8 = (const uint8_t *)fInputText->context;
+        }
+
         delete fInput;
         fInput = NULL;
 
@@ -1896,6 +2316,23 @@ RegexMatcher &RegexMatcher::reset(UText *input) {
     return *this;
 }
 
+RegexMatcher &RegexMatcher::resetUTF8(const char *input, int64_t length, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return *this;
+    }
+    UText utf8Text = UTEXT_INITIALIZER;
+    utext_openUTF8(&utf8Text, input, length, &status);
+    if (U_FAILURE(status)) {
+        return *this;
+    }
+    reset(&utf8Text);       // Makes a shallow clone; utf8Text itself is not kept.
+    utext_close(&utf8Text);
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+    }
+    return *this;
+}
+
 /*RegexMatcher &RegexMatcher::reset(const UChar *) {
     fDeferredStatus = U_INTERNAL_PROGRAM_ERROR;
     return *this;
@@ -1936,9 +2373,13 @@ RegexMatcher &RegexMatcher::refreshInputText(UText *input, UErrorCode &status) {
     int64_t  pos = utext_getNativeIndex(fInputText);
     //  Shallow read-only clone of the new UText into the existing input UText
     fInputText = utext_clone(fInputText, input, FALSE, TRUE, &status);
+    fInputUTF8 = NULL;
     if (U_FAILURE(status)) {
         return *this;
     }
+    if (fInputText->pFuncs == RegexStaticSets::gStaticSets->fEmptyUTF8Text->pFuncs) {
+        fInputUTF8 = (const uint8_t *)fInputText->context;
+    }
     utext_setNativeIndex(fInputText, pos);
 
     if (fAltInputText != NULL) {
@@ -2797,6 +3238,19 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
         return;
     }
 
+    // Let the DFA match, when it can, or skip the backtracking engine when the DFA
+    //   shows that there can be no match starting here.
+    if (dfaUsable()) {
+        if (fPattern->fDFA->decidesMatches()) {
+            matchUsingDFA(startIdx, toEnd, status);
+            return;
+        }
+        if (dfaRulesOutMatch(startIdx, toEnd, status)) {
+            fMatch = FALSE;
+            return;
+        }
+    }
+
     //  Cache frequently referenced items from the compiled pattern
     //
     int64_t             *pat           = fPattern->fCompiledPat->getBuffer();
@@ -4301,6 +4755,19 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
         return;
     }
 
+    // Let the DFA match, when it can, or skip the backtracking engine when the DFA
+    //   shows that there can be no match starting here.
+    if (dfaUsable()) {
+        if (fPattern->fDFA->decidesMatches()) {
+            matchUsingDFA(startIdx, toEnd, status);
+            return;
+        }
+        if (dfaRulesOutMatch(startIdx, toEnd, status)) {
+            fMatch = FALSE;
+            return;
+        }
+    }
+
     //  Cache frequently referenced items from the compiled pattern
     //
     int64_t             *pat           = fPattern->fCompiledPat->getBuffer();
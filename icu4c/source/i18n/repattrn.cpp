@@ -24,6 +24,7 @@
 #include "uvectr32.h"
 #include "uvectr64.h"
 #include "regexcmp.h"
+#include "regexdfa.h"
 #include "regeximp.h"
 #include "regexst.h"
 
@@ -105,6 +106,10 @@ RegexPattern &RegexPattern::operator = (const RegexPattern &other) {
     fInitialChar      = other.fInitialChar;
     *fInitialChars8   = *other.fInitialChars8;
     fNeedsAltInput    = other.fNeedsAltInput;
+    fRequiredStringIdx = other.fRequiredStringIdx;
+    fRequiredStringLen = other.fRequiredStringLen;
+    fRequiredStringMinOffset = other.fRequiredStringMinOffset;
+    fRequiredStringMaxOffset = other.fRequiredStringMaxOffset;
 
     //  Copy the pattern.  It's just values, nothing deep to copy.
     fCompiledPat->assign(*other.fCompiledPat, fDeferredStatus);
@@ -152,6 +157,10 @@ RegexPattern &RegexPattern::operator = (const RegexPattern &other) {
             }
         }
     }
+
+    if (other.fDFA != NULL) {
+        fDFA = RegexDFA::createInstance(*this, fDeferredStatus);
+    }
     return *this;
 }
 
@@ -180,7 +189,12 @@ void RegexPattern::init() {
     fInitialChar      = 0;
     fInitialChars8    = NULL;
     fNeedsAltInput    = FALSE;
+    fRequiredStringIdx = 0;
+    fRequiredStringLen = 0;
+    fRequiredStringMinOffset = 0;
+    fRequiredStringMaxOffset = INT32_MAX;
     fNamedCaptureMap  = NULL;
+    fDFA              = NULL;
 
     fPattern          = NULL; // will be set later
     fPatternString    = NULL; // may be set later
@@ -259,6 +273,8 @@ void RegexPattern::zap() {
         uhash_close(fNamedCaptureMap);
         fNamedCaptureMap = NULL;
     }
+    delete fDFA;
+    fDFA = NULL;
 }
 
 
@@ -828,6 +844,11 @@ void RegexPattern::dumpPattern() const {
     printf("Original Pattern:  \"%s\"\n", CStr(patStr)());
     printf("   Min Match Length:  %d\n", fMinMatchLen);
     printf("   Match Start Type:  %s\n", START_OF_MATCH_STR(fStartType));
+    if (fRequiredStringLen > 0) {
+        UnicodeString requiredString(fLiteralText, fRequiredStringIdx, fRequiredStringLen);
+        printf("   Required string:  \"%s\"\n", CStr(requiredString)());
+        printf("   Required string offset:  %d to %d\n", fRequiredStringMinOffset, fRequiredStringMaxOffset);
+    }
     if (fStartType == START_STRING) {
         UnicodeString initialString(fLiteralText,fInitialStringIdx, fInitialStringLen);
         printf("   Initial match string: \"%s\"\n", CStr(initialString)());
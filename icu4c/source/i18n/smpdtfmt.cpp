@@ -582,6 +582,8 @@ SimpleDateFormat& SimpleDateFormat::operator=(const SimpleDateFormat& other)
     fPattern = other.fPattern;
     fHasMinute = other.fHasMinute;
     fHasSecond = other.fHasSecond;
+    fCompiledPattern = other.fCompiledPattern;
+    fHasFastParseFields = other.fHasFastParseFields;
 
     fLocale = other.fLocale;
 
@@ -986,51 +988,38 @@ SimpleDateFormat::_format(Calendar& cal, UnicodeString& appendTo,
         }
     }
 
-    UBool inQuote = FALSE;
-    UChar prevCh = 0;
-    int32_t count = 0;
     int32_t fieldNum = 0;
     UDisplayContext capitalizationContext = getContext(UDISPCTX_TYPE_CAPITALIZATION, status);
 
-    // loop through the pattern string character by character
-    for (int32_t i = 0; i < fPattern.length() && U_SUCCESS(status); ++i) {
-        UChar ch = fPattern[i];
-
-        // Use subFormat() to format a repeated pattern character
-        // when a different pattern or non-pattern character is seen
-        if (ch != prevCh && count > 0) {
-            subFormat(appendTo, prevCh, count, capitalizationContext, fieldNum++,
-                      prevCh, handler, *workCal, status);
-            count = 0;
-        }
-        if (ch == QUOTE) {
-            // Consecutive single quotes are a single quote literal,
-            // either outside of quotes or between quotes
-            if ((i+1) < fPattern.length() && fPattern[i+1] == QUOTE) {
-                appendTo += (UChar)QUOTE;
-                ++i;
-            } else {
-                inQuote = ! inQuote;
+    // Numbers can be written as ASCII digits unless the number format or the calendar
+    // needs special handling; see fastSubFormat().
+    UBool fastDigits = fHasASCIIDigits && fDateOverride.isBogus() && fTimeOverride.isBogus();
+    UBool fastMonths = fSymbols->fLeapMonthPatterns == NULL &&
+        uprv_strcmp(workCal->getType(), "hebrew") != 0;
+
+    // loop through the operations of the compiled pattern, see parsePattern()
+    const char16_t* ops = fCompiledPattern.getBuffer();
+    int32_t length = fCompiledPattern.length();
+    for (int32_t i = 0; i < length && U_SUCCESS(status);) {
+        char16_t ch = ops[i++];
+        if (ch == 0) {
+            // Append literal text
+            int32_t literalLength = ops[i++];
+            appendTo.append(ops + i, literalLength);
+            i += literalLength;
+        } else {
+            // Format a repeated pattern character
+            int32_t count = ((int32_t)ops[i] << 16) | ops[i + 1];
+            i += 2;
+            if (!fastSubFormat(appendTo, ch, count, fieldNum, fastDigits, fastMonths,
+                               handler, *workCal, status)) {
+                subFormat(appendTo, ch, count, capitalizationContext, fieldNum,
+                          ch, handler, *workCal, status);
             }
-        }
-        else if (!inQuote && isSyntaxChar(ch)) {
-            // ch is a date-time pattern character to be interpreted
-            // by subFormat(); count the number of times it is repeated
-            prevCh = ch;
-            ++count;
-        }
-        else {
-            // Append quoted characters and unquoted non-pattern characters
-            appendTo += ch;
+            ++fieldNum;
         }
     }
 
-    // Format the last item in the pattern, if any
-    if (count > 0) {
-        subFormat(appendTo, prevCh, count, capitalizationContext, fieldNum++,
-                  prevCh, handler, *workCal, status);
-    }
-
     if (calClone != NULL) {
         delete calClone;
     }
@@ -1248,6 +1237,19 @@ void SimpleDateFormat::initFastNumberFormatters(UErrorCode& status) {
     fFastNumberFormatters[SMPDTFMT_NF_3x10] = createFastFormatter(df, 3, 10, status);
     fFastNumberFormatters[SMPDTFMT_NF_4x10] = createFastFormatter(df, 4, 10, status);
     fFastNumberFormatters[SMPDTFMT_NF_2x2] = createFastFormatter(df, 2, 2, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    // Check that the fast formatters write nothing but ASCII digits, with the
+    // expected padding and truncation.
+    UnicodeString digits;
+    zeroPaddingNumber(fNumberFormat, digits, 1234567890, 1, 10);
+    zeroPaddingNumber(fNumberFormat, digits, 5, 2, 10);
+    zeroPaddingNumber(fNumberFormat, digits, 7, 3, 10);
+    zeroPaddingNumber(fNumberFormat, digits, 0, 4, 10);
+    zeroPaddingNumber(fNumberFormat, digits, 1998, 2, 2);
+    fHasASCIIDigits = digits == UNICODE_STRING_SIMPLE("123456789005007000098");
 }
 
 void SimpleDateFormat::freeFastNumberFormatters() {
@@ -1261,6 +1263,7 @@ void SimpleDateFormat::freeFastNumberFormatters() {
     fFastNumberFormatters[SMPDTFMT_NF_3x10] = nullptr;
     fFastNumberFormatters[SMPDTFMT_NF_4x10] = nullptr;
     fFastNumberFormatters[SMPDTFMT_NF_2x2] = nullptr;
+    fHasASCIIDigits = FALSE;
 }
 
 
@@ -2007,6 +2010,120 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
     handler.addAttribute(DateFormatSymbols::getPatternCharIndex(fieldToOutput), beginOffset, appendTo.length());
 }
 
+//---------------------------------------------------------------------
+
+/**
+ * Append value as ASCII digits, zero-padded to minDigits (at most 10).
+ */
+static inline void
+_appendDigits(UnicodeString& dst, int32_t value, int32_t minDigits) {
+    U_ASSERT(value >= 0 && minDigits <= 10);
+    char16_t digits[10];
+    int32_t start = UPRV_LENGTHOF(digits);
+    do {
+        digits[--start] = (char16_t)(u'0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (UPRV_LENGTHOF(digits) - start < minDigits) {
+        digits[--start] = u'0';
+    }
+    dst.append(digits + start, UPRV_LENGTHOF(digits) - start);
+}
+
+UBool
+SimpleDateFormat::fastSubFormat(UnicodeString &appendTo,
+                                char16_t ch,
+                                int32_t count,
+                                int32_t fieldNum,
+                                UBool fastDigits,
+                                UBool fastMonths,
+                                FieldPositionHandler& handler,
+                                Calendar& cal,
+                                UErrorCode& status) const
+{
+    UDateFormatField patternCharIndex = DateFormatSymbols::getPatternCharIndex(ch);
+    // Symbols may need titlecasing if they come first.
+    UBool fastSymbols = fieldNum != 0 || fCapitalizationBrkIter == NULL;
+    // The digits are only written directly for the field lengths that
+    // initFastNumberFormatters() checked.
+    fastDigits = fastDigits && count <= 4 &&
+        (fSharedNumberFormatters == NULL || fSharedNumberFormatters[patternCharIndex] == NULL);
+
+    int32_t beginOffset = appendTo.length();
+    switch (patternCharIndex) {
+    case UDAT_YEAR_FIELD:
+    case UDAT_DATE_FIELD:
+    case UDAT_HOUR_OF_DAY0_FIELD:
+    case UDAT_MINUTE_FIELD:
+    case UDAT_SECOND_FIELD:
+        {
+            if (!fastDigits) {
+                return FALSE;
+            }
+            int32_t value = cal.get(fgPatternIndexToCalendarField[patternCharIndex], status);
+            if (U_FAILURE(status)) {
+                return TRUE;
+            }
+            if (value < 0) {
+                return FALSE;
+            }
+            if (patternCharIndex == UDAT_YEAR_FIELD && count == 2) {
+                value %= 100;
+            }
+            _appendDigits(appendTo, value, count);
+        }
+        break;
+
+    case UDAT_MONTH_FIELD:
+    case UDAT_STANDALONE_MONTH_FIELD:
+        {
+            if (!fastMonths || count > 4 || (count <= 2 ? !fastDigits : !fastSymbols)) {
+                return FALSE;
+            }
+            int32_t value = cal.get(UCAL_MONTH, status);
+            if (U_FAILURE(status)) {
+                return TRUE;
+            }
+            UBool isFormat = patternCharIndex == UDAT_MONTH_FIELD;
+            if (count == 4) {
+                _appendSymbol(appendTo, value,
+                              isFormat ? fSymbols->fMonths : fSymbols->fStandaloneMonths,
+                              isFormat ? fSymbols->fMonthsCount : fSymbols->fStandaloneMonthsCount);
+            } else if (count == 3) {
+                _appendSymbol(appendTo, value,
+                              isFormat ? fSymbols->fShortMonths : fSymbols->fStandaloneShortMonths,
+                              isFormat ? fSymbols->fShortMonthsCount : fSymbols->fStandaloneShortMonthsCount);
+            } else {
+                _appendDigits(appendTo, value + 1, count);
+            }
+        }
+        break;
+
+    case UDAT_DAY_OF_WEEK_FIELD:
+        {
+            if (!fastSymbols || count > 4) {
+                return FALSE;
+            }
+            int32_t value = cal.get(UCAL_DAY_OF_WEEK, status);
+            if (U_FAILURE(status)) {
+                return TRUE;
+            }
+            if (count == 4) {
+                _appendSymbol(appendTo, value, fSymbols->fWeekdays, fSymbols->fWeekdaysCount);
+            } else {
+                _appendSymbol(appendTo, value, fSymbols->fShortWeekdays, fSymbols->fShortWeekdaysCount);
+            }
+        }
+        break;
+
+    default:
+        return FALSE;
+    }
+
+    handler.addAttribute(patternCharIndex, beginOffset, appendTo.length());
+    return TRUE;
+}
+
 //----------------------------------------------------------------------
 
 void SimpleDateFormat::adoptNumberFormat(NumberFormat *formatToAdopt) {
@@ -2175,6 +2292,206 @@ SimpleDateFormat::isAfterNonNumericField(const UnicodeString &pattern, int32_t p
     return !DateFormatSymbols::isNumericField(f, patternOffset - i);
 }
 
+/**
+ * Gets the time zone format style for an ISO 8601 zone offset field:
+ * X, x, or Z other than ZZZZ (which is the localized GMT format).
+ * Returns FALSE for any other field.
+ */
+static UBool getISOZoneStyle(UDateFormatField patternCharIndex, int32_t count,
+                             UTimeZoneFormatStyle &style) {
+    switch (patternCharIndex) {
+    case UDAT_TIMEZONE_ISO_FIELD: // 'X'
+        switch (count) {
+        case 1:
+            style = UTZFMT_STYLE_ISO_BASIC_SHORT;
+            break;
+        case 2:
+            style = UTZFMT_STYLE_ISO_BASIC_FIXED;
+            break;
+        case 3:
+            style = UTZFMT_STYLE_ISO_EXTENDED_FIXED;
+            break;
+        case 4:
+            style = UTZFMT_STYLE_ISO_BASIC_FULL;
+            break;
+        default:
+            style = UTZFMT_STYLE_ISO_EXTENDED_FULL;
+            break;
+        }
+        return TRUE;
+    case UDAT_TIMEZONE_ISO_LOCAL_FIELD: // 'x'
+        switch (count) {
+        case 1:
+            style = UTZFMT_STYLE_ISO_BASIC_LOCAL_SHORT;
+            break;
+        case 2:
+            style = UTZFMT_STYLE_ISO_BASIC_LOCAL_FIXED;
+            break;
+        case 3:
+            style = UTZFMT_STYLE_ISO_EXTENDED_LOCAL_FIXED;
+            break;
+        case 4:
+            style = UTZFMT_STYLE_ISO_BASIC_LOCAL_FULL;
+            break;
+        default:
+            style = UTZFMT_STYLE_ISO_EXTENDED_LOCAL_FULL;
+            break;
+        }
+        return TRUE;
+    case UDAT_TIMEZONE_RFC_FIELD: // 'Z'
+        // ZZZZ and six or more Z's are localized GMT.
+        if (count == 4 || count > 5) {
+            return FALSE;
+        }
+        style = (count < 4) ? UTZFMT_STYLE_ISO_BASIC_LOCAL_FULL : UTZFMT_STYLE_ISO_EXTENDED_FULL;
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+// The most fields that fastParse() handles in one pattern
+#define FAST_PARSE_MAX_FIELDS 16
+
+// The most digits that fastParse() reads for a number that is not limited by its
+// field width, so that the value fits into an int32_t
+#define FAST_PARSE_MAX_DIGITS 9
+
+UBool
+SimpleDateFormat::fastParse(const UnicodeString& text, int32_t& pos, Calendar& cal,
+                            UTimeZoneFormatTimeType* tzTimeType) const
+{
+    // The numbers must parse just like fNumberFormat would parse them, see subParse().
+    if (!fHasFastParseFields || !fHasASCIIDigits ||
+            !fDateOverride.isBogus() || !fTimeOverride.isBogus() ||
+            fNumberFormat->isGroupingUsed() || !fNumberFormat->isParseIntegerOnly() ||
+            uprv_strcmp(cal.getType(), "gregorian") != 0) {
+        return FALSE;
+    }
+
+    UCalendarDateFields fields[FAST_PARSE_MAX_FIELDS];
+    int32_t values[FAST_PARSE_MAX_FIELDS];
+    int32_t fieldCount = 0;
+    LocalPointer<TimeZone> zone;
+
+    const char16_t* chars = text.getBuffer();
+    int32_t textLength = text.length();
+    int32_t index = pos;
+    UBool prevNumeric = FALSE;
+
+    // loop through the operations of the compiled pattern, see parsePattern()
+    const char16_t* ops = fCompiledPattern.getBuffer();
+    int32_t length = fCompiledPattern.length();
+    for (int32_t i = 0; i < length;) {
+        char16_t ch = ops[i++];
+        if (ch == 0) {
+            // Match literal text exactly
+            int32_t literalLength = ops[i++];
+            if (textLength - index < literalLength ||
+                    u_memcmp(chars + index, ops + i, literalLength) != 0) {
+                return FALSE;
+            }
+            index += literalLength;
+            i += literalLength;
+            prevNumeric = FALSE;
+            continue;
+        }
+        int32_t count = ((int32_t)ops[i] << 16) | ops[i + 1];
+        i += 2;
+        UDateFormatField patternCharIndex = DateFormatSymbols::getPatternCharIndex(ch);
+
+        UTimeZoneFormatStyle style;
+        if (getISOZoneStyle(patternCharIndex, count, style)) {
+            UErrorCode status = U_ZERO_ERROR;
+            const TimeZoneFormat *tzfmt = tzFormat(status);
+            if (U_FAILURE(status)) {
+                return FALSE;
+            }
+            ParsePosition zonePos(index);
+            zone.adoptInstead(tzfmt->parse(style, text, zonePos, tzTimeType));
+            if (zone.isNull()) {
+                return FALSE;
+            }
+            index = zonePos.getIndex();
+            prevNumeric = FALSE;
+            continue;
+        }
+
+        if (fSharedNumberFormatters != NULL && fSharedNumberFormatters[patternCharIndex] != NULL) {
+            // The field has its own number format.
+            return FALSE;
+        }
+
+        // A run of abutting numeric fields is parsed with the field widths
+        // in the pattern, see parse(); other numbers take all of their digits.
+        UBool abutting = prevNumeric ||
+            (i < length && ops[i] != 0 && isNumeric(ops[i], ((int32_t)ops[i + 1] << 16) | ops[i + 2]));
+        int32_t start = index;
+        int32_t limit = abutting ? start + count : start + FAST_PARSE_MAX_DIGITS;
+        if (limit > textLength) {
+            if (abutting) {
+                return FALSE;
+            }
+            limit = textLength;
+        }
+        int32_t value = 0;
+        while (index < limit && chars[index] >= 0x30 && chars[index] <= 0x39) {
+            value = value * 10 + (chars[index++] - 0x30);
+        }
+        int32_t digits = index - start;
+        if (digits == 0 || (abutting && digits != count) ||
+                (index < textLength && chars[index] >= 0x30 && chars[index] <= 0x39)) {
+            return FALSE;
+        }
+        prevNumeric = TRUE;
+
+        UCalendarDateFields field = fgPatternIndexToCalendarField[patternCharIndex];
+        switch (patternCharIndex) {
+        case UDAT_YEAR_FIELD:
+            if (count < 3 && digits == 2) {
+                // two-digit year, to be adjusted to the default century
+                return FALSE;
+            }
+            break;
+        case UDAT_MONTH_FIELD:
+        case UDAT_STANDALONE_MONTH_FIELD:
+            value -= 1;
+            break;
+        case UDAT_FRACTIONAL_SECOND_FIELD:
+            // Fractional seconds left-justify
+            for (; digits < 3; ++digits) {
+                value *= 10;
+            }
+            for (; digits > 3; --digits) {
+                value /= 10;
+            }
+            break;
+        default:
+            break;
+        }
+        // Values outside of the field range are left to subParse().
+        if (field != UCAL_YEAR &&
+                (value < cal.getMinimum(field) || value > cal.getMaximum(field))) {
+            return FALSE;
+        }
+        if (fieldCount == FAST_PARSE_MAX_FIELDS) {
+            return FALSE;
+        }
+        fields[fieldCount] = field;
+        values[fieldCount++] = value;
+    }
+
+    // The whole pattern matched; set the fields in pattern order, as subParse() would.
+    for (int32_t i = 0; i < fieldCount; ++i) {
+        cal.set(fields[i], values[i]);
+    }
+    if (zone.isValid()) {
+        cal.adoptTimeZone(zone.orphan());
+    }
+    pos = index;
+    return TRUE;
+}
+
 void
 SimpleDateFormat::parse(const UnicodeString& text, Calendar& cal, ParsePosition& parsePos) const
 {
@@ -2193,6 +2510,7 @@ SimpleDateFormat::parse(const UnicodeString& text, Calendar& cal, ParsePosition&
     UBool ambiguousYear[] = { FALSE };
     int32_t saveHebrewMonth = -1;
     int32_t count = 0;
+    int32_t patternStart = 0;
     UTimeZoneFormatTimeType tzTimeType = UTZFMT_TIME_TYPE_UNKNOWN;
 
     // For parsing abutting numeric fields. 'abutPat' is the
@@ -2237,7 +2555,13 @@ SimpleDateFormat::parse(const UnicodeString& text, Calendar& cal, ParsePosition&
         }
     }
 
-    for (int32_t i=0; i<fPattern.length(); ++i) {
+    // Patterns like ISO 8601 ones are usually matched exactly by fastParse(),
+    // and then there is nothing left to do here.
+    if (fastParse(text, pos, *workCal, &tzTimeType)) {
+        patternStart = fPattern.length();
+    }
+
+    for (int32_t i=patternStart; i<fPattern.length(); ++i) {
         UChar ch = fPattern.charAt(i);
 
         // Handle alphabetic field characters.
@@ -3468,8 +3792,8 @@ int32_t SimpleDateFormat::subParse(const UnicodeString& text, int32_t& start, UC
         break;
     case UDAT_TIMEZONE_RFC_FIELD: // 'Z'
         {
-            UTimeZoneFormatStyle style = (count < 4) ?
-                UTZFMT_STYLE_ISO_BASIC_LOCAL_FULL : ((count == 5) ? UTZFMT_STYLE_ISO_EXTENDED_FULL: UTZFMT_STYLE_LOCALIZED_GMT);
+            UTimeZoneFormatStyle style = UTZFMT_STYLE_LOCALIZED_GMT;  // ZZZZ
+            getISOZoneStyle(patternCharIndex, count, style);
             const TimeZoneFormat *tzfmt = tzFormat(status);
             if (U_SUCCESS(status)) {
                 TimeZone *tz = tzfmt->parse(style, text, pos, tzTimeType);
@@ -3534,55 +3858,10 @@ int32_t SimpleDateFormat::subParse(const UnicodeString& text, int32_t& start, UC
             return -start;
         }
     case UDAT_TIMEZONE_ISO_FIELD: // 'X'
-        {
-            UTimeZoneFormatStyle style;
-            switch (count) {
-            case 1:
-                style = UTZFMT_STYLE_ISO_BASIC_SHORT;
-                break;
-            case 2:
-                style = UTZFMT_STYLE_ISO_BASIC_FIXED;
-                break;
-            case 3:
-                style = UTZFMT_STYLE_ISO_EXTENDED_FIXED;
-                break;
-            case 4:
-                style = UTZFMT_STYLE_ISO_BASIC_FULL;
-                break;
-            default:
-                style = UTZFMT_STYLE_ISO_EXTENDED_FULL;
-                break;
-            }
-            const TimeZoneFormat *tzfmt = tzFormat(status);
-            if (U_SUCCESS(status)) {
-                TimeZone *tz = tzfmt->parse(style, text, pos, tzTimeType);
-                if (tz != NULL) {
-                    cal.adoptTimeZone(tz);
-                    return pos.getIndex();
-                }
-            }
-            return -start;
-        }
     case UDAT_TIMEZONE_ISO_LOCAL_FIELD: // 'x'
         {
             UTimeZoneFormatStyle style;
-            switch (count) {
-            case 1:
-                style = UTZFMT_STYLE_ISO_BASIC_LOCAL_SHORT;
-                break;
-            case 2:
-                style = UTZFMT_STYLE_ISO_BASIC_LOCAL_FIXED;
-                break;
-            case 3:
-                style = UTZFMT_STYLE_ISO_EXTENDED_LOCAL_FIXED;
-                break;
-            case 4:
-                style = UTZFMT_STYLE_ISO_BASIC_LOCAL_FULL;
-                break;
-            default:
-                style = UTZFMT_STYLE_ISO_EXTENDED_LOCAL_FULL;
-                break;
-            }
+            getISOZoneStyle(patternCharIndex, count, style);
             const TimeZoneFormat *tzfmt = tzFormat(status);
             if (U_SUCCESS(status)) {
                 TimeZone *tz = tzfmt->parse(style, text, pos, tzTimeType);
@@ -3949,6 +4228,7 @@ SimpleDateFormat::applyLocalizedPattern(const UnicodeString& pattern,
     translatePattern(pattern, fPattern,
                      fSymbols->fLocalPatternChars,
                      UnicodeString(DateFormatSymbols::getPatternUChars()), status);
+    parsePattern();
 }
 
 //----------------------------------------------------------------------
@@ -4295,6 +4575,94 @@ void SimpleDateFormat::parsePattern() {
             }
         }
     }
+
+    // Compile the pattern into fields and literals for format().
+    // This follows the pattern syntax exactly as format() used to, character by character.
+    fCompiledPattern.remove();
+    int32_t literalStart = -1;  // index of the length of the current literal, if any
+    UChar prevCh = 0;
+    int32_t count = 0;
+    inQuote = FALSE;
+    for (int32_t i = 0; i < len; ++i) {
+        UChar ch = fPattern[i];
+
+        // A repeated pattern character is a field
+        // when a different pattern or non-pattern character is seen
+        if (ch != prevCh && count > 0) {
+            fCompiledPattern.append(prevCh).append((UChar)(count >> 16)).append((UChar)count);
+            literalStart = -1;
+            count = 0;
+        }
+        if (ch == QUOTE && !((i+1) < len && fPattern[i+1] == QUOTE)) {
+            inQuote = ! inQuote;
+        }
+        else if (ch != QUOTE && !inQuote && isSyntaxChar(ch)) {
+            // ch is a date-time pattern character to be interpreted
+            // by subFormat(); count the number of times it is repeated
+            prevCh = ch;
+            ++count;
+        }
+        else {
+            // Quoted characters, unquoted non-pattern characters, and
+            // consecutive single quotes (a single quote literal) are literal text
+            if (ch == QUOTE) {
+                ++i;
+            }
+            if (literalStart < 0 || fCompiledPattern[literalStart] == 0xffff) {
+                fCompiledPattern.append((UChar)0).append((UChar)0);
+                literalStart = fCompiledPattern.length() - 1;
+            }
+            fCompiledPattern.append(ch);
+            fCompiledPattern.setCharAt(literalStart, fCompiledPattern[literalStart] + 1);
+        }
+    }
+
+    // The last item in the pattern, if any
+    if (count > 0) {
+        fCompiledPattern.append(prevCh).append((UChar)(count >> 16)).append((UChar)count);
+    }
+
+    // Check whether fastParse() can handle the pattern: numbers for the Gregorian
+    // fields, ISO 8601 zone offsets, and ASCII literal text that the number
+    // parser does not take for part of a number.
+    fHasFastParseFields = TRUE;
+    const char16_t* ops = fCompiledPattern.getBuffer();
+    int32_t length = fCompiledPattern.length();
+    for (int32_t i = 0; i < length && fHasFastParseFields;) {
+        UChar ch = ops[i++];
+        if (ch == 0) {
+            int32_t literalLength = ops[i++];
+            for (int32_t limit = i + literalLength; i < limit; ++i) {
+                UChar c = ops[i];
+                if (c < 0x20 || c > 0x7E || (c >= 0x30 && c <= 0x39) || c == 0x45 || c == 0x65) {
+                    // not ASCII, or a digit, 'E' or 'e'
+                    fHasFastParseFields = FALSE;
+                    break;
+                }
+            }
+            continue;
+        }
+        count = ((int32_t)ops[i] << 16) | ops[i + 1];
+        i += 2;
+        UDateFormatField patternCharIndex = DateFormatSymbols::getPatternCharIndex(ch);
+        UTimeZoneFormatStyle style;
+        switch (patternCharIndex) {
+        case UDAT_YEAR_FIELD:
+        case UDAT_FRACTIONAL_SECOND_FIELD:
+            break;
+        case UDAT_MONTH_FIELD:
+        case UDAT_STANDALONE_MONTH_FIELD:
+        case UDAT_DATE_FIELD:
+        case UDAT_HOUR_OF_DAY0_FIELD:
+        case UDAT_MINUTE_FIELD:
+        case UDAT_SECOND_FIELD:
+            fHasFastParseFields = count <= 2;
+            break;
+        default:
+            fHasFastParseFields = getISOZoneStyle(patternCharIndex, count, style);
+            break;
+        }
+    }
 }
 
 U_NAMESPACE_END
@@ -87,6 +87,8 @@ static char gStrBuf[256];
 #include "unicode/strenum.h"
 #include "uassert.h"
 #include "zonemeta.h"
+#include "sharedobject.h"
+#include "unifiedcache.h"
 
 #define kZONEINFO "zoneinfo64"
 #define kREGIONS  "Regions"
@@ -386,28 +388,116 @@ TimeZone::operator==(const TimeZone& that) const
 // -------------------------------------
 
 namespace {
-TimeZone*
-createSystemTimeZone(const UnicodeString& id, UErrorCode& ec) {
-    if (U_FAILURE(ec)) {
-        return NULL;
+
+/**
+ * A system time zone loaded from the zoneinfo64 data, shared through the
+ * UnifiedCache.  The zone is never modified after it is created, so that
+ * any number of threads can clone it at the same time.  The clones share
+ * the transition data, which aliases the resource bundle.
+ */
+class SharedOlsonTimeZone : public SharedObject {
+public:
+    SharedOlsonTimeZone(OlsonTimeZone *zone) : fZone(zone) {}
+    virtual ~SharedOlsonTimeZone();
+    const OlsonTimeZone *get() const { return fZone; }
+private:
+    OlsonTimeZone *fZone;
+};
+
+SharedOlsonTimeZone::~SharedOlsonTimeZone() {
+    delete fZone;
+}
+
+/**
+ * Cache key for SharedOlsonTimeZone, which is the zone ID as given to
+ * createTimeZone().  Links are not resolved, because the ID of the
+ * returned zone must be the one the caller asked for.
+ */
+class SystemTimeZoneCacheKey : public CacheKey<SharedOlsonTimeZone> {
+public:
+    SystemTimeZoneCacheKey(const UnicodeString &id) : fID(id) {}
+    SystemTimeZoneCacheKey(const SystemTimeZoneCacheKey &other)
+            : CacheKey<SharedOlsonTimeZone>(other), fID(other.fID) {}
+    virtual ~SystemTimeZoneCacheKey();
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)CacheKey<SharedOlsonTimeZone>::hashCode() +
+                         (uint32_t)fID.hashCode());
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!CacheKey<SharedOlsonTimeZone>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        return static_cast<const SystemTimeZoneCacheKey &>(other).fID == fID;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new SystemTimeZoneCacheKey(*this);
+    }
+    virtual const SharedOlsonTimeZone *createObject(const void * /*unused*/,
+                                                    UErrorCode &ec) const;
+    virtual char *writeDescription(char *buffer, int32_t bufLen) const {
+        fID.extract(0, fID.length(), buffer, bufLen - 1, US_INV);
+        buffer[bufLen - 1] = 0;
+        return buffer;
     }
-    TimeZone* z = 0;
+private:
+    UnicodeString fID;
+};
+
+SystemTimeZoneCacheKey::~SystemTimeZoneCacheKey() {
+}
+
+const SharedOlsonTimeZone *
+SystemTimeZoneCacheKey::createObject(const void * /*unused*/, UErrorCode &ec) const {
+    LocalPointer<OlsonTimeZone> z;
     StackUResourceBundle res;
     U_DEBUG_TZ_MSG(("pre-err=%s\n", u_errorName(ec)));
-    UResourceBundle *top = openOlsonResource(id, res.ref(), ec);
+    UResourceBundle *top = openOlsonResource(fID, res.ref(), ec);
     U_DEBUG_TZ_MSG(("post-err=%s\n", u_errorName(ec)));
     if (U_SUCCESS(ec)) {
-        z = new OlsonTimeZone(top, res.getAlias(), id, ec);
-        if (z == NULL) {
-            ec = U_MEMORY_ALLOCATION_ERROR;
+        z.adoptInsteadAndCheckErrorCode(new OlsonTimeZone(top, res.getAlias(), fID, ec), ec);
+        if (U_FAILURE(ec)) {
             U_DEBUG_TZ_MSG(("cstz: olson time zone failed to initialize - err %s\n", u_errorName(ec)));
         }
     }
     ures_close(top);
+    if (U_FAILURE(ec)) {
+        return NULL;
+    }
+    SharedOlsonTimeZone *result = new SharedOlsonTimeZone(z.getAlias());
+    if (result == NULL) {
+        ec = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    z.orphan();
+    result->addRef();
+    return result;
+}
+
+TimeZone*
+createSystemTimeZone(const UnicodeString& id, UErrorCode& ec) {
+    if (U_FAILURE(ec)) {
+        return NULL;
+    }
+    // The zone data and rules are loaded only once per ID; every later
+    // request for the same ID just copies the shared zone.
+    const UnifiedCache *cache = UnifiedCache::getInstance(ec);
+    if (U_FAILURE(ec)) {
+        return NULL;
+    }
+    const SharedOlsonTimeZone *shared = NULL;
+    cache->get(SystemTimeZoneCacheKey(id), shared, ec);
     if (U_FAILURE(ec)) {
         U_DEBUG_TZ_MSG(("cstz: failed to create, err %s\n", u_errorName(ec)));
-        delete z;
-        z = NULL;
+        return NULL;
+    }
+    TimeZone* z = shared->get()->clone();
+    shared->removeRef();
+    if (z == NULL) {
+        ec = U_MEMORY_ALLOCATION_ERROR;
     }
     return z;
 }
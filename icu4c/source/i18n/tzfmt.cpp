@@ -2789,6 +2789,7 @@ static void U_CALLCONV initZoneIdTrie(UErrorCode &status) {
         }
     }
     delete tzenum;
+    gZoneIdTrie->freeze(status);
 }
 
 
@@ -2836,6 +2837,7 @@ static void U_CALLCONV initShortZoneIdTrie(UErrorCode &status) {
                     gShortZoneIdTrie->put(shortID, const_cast<UChar *>(uID), status);
                 }
             }
+            gShortZoneIdTrie->freeze(status);
         }
     }
     delete tzenum;
@@ -16,6 +16,8 @@
 #if !UCONFIG_NO_FORMATTING
 
 #include "unicode/strenum.h"
+#include "unicode/ucharstrie.h"
+#include "unicode/ucharstriebuilder.h"
 #include "unicode/ustring.h"
 #include "unicode/timezone.h"
 #include "unicode/utf16.h"
@@ -175,7 +177,8 @@ TextTrieMapSearchResultHandler::~TextTrieMapSearchResultHandler(){
 // ---------------------------------------------------
 TextTrieMap::TextTrieMap(UBool ignoreCase, UObjectDeleter *valueDeleter)
 : fIgnoreCase(ignoreCase), fNodes(NULL), fNodesCapacity(0), fNodesCount(0), 
-  fLazyContents(NULL), fIsEmpty(TRUE), fValueDeleter(valueDeleter) {
+  fLazyContents(NULL), fIsEmpty(TRUE), fValueDeleter(valueDeleter),
+  fValueNodes(NULL), fValueNodesCount(0) {
 }
 
 TextTrieMap::~TextTrieMap() {
@@ -184,6 +187,10 @@ TextTrieMap::~TextTrieMap() {
         fNodes[index].deleteValues(fValueDeleter);
     }
     uprv_free(fNodes);
+    for (index = 0; index < fValueNodesCount; ++index) {
+        fValueNodes[index].deleteValues(fValueDeleter);
+    }
+    uprv_free(fValueNodes);
     if (fLazyContents != NULL) {
         for (int32_t i=0; i<fLazyContents->size(); i+=2) {
             if (fValueDeleter) {
@@ -244,18 +251,26 @@ TextTrieMap::put(const UChar *key, void *value, UErrorCode &status) {
     fLazyContents->addElement(value, status);
 }
 
-void
-TextTrieMap::putImpl(const UnicodeString &key, void *value, UErrorCode &status) {
+UBool
+TextTrieMap::initNodes(UErrorCode &status) {
     if (fNodes == NULL) {
         fNodesCapacity = 512;
         fNodes = (CharacterNode *)uprv_malloc(fNodesCapacity * sizeof(CharacterNode));
         if (fNodes == NULL) {
             status = U_MEMORY_ALLOCATION_ERROR;
-            return;
+            return FALSE;
         }
         fNodes[0].clear();  // Init root node.
         fNodesCount = 1;
     }
+    return TRUE;
+}
+
+void
+TextTrieMap::putImpl(const UnicodeString &key, void *value, UErrorCode &status) {
+    if (!initNodes(status)) {
+        return;
+    }
 
     UnicodeString foldedKey;
     const UChar *keyBuffer;
@@ -364,8 +379,16 @@ TextTrieMap::getChildNode(CharacterNode *parent, UChar c) const {
 //               saved at the time the ZoneStringFormatter was created.  The Trie is only
 //               needed for parsing operations, which are less common than formatting,
 //               and the Trie is big, which is why its creation is deferred until first use.
+//               A frozen map that got more keys with put() is thawed, built, and frozen again.
 void TextTrieMap::buildTrie(UErrorCode &status) {
     if (fLazyContents != NULL) {
+        UBool wasFrozen = fValueNodes != NULL;
+        if (wasFrozen) {
+            thaw(status);
+            if (U_FAILURE(status)) {
+                return;
+            }
+        }
         for (int32_t i=0; i<fLazyContents->size(); i+=2) {
             const UChar *key = (UChar *)fLazyContents->elementAt(i);
             void  *val = fLazyContents->elementAt(i+1);
@@ -374,12 +397,20 @@ void TextTrieMap::buildTrie(UErrorCode &status) {
         }
         delete fLazyContents;
         fLazyContents = NULL; 
+        if (wasFrozen) {
+            freeze(status);
+        }
     }
 }
 
 void
 TextTrieMap::search(const UnicodeString &text, int32_t start,
                   TextTrieMapSearchResultHandler *handler, UErrorCode &status) const {
+    if (fValueNodes != NULL && fLazyContents == NULL) {
+        // Frozen, no lazy initialization left to do.
+        searchFrozen(text, start, handler, status);
+        return;
+    }
     {
         // TODO: if locking the mutex for each check proves to be a performance problem,
         //       add a flag of type atomic_int32_t to class TextTrieMap, and use only
@@ -396,6 +427,11 @@ TextTrieMap::search(const UnicodeString &text, int32_t start,
             nonConstThis->buildTrie(status);
         }
     }
+    if (fValueNodes != NULL) {
+        // Keys were put after freeze(); the map has been frozen again.
+        searchFrozen(text, start, handler, status);
+        return;
+    }
     if (fNodes == NULL) {
         return;
     }
@@ -442,6 +478,154 @@ TextTrieMap::search(CharacterNode *node, const UnicodeString &text, int32_t star
     }
 }
 
+// freeze() - Once all keys are known, the node structure is replaced by a
+//            UCharsTrie, which is much smaller and faster to walk.  Each key's
+//            values are moved into a node of fValueNodes, so that the search
+//            result handlers see the same CharacterNode interface as before.
+//            The trie is built here rather than at data-build time because the
+//            keys are only known after the names have been loaded from the
+//            locale's resource bundles, which costs far more than freezing.
+void TextTrieMap::freeze(UErrorCode &status) {
+    if (U_FAILURE(status) || fValueNodes != NULL) {
+        return;
+    }
+    buildTrie(status);
+    if (U_FAILURE(status) || fNodes == NULL) {
+        return;
+    }
+    int32_t count = 0;
+    for (int32_t index = 0; index < fNodesCount; ++index) {
+        if (fNodes[index].hasValues()) {
+            ++count;
+        }
+    }
+    if (count == 0) {
+        return;
+    }
+    fValueNodes = (CharacterNode *)uprv_malloc(count * sizeof(CharacterNode));
+    if (fValueNodes == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    UCharsTrieBuilder builder(status);
+    UnicodeString key;
+    addFrozenKeys(fNodes, key, builder, status);
+    if (U_SUCCESS(status)) {
+        // The built string aliases the builder's buffer; keep our own copy.
+        UnicodeString trieUChars;
+        builder.buildUnicodeString(USTRINGTRIE_BUILD_SMALL, trieUChars, status);
+        if (U_SUCCESS(status)) {
+            fFrozenTrie.setTo(trieUChars.getBuffer(), trieUChars.length());
+            if (fFrozenTrie.isBogus()) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+            }
+        }
+    }
+    if (U_FAILURE(status)) {
+        // The values are still owned by fNodes.
+        uprv_free(fValueNodes);
+        fValueNodes = NULL;
+        fValueNodesCount = 0;
+        return;
+    }
+    // fValueNodes owns the values now.
+    uprv_free(fNodes);
+    fNodes = NULL;
+    fNodesCapacity = 0;
+    fNodesCount = 0;
+}
+
+// thaw() - Turns a frozen map back into the node structure, so that keys put
+//          after freeze() can be added. The values move back into the nodes.
+void TextTrieMap::thaw(UErrorCode &status) {
+    if (U_FAILURE(status) || fValueNodes == NULL || !initNodes(status)) {
+        return;
+    }
+    // First create the nodes for all of the keys, then move the values, so that
+    // a failure leaves every value in exactly one place.
+    LocalMemory<int32_t> nodeIndexes;
+    if (nodeIndexes.allocateInsteadAndReset(fValueNodesCount) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    UCharsTrie::Iterator iter(fFrozenTrie.getBuffer(), 0, status);
+    while (iter.next(status)) {
+        const UnicodeString &key = iter.getString();
+        CharacterNode *node = fNodes;
+        for (int32_t index = 0; index < key.length() && node != NULL; ++index) {
+            node = addChildNode(node, key.charAt(index), status);
+        }
+        if (U_FAILURE(status)) {
+            return;
+        }
+        nodeIndexes[iter.getValue()] = (int32_t)(node - fNodes);
+    }
+    if (U_FAILURE(status)) {
+        return;
+    }
+    for (int32_t index = 0; index < fValueNodesCount; ++index) {
+        CharacterNode *node = fNodes + nodeIndexes[index];
+        node->fValues = fValueNodes[index].fValues;
+        node->fHasValuesVector = fValueNodes[index].fHasValuesVector;
+    }
+    uprv_free(fValueNodes);
+    fValueNodes = NULL;
+    fValueNodesCount = 0;
+    fFrozenTrie.remove();
+}
+
+void
+TextTrieMap::addFrozenKeys(const CharacterNode *parent, UnicodeString &key,
+                           UCharsTrieBuilder &builder, UErrorCode &status) {
+    uint16_t nodeIndex = parent->fFirstChild;
+    while (nodeIndex > 0 && U_SUCCESS(status)) {
+        const CharacterNode *node = fNodes + nodeIndex;
+        key.append(node->fCharacter);
+        if (node->hasValues()) {
+            fValueNodes[fValueNodesCount] = *node;
+            builder.add(key, fValueNodesCount++, status);
+        }
+        addFrozenKeys(node, key, builder, status);
+        key.truncate(key.length() - 1);
+        nodeIndex = node->fNextSibling;
+    }
+}
+
+void
+TextTrieMap::searchFrozen(const UnicodeString &text, int32_t start,
+                          TextTrieMapSearchResultHandler *handler, UErrorCode &status) const {
+    UCharsTrie trie(fFrozenTrie.getBuffer());
+    int32_t index = start;
+    while (index < text.length() && U_SUCCESS(status)) {
+        UStringTrieResult result;
+        if (fIgnoreCase) {
+            UChar32 c32 = text.char32At(index);
+            index += U16_LENGTH(c32);
+            if (c32 < 0x80) {
+                // ASCII case folding is just lowercasing.
+                result = trie.next((c32 >= 0x41 && c32 <= 0x5A) ? c32 + 0x20 : c32);
+            } else {
+                UnicodeString tmp(c32);
+                tmp.foldCase();
+                result = USTRINGTRIE_NO_MATCH;
+                for (int32_t tmpidx = 0; tmpidx < tmp.length(); ++tmpidx) {
+                    result = trie.next(tmp.charAt(tmpidx));
+                }
+            }
+        } else {
+            result = trie.next(text.charAt(index++));
+        }
+        if (USTRINGTRIE_HAS_VALUE(result)) {
+            if (!handler->handleMatch(index - start, fValueNodes + trie.getValue(), status)) {
+                return;
+            }
+        }
+        if (!USTRINGTRIE_HAS_NEXT(result)) {
+            return;
+        }
+    }
+}
+
 // ---------------------------------------------------
 // ZNStringPool class implementation
 // ---------------------------------------------------
@@ -1024,7 +1208,8 @@ TimeZoneNamesImpl::TimeZoneNamesImpl(const Locale& locale, UErrorCode& status)
   fMZNamesMap(NULL),
   fNamesTrieFullyLoaded(FALSE),
   fNamesFullyLoaded(FALSE),
-  fNamesTrie(TRUE, deleteZNameInfo) {
+  fNamesTrie(TRUE, deleteZNameInfo),
+  fNamesTrieMapsCount(0) {
     initialize(locale, status);
 }
 
@@ -1360,10 +1545,17 @@ TimeZoneNamesImpl::find(const UnicodeString& text, int32_t start, uint32_t types
     {
         Mutex lock(&gDataMutex);
 
+        // Names loaded since the full load, for zones that are not in the set of
+        // canonical zones it covers, still go into the trie.
+        if (fNamesTrieFullyLoaded &&
+                uhash_count(fTZNamesMap) + uhash_count(fMZNamesMap) != fNamesTrieMapsCount) {
+            nonConstThis->addAllNamesIntoTrie(status);
+        }
+
         // First try of lookup.
         matches = doFind(handler, text, start, status);
         if (U_FAILURE(status)) { return NULL; }
-        if (matches != NULL) {
+        if (matches != NULL || fNamesTrieFullyLoaded) {
             return matches;
         }
 
@@ -1385,6 +1577,9 @@ TimeZoneNamesImpl::find(const UnicodeString& text, int32_t start, uint32_t types
         nonConstThis->internalLoadAllDisplayNames(status);
         nonConstThis->addAllNamesIntoTrie(status);
         nonConstThis->fNamesTrieFullyLoaded = TRUE;
+        // Names are only added after this for zones loaded later, which is rare;
+        // the trie is then rebuilt by its next search.
+        nonConstThis->fNamesTrie.freeze(status);
         if (U_FAILURE(status)) { return NULL; }
 
         // Third try: we must return this one.
@@ -1432,6 +1627,7 @@ void TimeZoneNamesImpl::addAllNamesIntoTrie(UErrorCode& status) {
         znames->addAsTimeZoneIntoTrie(tzID, fNamesTrie, status);
         if (U_FAILURE(status)) { return; }
     }
+    fNamesTrieMapsCount = uhash_count(fTZNamesMap) + uhash_count(fMZNamesMap);
 }
 
 U_CDECL_BEGIN
@@ -2116,6 +2312,7 @@ static void U_CALLCONV prepareFind(UErrorCode &status) {
         }
     }
     delete mzIDs;
+    gTZDBNamesTrie->freeze(status);
 
     if (U_FAILURE(status)) {
         delete gTZDBNamesTrie;
@@ -32,6 +32,8 @@
 
 U_NAMESPACE_BEGIN
 
+class UCharsTrieBuilder;
+
 /*
  * ZNStringPool    Pool of (UChar *) strings.  Provides for sharing of repeated
  *                 zone strings.
@@ -141,6 +143,15 @@ class U_I18N_API TextTrieMap : public UMemory {
         TextTrieMapSearchResultHandler *handler, UErrorCode& status) const;
     int32_t isEmpty() const;
 
+    /**
+     * Replaces the node structure with a compact, read-only UCharsTrie.
+     * Call this once all keys have been put.  Keys that are still put
+     * afterwards are added by the next search(), which rebuilds the node
+     * structure and freezes the map again.  The caller must make sure that
+     * no search() runs concurrently with freeze() or put().
+     */
+    void freeze(UErrorCode &status);
+
 private:
     UBool           fIgnoreCase;
     CharacterNode   *fNodes;
@@ -151,14 +162,26 @@ class U_I18N_API TextTrieMap : public UMemory {
     UBool           fIsEmpty;
     UObjectDeleter  *fValueDeleter;
 
+    // After freeze(): the serialized UCharsTrie, whose values are indexes
+    // into fValueNodes.  Those nodes only hold the values of one key each.
+    UnicodeString   fFrozenTrie;
+    CharacterNode   *fValueNodes;
+    int32_t         fValueNodesCount;
+
+    UBool initNodes(UErrorCode &status);
     UBool growNodes();
     CharacterNode* addChildNode(CharacterNode *parent, UChar c, UErrorCode &status);
     CharacterNode* getChildNode(CharacterNode *parent, UChar c) const;
 
     void putImpl(const UnicodeString &key, void *value, UErrorCode &status);
     void buildTrie(UErrorCode &status);
+    void thaw(UErrorCode &status);
     void search(CharacterNode *node, const UnicodeString &text, int32_t start,
         int32_t index, TextTrieMapSearchResultHandler *handler, UErrorCode &status) const;
+    void searchFrozen(const UnicodeString &text, int32_t start,
+        TextTrieMapSearchResultHandler *handler, UErrorCode &status) const;
+    void addFrozenKeys(const CharacterNode *parent, UnicodeString &key,
+        UCharsTrieBuilder &builder, UErrorCode &status);
 };
 
 
@@ -211,6 +234,8 @@ class TimeZoneNamesImpl : public TimeZoneNames {
     UBool fNamesTrieFullyLoaded;
     UBool fNamesFullyLoaded;
     TextTrieMap fNamesTrie;
+    // Number of entries in fTZNamesMap and fMZNamesMap when addAllNamesIntoTrie() last ran.
+    int32_t fNamesTrieMapsCount;
 
     void initialize(const Locale& locale, UErrorCode& status);
     void cleanup();
@@ -170,6 +170,26 @@ ucsdet_enableInputFilter(UCharsetDetector *ucsd, UBool filter)
     return prev;
 }
 
+U_CAPI void U_EXPORT2
+ucsdet_setStopConfidence(UCharsetDetector *ucsd, int32_t confidence, UErrorCode *status)
+{
+    if(U_FAILURE(*status)) {
+        return;
+    }
+
+    ((CharsetDetector *) ucsd)->setStopConfidence(confidence, *status);
+}
+
+U_CAPI void U_EXPORT2
+ucsdet_setInputLimit(UCharsetDetector *ucsd, int32_t limit, UErrorCode *status)
+{
+    if(U_FAILURE(*status)) {
+        return;
+    }
+
+    ((CharsetDetector *) ucsd)->setInputLimit(limit, *status);
+}
+
 U_CAPI  int32_t U_EXPORT2
 ucsdet_getUChars(const UCharsetMatch *ucsm,
                  UChar *buf, int32_t cap, UErrorCode *status)
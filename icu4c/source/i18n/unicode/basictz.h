@@ -173,6 +173,44 @@ class U_I18N_API BasicTimeZone: public TimeZone {
     virtual void getOffsetFromLocal(UDate date, int32_t nonExistingTimeOpt, int32_t duplicatedTimeOpt,
         int32_t& rawOffset, int32_t& dstOffset, UErrorCode& status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Gets the raw and daylight savings offsets for an array of UTC times.
+     * The result for each time is the same as from
+     * <code>getOffset(dates[i], FALSE, rawOffsets[i], dstOffsets[i], status)</code>.
+     * Offsets are reused while consecutive times stay between the same two
+     * time zone transitions, so sorted or clustered input is converted much
+     * faster than by calling getOffset() for each time.
+     * @param dates         The UTC times, in milliseconds since the epoch.
+     * @param count         The number of times.
+     * @param rawOffsets    Receives count raw offsets, in milliseconds.
+     * @param dstOffsets    Receives count daylight savings offsets, in milliseconds.
+     * @param status        Receives error status code.
+     * @draft ICU 68
+     */
+    void getOffsets(const UDate* dates, int32_t count,
+        int32_t* rawOffsets, int32_t* dstOffsets, UErrorCode& status) const;
+
+    /**
+     * Gets the raw and daylight savings offsets for an array of local wall
+     * times.  The result for each time is the same as from getOffsetFromLocal()
+     * with the same options.  Like getOffsets(), this is fastest for sorted
+     * or clustered input.
+     * @param dates         The local wall times, in milliseconds since the epoch.
+     * @param count         The number of times.
+     * @param nonExistingTimeOpt    How to resolve local times skipped by a transition.
+     * @param duplicatedTimeOpt     How to resolve local times repeated by a transition.
+     * @param rawOffsets    Receives count raw offsets, in milliseconds.
+     * @param dstOffsets    Receives count daylight savings offsets, in milliseconds.
+     * @param status        Receives error status code.  U_UNSUPPORTED_ERROR if
+     *                      this time zone does not support local time lookups.
+     * @draft ICU 68
+     */
+    void getOffsetsFromLocal(const UDate* dates, int32_t count,
+        UTimeZoneLocalOption nonExistingTimeOpt, UTimeZoneLocalOption duplicatedTimeOpt,
+        int32_t* rawOffsets, int32_t* dstOffsets, UErrorCode& status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
 protected:
 
 #ifndef U_HIDE_INTERNAL_API
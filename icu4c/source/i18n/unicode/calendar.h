@@ -1503,6 +1503,19 @@ class U_I18N_API Calendar : public UObject {
      */
     virtual void computeFields(UErrorCode& status);
 
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Discards the time zone offsets and the date fields that computeFields()
+     * caches for nearby times. Subclasses must call this when they change a
+     * setting that affects handleComputeFields(), or when they change state
+     * that handleComputeFields() would otherwise recompute. When called from
+     * handleComputeFields(), the fields it computes are not cached; this is
+     * for calendars whose fields depend on the time of day.
+     * @internal
+     */
+    void invalidateFieldsCache();
+#endif  /* U_HIDE_INTERNAL_API */
+
     /**
      * Gets this Calendar's current time as a long.
      *
@@ -2248,6 +2261,61 @@ class U_I18N_API Calendar : public UObject {
      */
     int32_t fGregorianDayOfMonth;
 
+    /**
+     * The time zone offsets used by the last computeFields() call, and the
+     * range of times [fOffsetCacheStart, fOffsetCacheLimit) between two
+     * zone transitions for which they are valid. The range is empty when
+     * nothing is cached.
+     * @see #computeFields
+     */
+    UDate fOffsetCacheStart;
+    UDate fOffsetCacheLimit;
+    int32_t fOffsetCacheRawOffset;
+    int32_t fOffsetCacheDstOffset;
+
+    /**
+     * The time of the last offset lookup that missed the cache. The zone
+     * transitions are only looked up when two lookups are less than a day
+     * apart, so that unrelated times do not pay for them.
+     */
+    UDate fOffsetCacheMissTime;
+
+    /**
+     * The fields, stamps and Gregorian values computed by the last full
+     * computeFields() call for the local Julian day fFieldsCacheJulianDay,
+     * before the time-of-day fields were set. computeFields() copies them
+     * instead of calling handleComputeFields() again for the same day.
+     * @see #computeFields
+     */
+    UBool fFieldsCacheValid;
+    /**
+     * Cleared by invalidateFieldsCache() while the date fields are computed,
+     * if they cannot be reused for other times on the same day.
+     */
+    UBool fFieldsCacheAllowed;
+    int32_t fFieldsCacheJulianDay;
+    int32_t fFieldsCacheFields[UCAL_FIELD_COUNT];
+    int32_t fFieldsCacheStamp[UCAL_FIELD_COUNT];
+    UBool fFieldsCacheIsSet[UCAL_FIELD_COUNT];
+    int32_t fFieldsCacheGregorianYear;
+    int32_t fFieldsCacheGregorianMonth;
+    int32_t fFieldsCacheGregorianDayOfYear;
+    int32_t fFieldsCacheGregorianDayOfMonth;
+
+    /**
+     * Caches the offsets for the zone transition interval containing the
+     * given time, if the time zone can report its transitions and the
+     * previous lookup was for a nearby time.
+     */
+    void cacheOffsets(UDate time, int32_t rawOffset, int32_t dstOffset);
+
+    /**
+     * Computes all fields that depend only on the local Julian day: the
+     * Gregorian and day-of-week fields, the fields set by
+     * handleComputeFields(), and the week fields.
+     */
+    void computeDateFields(int32_t julianDay, UErrorCode &ec);
+
     /* calculations */
 
     /**
@@ -900,6 +900,27 @@ class U_I18N_API DateFormat : public Format {
 
 
     UDisplayContext fCapitalizationContext;
+
+    /**
+     * A clone of fCalendar that format(UDate) reuses from one call to the
+     * next, so that the calendar can keep the fields it computed for the
+     * previous date. NULL while a call is using it. Taken and put back
+     * with atomic operations, so concurrent calls do not block each other.
+     */
+    mutable Calendar* fFormatCalendar;
+
+    /**
+     * Takes fFormatCalendar if it is still equivalent to fCalendar,
+     * otherwise returns a new clone of fCalendar.
+     */
+    Calendar* takeFormatCalendar() const;
+
+    /**
+     * Puts a calendar from takeFormatCalendar() back into fFormatCalendar,
+     * or deletes it if another call has already done that.
+     */
+    void returnFormatCalendar(Calendar* calendar) const;
+
     friend class DateFmtKeyByStyle;
 
 public:
@@ -565,6 +565,10 @@ class U_I18N_API DateTimePatternGenerator : public UObject {
     // When this is set to an error the object is in an invalid state.
     UErrorCode internalErrorCode;
 
+    // The per-locale data this generator was copied from, as long as it is unmodified.
+    // Such generators share the best patterns that any of them have found.
+    const SharedDateTimePatternGenerator *fSharedGenerator;
+
     /* internal flags masks for adjustFieldTypes etc. */
     enum {
         kDTPGNoFlags = 0,
@@ -601,6 +605,10 @@ class U_I18N_API DateTimePatternGenerator : public UObject {
     UBool isCanonicalItem(const UnicodeString& item) const;
     static void U_CALLCONV loadAllowedHourFormatsData(UErrorCode &status);
     void getAllowedHourFormats(const Locale &locale, UErrorCode &status);
+    UnicodeString findBestPattern(const UnicodeString& patternForm, UDateTimePatternMatchOptions options, UErrorCode& status);
+    void releaseSharedGenerator();
+
+    friend class SharedDateTimePatternGenerator;
 
     struct AppendItemFormatsSink;
     struct AppendItemNamesSink;
@@ -157,6 +157,7 @@ struct RangeMacroProps;
 struct UFormattedNumberImpl;
 class MutablePatternModifier;
 class ImmutablePatternModifier;
+class SkeletonFormatterCacheData;
 
 /**
  * Used for NumberRangeFormatter and implemented in numrange_fluent.cpp.
@@ -2281,6 +2282,173 @@ class U_I18N_API LocalizedNumberFormatter
      */
     FormattedNumber formatDecimal(StringPiece value, UErrorCode& status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Format the given integer number into a caller-supplied buffer, using the settings specified in the
+     * NumberFormatter fluent setting chain.
+     *
+     * Unlike formatInt(int64_t, UErrorCode&), this method does not create a FormattedNumber. Once the
+     * formatter has been used a few times, it normally formats without allocating any memory. Use it
+     * where many numbers are formatted and only the strings are needed.
+     *
+     * The string is NUL-terminated if there is room for the terminator. If the buffer is too small,
+     * U_BUFFER_OVERFLOW_ERROR is set and the required length is returned; pass a capacity of 0 to
+     * find the length without formatting into a buffer.
+     *
+     * @param value
+     *            The number to format.
+     * @param dest
+     *            The destination buffer. Can be nullptr if capacity is 0.
+     * @param capacity
+     *            The size of the destination buffer, in char16_t units.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return The length of the formatted string, not counting the NUL terminator.
+     * @draft ICU 68
+     */
+    int32_t formatInt(int64_t value, char16_t* dest, int32_t capacity, UErrorCode& status) const;
+
+    /**
+     * Format the given float or double into a caller-supplied buffer, using the settings specified in
+     * the NumberFormatter fluent setting chain.
+     *
+     * This is the counterpart of formatInt(int64_t, char16_t*, int32_t, UErrorCode&) for doubles;
+     * see there for the handling of the buffer.
+     *
+     * @param value
+     *            The number to format.
+     * @param dest
+     *            The destination buffer. Can be nullptr if capacity is 0.
+     * @param capacity
+     *            The size of the destination buffer, in char16_t units.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return The length of the formatted string, not counting the NUL terminator.
+     * @draft ICU 68
+     */
+    int32_t formatDouble(double value, char16_t* dest, int32_t capacity, UErrorCode& status) const;
+
+    /**
+     * Format the given integer number as UTF-8, using the settings specified in the NumberFormatter
+     * fluent setting chain, and append it to the sink.
+     *
+     * The UTF-8 string is converted from the formatter's internal UTF-16 buffer without an
+     * intermediate copy; no FormattedNumber is created.
+     *
+     * @param value
+     *            The number to format.
+     * @param sink
+     *            The sink receiving the UTF-8 string.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @draft ICU 68
+     */
+    void formatIntToUTF8(int64_t value, ByteSink& sink, UErrorCode& status) const;
+
+    /**
+     * Format the given float or double as UTF-8, using the settings specified in the NumberFormatter
+     * fluent setting chain, and append it to the sink.
+     *
+     * The UTF-8 string is converted from the formatter's internal UTF-16 buffer without an
+     * intermediate copy; no FormattedNumber is created.
+     *
+     * @param value
+     *            The number to format.
+     * @param sink
+     *            The sink receiving the UTF-8 string.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @draft ICU 68
+     */
+    void formatDoubleToUTF8(double value, ByteSink& sink, UErrorCode& status) const;
+
+    /**
+     * Format an array of integers into one caller-supplied buffer, using the settings specified in
+     * the NumberFormatter fluent setting chain.
+     *
+     * The formatted strings are written one after the other, with nothing in between, and
+     * offsets[i] is set to the start of the i-th string in the buffer. offsets[count] is set to the
+     * total length, so the i-th string ends at offsets[i+1]. The same internal buffers are used for
+     * all of the numbers, which makes this faster than formatting them one at a time.
+     *
+     * The buffer is NUL-terminated if there is room for the terminator. If it is too small,
+     * U_BUFFER_OVERFLOW_ERROR is set, the total length is returned, and the offsets are still set,
+     * so that the batch can be formatted again into a large enough buffer.
+     *
+     * If any other error occurs, 0 is returned. The offsets are still all set: those of the
+     * numbers that were formatted as usual, and the others, including offsets[count], to the end
+     * of the last formatted string, so that the numbers that were not formatted read as empty.
+     *
+     * @param values
+     *            The numbers to format.
+     * @param count
+     *            The number of values.
+     * @param dest
+     *            The destination buffer. Can be nullptr if capacity is 0.
+     * @param capacity
+     *            The size of the destination buffer, in char16_t units.
+     * @param offsets
+     *            Receives count+1 offsets into the destination buffer.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return The total length of the formatted strings, not counting the NUL terminator.
+     * @draft ICU 68
+     */
+    int32_t formatIntBatch(const int64_t* values, int32_t count, char16_t* dest, int32_t capacity,
+                           int32_t* offsets, UErrorCode& status) const;
+
+    /**
+     * Format an array of floats or doubles into one caller-supplied buffer, using the settings
+     * specified in the NumberFormatter fluent setting chain.
+     *
+     * This is the counterpart of formatIntBatch() for doubles; see there for the layout of the
+     * buffer and the offsets.
+     *
+     * @param values
+     *            The numbers to format.
+     * @param count
+     *            The number of values.
+     * @param dest
+     *            The destination buffer. Can be nullptr if capacity is 0.
+     * @param capacity
+     *            The size of the destination buffer, in char16_t units.
+     * @param offsets
+     *            Receives count+1 offsets into the destination buffer.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return The total length of the formatted strings, not counting the NUL terminator.
+     * @draft ICU 68
+     */
+    int32_t formatDoubleBatch(const double* values, int32_t count, char16_t* dest, int32_t capacity,
+                              int32_t* offsets, UErrorCode& status) const;
+
+    /**
+     * Format an array of decimal numbers into one caller-supplied buffer, using the settings
+     * specified in the NumberFormatter fluent setting chain.
+     *
+     * This is the counterpart of formatIntBatch() for decimal strings; see there for the layout of
+     * the buffer and the offsets. The syntax of the strings is the same as for formatDecimal().
+     * Formatting stops at the first string that is not a valid decimal number.
+     *
+     * @param values
+     *            The numbers to format, as decimal strings.
+     * @param count
+     *            The number of values.
+     * @param dest
+     *            The destination buffer. Can be nullptr if capacity is 0.
+     * @param capacity
+     *            The size of the destination buffer, in char16_t units.
+     * @param offsets
+     *            Receives count+1 offsets into the destination buffer.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return The total length of the formatted strings, not counting the NUL terminator.
+     * @draft ICU 68
+     */
+    int32_t formatDecimalBatch(const StringPiece* values, int32_t count, char16_t* dest,
+                               int32_t capacity, int32_t* offsets, UErrorCode& status) const;
+#endif  // U_HIDE_DRAFT_API
+
 #ifndef U_HIDE_INTERNAL_API
 
     /** Internal method.
@@ -2402,12 +2570,35 @@ class U_I18N_API LocalizedNumberFormatter
      */
     bool computeCompiled(UErrorCode& status) const;
 
+    void formatToBuilder(impl::DecimalQuantity& quantity, FormattedStringBuilder& string,
+                         UErrorCode& status) const;
+
+    void formatIntToBuilder(int64_t value, FormattedStringBuilder& string, UErrorCode& status) const;
+
+    /**
+     * @return true if the number was formatted with the compiled formatter's fast path for integers.
+     */
+    bool formatSimpleInteger(int64_t value, FormattedStringBuilder& string, UErrorCode& status) const;
+
+    /**
+     * Builds the compiled formatter now, regardless of the call count.
+     */
+    void lnfCompileHelper(UErrorCode& status);
+
+    /**
+     * Shares the compiled formatter of src, which must be compiled.
+     */
+    void lnfShareHelper(const LocalizedNumberFormatter& src);
+
     // To give the fluent setters access to this class's constructor:
     friend class NumberFormatterSettings<UnlocalizedNumberFormatter>;
     friend class NumberFormatterSettings<LocalizedNumberFormatter>;
 
     // To give UnlocalizedNumberFormatter::locale() access to this class's constructor:
     friend class UnlocalizedNumberFormatter;
+
+    // To give NumberFormatter::forSkeleton() access to the compiled formatter:
+    friend class impl::SkeletonFormatterCacheData;
 };
 
 #if (U_PF_WINDOWS <= U_PLATFORM && U_PLATFORM <= U_PF_CYGWIN) && defined(_MSC_VER)
@@ -2625,6 +2816,31 @@ class U_I18N_API NumberFormatter final {
     static UnlocalizedNumberFormatter forSkeleton(const UnicodeString& skeleton,
                                                   UParseError& perror, UErrorCode& status);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Call this method at the beginning of a NumberFormatter fluent chain to create an instance based
+     * on a given number skeleton string and locale.
+     *
+     * The formatter is parsed and compiled only once per skeleton and locale in the process; later
+     * calls with the same arguments, from any thread, share the compiled formatter. The returned
+     * LocalizedNumberFormatter is ready to format without any warm-up calls.
+     *
+     * Settings may be added to the returned formatter as usual. The resulting formatter no longer
+     * shares the compiled formatter.
+     *
+     * @param skeleton
+     *            The skeleton string off of which to base this NumberFormatter.
+     * @param locale
+     *            The locale from which to load formats and symbols for number formatting.
+     * @param status
+     *            Set to U_NUMBER_SKELETON_SYNTAX_ERROR if the skeleton was invalid.
+     * @return A LocalizedNumberFormatter, to be used for formatting or chaining.
+     * @draft ICU 68
+     */
+    static LocalizedNumberFormatter forSkeleton(const UnicodeString& skeleton, const Locale& locale,
+                                                UErrorCode& status);
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Use factory methods instead of the constructor to create a NumberFormatter.
      */
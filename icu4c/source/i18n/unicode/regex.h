@@ -63,6 +63,9 @@ U_NAMESPACE_BEGIN
 
 struct Regex8BitSet;
 class  RegexCImpl;
+class  RegexDFA;
+class  RegexDFACache;
+struct RegexDFAInput;
 class  RegexMatcher;
 class  RegexPattern;
 struct REStackFrame;
@@ -620,11 +623,21 @@ class U_I18N_API RegexPattern U_FINAL : public UObject {
     Regex8BitSet   *fInitialChars8;
     UBool           fNeedsAltInput;
 
+    int32_t         fRequiredStringIdx;   // A literal string, in fLiteralText, that
+    int32_t         fRequiredStringLen;   //   must appear in every match. Length 0 if none.
+    int32_t         fRequiredStringMinOffset; // Bounds on the distance of the required string
+    int32_t         fRequiredStringMaxOffset; //   from the match start, in UTF-16 code units.
+                                              //   The maximum is INT32_MAX if unbounded.
+
     UHashtable     *fNamedCaptureMap;  // Map from capture group names to numbers.
 
+    RegexDFA       *fDFA;          // DFA for matching without backtracking, or NULL if
+                                   //   the pattern is not suitable for one.
+
     friend class RegexCompile;
     friend class RegexMatcher;
     friend class RegexCImpl;
+    friend class RegexDFA;
 
     //
     //  Implementation Methods
@@ -1117,6 +1130,23 @@ class U_I18N_API RegexMatcher U_FINAL : public UObject {
     */
     virtual RegexMatcher &reset(UText *input);
 
+#ifndef U_HIDE_DRAFT_API
+   /**
+    *   Resets this matcher with new UTF-8 input text. Equivalent to reset(UText *)
+    *     with a UText from utext_openUTF8(); for either, find() looks for
+    *     possible match start positions by scanning the UTF-8 bytes directly.
+    *   @param input  The UTF-8 text on which subsequent pattern matches will operate.
+    *                 The matcher retains a pointer to the text; it is essential that the
+    *                 caller not modify or delete it until after regexp operations on it are done.
+    *   @param length The length of the text in bytes, or -1 if it is NUL-terminated.
+    *   @param status A reference to a UErrorCode to receive any errors.
+    *   @return this RegexMatcher.
+    *
+    *   @draft ICU 68
+    */
+    RegexMatcher &resetUTF8(const char *input, int64_t length, UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
   /**
     *  Set the subject text string upon which the regular expression is looking for matches
@@ -1787,6 +1817,15 @@ class U_I18N_API RegexMatcher U_FINAL : public UObject {
     int64_t              appendGroup(int32_t groupNum, UText *dest, UErrorCode &status) const;
     
     UBool                findUsingChunk(UErrorCode &status);
+    UBool                findRequiredString(int64_t &startIdx);
+    UBool                findRequiredStringFrom(int64_t startIdx);
+    UBool                dfaUsable() const;
+    void                 setDFAInput(RegexDFAInput &input) const;
+    UBool                findUsingDFA(int64_t &startPos, int64_t testStartLimit, UErrorCode &status);
+    void                 matchUsingDFA(int64_t startIdx, UBool toEnd, UErrorCode &status);
+    UBool                dfaRulesOutMatch(int64_t startIdx, UBool toEnd, UErrorCode &status);
+    UBool                findUTF8(const uint8_t *input, int64_t startPos, int64_t testStartLimit,
+                                  UErrorCode &status);
     void                 MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &status);
     UBool                isChunkWordBoundary(int32_t pos);
 
@@ -1872,6 +1911,15 @@ class U_I18N_API RegexMatcher U_FINAL : public UObject {
 
     BreakIterator       *fWordBreakItr;
     BreakIterator       *fGCBreakItr;
+
+    RegexDFACache       *fDFACache;        // Lazily built DFA states for the pattern's
+                                           //   RegexDFA, or NULL if it has none.
+
+    const uint8_t       *fInputUTF8;       // The input text bytes, if it is a UText from
+                                           //   utext_openUTF8(), otherwise NULL.
+
+    int64_t             fRequiredStringPos; // Position of the last found occurrence of
+                                           //   the pattern's required string, or -1.
 };
 
 U_NAMESPACE_END
@@ -0,0 +1,186 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*   file name:  regexset.h
+*   encoding:   UTF-8
+*   indentation:4
+*
+*   ICU Regular Expressions, API for matching many patterns at once.
+*/
+
+#ifndef REGEXSET_H
+#define REGEXSET_H
+
+/**
+ * \file
+ * \brief  C++ API:  Matching a set of Regular Expressions in a single pass
+ *
+ * Class `RegexSet` compiles a number of regular expression patterns together,
+ * and reports which of them have a match in an input string.
+ *
+ * Patterns made only of literals, sets, alternation and loops are combined into
+ * a single automaton, and all of them are checked in one scan of the input,
+ * however many there are. Other patterns are matched individually.
+ */
+
+#include "unicode/utypes.h"
+
+#if U_SHOW_CPLUSPLUS_API
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/uobject.h"
+#include "unicode/unistr.h"
+#include "unicode/stringpiece.h"
+#include "unicode/utext.h"
+#include "unicode/parseerr.h"
+
+U_NAMESPACE_BEGIN
+
+class  RegexDFA;
+class  RegexDFACache;
+class  RegexPattern;
+class  UVector;
+class  UVector32;
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * A set of compiled regular expressions, matched together against the same input.
+ *
+ * Use a RegexSet to find out which of many patterns match a string, for example
+ * to classify log lines, without running a separate RegexMatcher::find() for
+ * each pattern.
+ *
+ * A RegexSet keeps state between calls to findAll(), and must not be used
+ * by more than one thread at a time. Class RegexSet is not intended to be
+ * subclassed.
+ *
+ * @draft ICU 68
+ */
+class U_I18N_API RegexSet U_FINAL : public UObject {
+public:
+
+   /**
+    * Compiles a number of regular expressions in string form into a RegexSet.
+    *
+    * @param patterns An array of the regular expressions to be compiled.
+    * @param count    The number of regular expressions.
+    * @param flags    The #URegexpFlag match mode flags to be used for all of the patterns.
+    * @param pe       Receives the position (line and column numbers) of any error
+    *                 within the first regular expression that fails to compile.
+    * @param status   A reference to a UErrorCode to receive any errors.
+    * @return         A RegexSet for the compiled patterns, or NULL on failure.
+    *
+    * @draft ICU 68
+    */
+    static RegexSet * U_EXPORT2 compile(const UnicodeString patterns[],
+        int32_t              count,
+        uint32_t             flags,
+        UParseError          &pe,
+        UErrorCode           &status);
+
+   /**
+    * Destructor.
+    *
+    * @draft ICU 68
+    */
+    virtual ~RegexSet();
+
+   /**
+    * Get the number of patterns in the set.
+    *
+    * @return the number of patterns.
+    * @draft ICU 68
+    */
+    int32_t size() const;
+
+   /**
+    * Get one of the compiled patterns of the set.
+    *
+    * @param index The index of the pattern, in the order it was given to compile().
+    * @return      The compiled pattern. It is owned by the RegexSet.
+    * @draft ICU 68
+    */
+    const RegexPattern &getPattern(int32_t index) const;
+
+   /**
+    * Determine which of the patterns have a match anywhere in the input string.
+    *
+    * @param input   The string to be matched.
+    * @param matched An array of size() UBools. Set TRUE for each pattern
+    *                that has a match in the input, FALSE for the others.
+    * @param status  A reference to a UErrorCode to receive any errors.
+    * @return        The number of patterns with a match.
+    *
+    * @draft ICU 68
+    */
+    int32_t findAll(const UnicodeString &input, UBool *matched, UErrorCode &status);
+
+   /**
+    * Determine which of the patterns have a match anywhere in the input text.
+    * The text may be in any form supported by UText. It is read through the
+    * UText functions; for UTF-8 text, findAllUTF8() is faster.
+    *
+    * @param input   The text to be matched.
+    * @param matched An array of size() UBools. Set TRUE for each pattern
+    *                that has a match in the input, FALSE for the others.
+    * @param status  A reference to a UErrorCode to receive any errors.
+    * @return        The number of patterns with a match.
+    *
+    * @draft ICU 68
+    */
+    int32_t findAll(UText *input, UBool *matched, UErrorCode &status);
+
+   /**
+    * Determine which of the patterns have a match anywhere in the UTF-8 input text.
+    * The text is scanned in place, in its byte buffer.
+    *
+    * @param input   The UTF-8 text to be matched.
+    * @param matched An array of size() UBools. Set TRUE for each pattern
+    *                that has a match in the input, FALSE for the others.
+    * @param status  A reference to a UErrorCode to receive any errors.
+    * @return        The number of patterns with a match.
+    *
+    * @draft ICU 68
+    */
+    int32_t findAllUTF8(StringPiece input, UBool *matched, UErrorCode &status);
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for the actual class.
+     *
+     * @draft ICU 68
+     */
+    virtual UClassID getDynamicClassID() const;
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for this class.
+     *
+     * @draft ICU 68
+     */
+    static UClassID U_EXPORT2 getStaticClassID();
+
+private:
+    RegexSet(UErrorCode &status);
+    RegexSet(const RegexSet &other);              // forbid copying of this class
+    RegexSet &operator=(const RegexSet &other);   // forbid copying of this class
+
+    int32_t findAll(UText *input, const char *inputUTF8, UBool *matched, UErrorCode &status);
+
+    UVector         *fPatterns;     // The compiled patterns, RegexPattern *, owned.
+    UVector         *fMatchers;     // Per pattern, a RegexMatcher if the pattern is checked
+                                    //   with its own matcher, otherwise NULL. Owned.
+    UVector32       *fInDFA;        // Per pattern, 1 if it is part of fDFA, otherwise 0.
+    int32_t          fDFAPatternCount;  // Number of patterns in fDFA.
+    RegexDFA        *fDFA;          // Combined automaton for the patterns it can handle,
+    RegexDFACache   *fDFACache;     //   and its states. NULL if there are none.
+};
+
+#endif  // U_HIDE_DRAFT_API
+
+U_NAMESPACE_END
+#endif  // UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#endif /* U_SHOW_CPLUSPLUS_API */
+
+#endif
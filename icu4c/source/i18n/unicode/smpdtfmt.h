@@ -1279,6 +1279,32 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
                    Calendar& cal,
                    UErrorCode& status) const; // in case of illegal argument
 
+    /**
+     * Used by format() to format common fields without going through subFormat():
+     * year, month, day, hour, minute and second numbers written as ASCII digits,
+     * and month and day-of-week names.
+     *
+     * @param appendTo  Output parameter to receive result.
+     * @param ch        The pattern character.
+     * @param count     Number of characters in the pattern field.
+     * @param fieldNum  Zero-based numbering of current field within the overall format.
+     * @param fastDigits TRUE if numbers may be written as ASCII digits.
+     * @param fastMonths TRUE if the calendar has no special month numbering or names.
+     * @param handler   Records information about field positions.
+     * @param cal       Calendar to use
+     * @param status    Receives a status code.
+     * @return          TRUE if the field was formatted, FALSE if subFormat() must be used.
+     */
+    UBool fastSubFormat(UnicodeString &appendTo,
+                        char16_t ch,
+                        int32_t count,
+                        int32_t fieldNum,
+                        UBool fastDigits,
+                        UBool fastMonths,
+                        FieldPositionHandler& handler,
+                        Calendar& cal,
+                        UErrorCode& status) const;
+
     /**
      * Used by subFormat() to format a numeric value.
      * Appends to toAppendTo a string representation of "value"
@@ -1400,6 +1426,22 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
                                const UnicodeString &text, int32_t &textOffset,
                                UBool whitespaceLenient, UBool partialMatchLenient, UBool oldLeniency);
 
+    /**
+     * Used by parse() to match patterns with only numeric Gregorian fields,
+     * ISO 8601 zone offsets and literal text, such as ISO 8601 and RFC 3339
+     * patterns, without going through subParse(). The text must match the
+     * pattern exactly; anything else is left to the general parse code.
+     * The calendar is only changed if the whole pattern matched.
+     * @param text the text to be parsed.
+     * @param pos on input, where to start parsing; on output, the position
+     *            after the matched text, if the pattern matched.
+     * @param cal the calendar to receive the parsed fields.
+     * @param tzTimeType the type of parsed time zone (output).
+     * @return TRUE if the pattern matched, FALSE otherwise.
+     */
+    UBool fastParse(const UnicodeString& text, int32_t& pos, Calendar& cal,
+                    UTimeZoneFormatTimeType* tzTimeType) const;
+
     /**
      * Private member function that converts the parsed date strings into
      * timeFields. Returns -start (for ParsePosition) if failed.
@@ -1605,7 +1647,19 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
     UBool                fHasHanYearChar; // pattern contains the Han year character \u5E74
 
     /**
-     * Sets fHasMinutes and fHasSeconds.
+     * The pattern compiled into a list of operations for format(), so that it does not
+     * need to re-scan the pattern. A field is its pattern character followed by its count
+     * in two code units; a literal is a zero code unit followed by its length and its text.
+     */
+    UnicodeString        fCompiledPattern;
+
+    /**
+     * TRUE if the pattern only has fields and literal text that fastParse() can match.
+     */
+    UBool                fHasFastParseFields = FALSE;
+
+    /**
+     * Sets fHasMinutes and fHasSeconds, and compiles the pattern into fCompiledPattern.
      */
     void                 parsePattern();
 
@@ -1644,6 +1698,12 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
      */
     const number::LocalizedNumberFormatter* fFastNumberFormatters[SMPDTFMT_NF_COUNT] = {};
 
+    /**
+     * TRUE if the fast number formatters write plain ASCII digits, so that fastSubFormat()
+     * can write them directly.
+     */
+    UBool fHasASCIIDigits = FALSE;
+
     UBool fHaveDefaultCentury;
 
     const BreakIterator* fCapitalizationBrkIter;
@@ -1558,6 +1558,53 @@ U_STABLE UBool U_EXPORT2
 ucal_getTimeZoneTransitionDate(const UCalendar* cal, UTimeZoneTransitionType type,
                                UDate* transition, UErrorCode* status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Options for resolving a local wall time to time zone offsets, used when
+ * the local time is skipped or repeated by a time zone transition.
+ * The FORMER options use the offsets in effect before the transition, the
+ * LATTER options the offsets in effect after it.  The STANDARD and DAYLIGHT
+ * options prefer the standard or the daylight time offsets and only fall
+ * back to FORMER or LATTER when both sides of the transition are standard
+ * time, or both are daylight time.
+ * @see icu::BasicTimeZone::getOffsetsFromLocal
+ * @draft ICU 68
+ */
+enum UTimeZoneLocalOption {
+    /**
+     * Use the offsets in effect before the transition.
+     * @draft ICU 68
+     */
+    UCAL_TZ_LOCAL_FORMER = 0x04,
+    /**
+     * Use the offsets in effect after the transition.
+     * @draft ICU 68
+     */
+    UCAL_TZ_LOCAL_LATTER = 0x0C,
+    /**
+     * Prefer standard time, otherwise UCAL_TZ_LOCAL_FORMER.
+     * @draft ICU 68
+     */
+    UCAL_TZ_LOCAL_STANDARD_FORMER = UCAL_TZ_LOCAL_FORMER | 0x01,
+    /**
+     * Prefer standard time, otherwise UCAL_TZ_LOCAL_LATTER.
+     * @draft ICU 68
+     */
+    UCAL_TZ_LOCAL_STANDARD_LATTER = UCAL_TZ_LOCAL_LATTER | 0x01,
+    /**
+     * Prefer daylight time, otherwise UCAL_TZ_LOCAL_FORMER.
+     * @draft ICU 68
+     */
+    UCAL_TZ_LOCAL_DAYLIGHT_FORMER = UCAL_TZ_LOCAL_FORMER | 0x03,
+    /**
+     * Prefer daylight time, otherwise UCAL_TZ_LOCAL_LATTER.
+     * @draft ICU 68
+     */
+    UCAL_TZ_LOCAL_DAYLIGHT_LATTER = UCAL_TZ_LOCAL_LATTER | 0x03
+};
+typedef enum UTimeZoneLocalOption UTimeZoneLocalOption; /**< @draft ICU 68 */
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
 * Converts a system time zone ID to an equivalent Windows time zone ID. For example,
 * Windows time zone ID "Pacific Standard Time" is returned for input "America/Los_Angeles".
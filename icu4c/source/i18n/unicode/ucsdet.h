@@ -46,6 +46,13 @@
  * in the language are needed.  The detection process will attempt to
  * ignore html or xml style markup that could otherwise obscure the content.
  * <p>
+ * To classify many texts, reuse one charset detector with ucsdet_setText();
+ * after the first text this does not allocate memory, and unless markup is
+ * being removed the input is examined in place without being copied.
+ * A charset detector must not be used by more than one thread at a time, but
+ * separate detectors share no mutable state, so a batch can be spread across
+ * threads with one detector per thread.
+ * <p>
  * An alternative to the ICU Charset Detector is the
  * Compact Encoding Detector, https://github.com/google/compact_enc_det.
  * It often gives more accurate results, especially with short input samples.
@@ -379,6 +386,43 @@ ucsdet_isInputFilterEnabled(const UCharsetDetector *ucsd);
 U_STABLE  UBool U_EXPORT2
 ucsdet_enableInputFilter(UCharsetDetector *ucsd, UBool filter);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Set the confidence at which ucsdet_detect() stops running charset
+ * recognizers and returns the match it has found so far.
+ *
+ * With the default value of 100, the result of ucsdet_detect() is
+ * the same as the first match from ucsdet_detectAll(), but text that
+ * is unambiguous (a BOM, or valid UTF-8 with multi-byte sequences)
+ * is classified without running the remaining recognizers.
+ * Lower values trade accuracy for speed.
+ * ucsdet_detectAll() always runs all of the recognizers.
+ *
+ * @param ucsd       the charset detector to be modified.
+ * @param confidence the stopping confidence, in the range 1-100.
+ * @param status     any error conditions are reported back in this variable.
+ *                   U_ILLEGAL_ARGUMENT_ERROR is set if the confidence is out of range.
+ * @draft ICU 68
+ */
+U_DRAFT void U_EXPORT2
+ucsdet_setStopConfidence(UCharsetDetector *ucsd, int32_t confidence, UErrorCode *status);
+
+/**
+ * Limit the number of bytes of the input text that the charset
+ * detector examines. Detection is based on a prefix of the text
+ * of at most this length, which bounds the detection time for large
+ * inputs. ucsdet_getUChars() still converts the whole text.
+ *
+ * @param ucsd   the charset detector to be modified.
+ * @param limit  the maximum number of bytes to examine, or 0 for no limit.
+ * @param status any error conditions are reported back in this variable.
+ *               U_ILLEGAL_ARGUMENT_ERROR is set if the limit is negative.
+ * @draft ICU 68
+ */
+U_DRAFT void U_EXPORT2
+ucsdet_setInputLimit(UCharsetDetector *ucsd, int32_t limit, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
 /**
   *  Get an iterator over the set of detectable charsets -
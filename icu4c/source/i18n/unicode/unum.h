@@ -801,6 +801,58 @@ unum_parseDouble(    const   UNumberFormat*  fmt,
             int32_t         *parsePos /* 0 = start */,
             UErrorCode      *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+* Parse a UTF-8 string into an int64 using a UNumberFormat.
+* This is the same as unum_parseInt64(), except that the text is in UTF-8,
+* and the parse position is an offset in bytes.
+* @param fmt The formatter to use.
+* @param text The UTF-8 text to parse.
+* @param textLength The length of text in bytes, or -1 if null-terminated.
+* @param parsePos If not NULL, on input a pointer to the byte offset at which
+* to begin parsing.  If not NULL, on output the byte offset at which parsing ended.
+* Only the text from there on that the parser needs is read, so that many numbers
+* can be parsed one after the other out of a long text. If textLength is -1, the
+* offset must not be past the terminating NUL; this is not checked.
+* @param status A pointer to an UErrorCode to receive any errors
+* @return The value of the parsed integer
+* @see unum_parseInt64
+* @see unum_parseDoubleUTF8
+* @draft ICU 68
+*/
+U_DRAFT int64_t U_EXPORT2
+unum_parseInt64UTF8(const UNumberFormat*  fmt,
+        const char*   text,
+        int32_t       textLength,
+        int32_t       *parsePos /* 0 = start */,
+        UErrorCode    *status);
+
+/**
+* Parse a UTF-8 string into a double using a UNumberFormat.
+* This is the same as unum_parseDouble(), except that the text is in UTF-8,
+* and the parse position is an offset in bytes.
+* @param fmt The formatter to use.
+* @param text The UTF-8 text to parse.
+* @param textLength The length of text in bytes, or -1 if null-terminated.
+* @param parsePos If not NULL, on input a pointer to the byte offset at which
+* to begin parsing.  If not NULL, on output the byte offset at which parsing ended.
+* Only the text from there on that the parser needs is read, so that many numbers
+* can be parsed one after the other out of a long text. If textLength is -1, the
+* offset must not be past the terminating NUL; this is not checked.
+* @param status A pointer to an UErrorCode to receive any errors
+* @return The value of the parsed double
+* @see unum_parseDouble
+* @see unum_parseInt64UTF8
+* @draft ICU 68
+*/
+U_DRAFT double U_EXPORT2
+unum_parseDoubleUTF8(const UNumberFormat*  fmt,
+        const char*   text,
+        int32_t       textLength,
+        int32_t       *parsePos /* 0 = start */,
+        UErrorCode    *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /**
 * Parse a number from a string into an unformatted numeric string using a UNumberFormat.
@@ -529,6 +529,50 @@ U_STABLE void U_EXPORT2
 unumf_formatDecimal(const UNumberFormatter* uformatter, const char* value, int32_t valueLen,
                     UFormattedNumber* uresult, UErrorCode* ec);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Uses a UNumberFormatter to format an integer directly to a UTF-8 string, without a UFormattedNumber.
+ * If bufferCapacity is greater than the required length, a terminating NUL is written.
+ * If bufferCapacity is less than the required length, an error code is set.
+ *
+ * The UNumberFormatter can be shared between threads.
+ *
+ * NOTE: This is a C-compatible API; C++ users should build against numberformatter.h instead.
+ *
+ * @param uformatter A formatter object created by unumf_openForSkeletonAndLocale or similar.
+ * @param value The number to be formatted.
+ * @param buffer Where to save the UTF-8 string output.
+ * @param bufferCapacity The number of bytes available in the buffer.
+ * @param ec Set if an error occurs.
+ * @return The required length, in bytes.
+ * @draft ICU 68
+ */
+U_DRAFT int32_t U_EXPORT2
+unumf_formatIntToUTF8(const UNumberFormatter* uformatter, int64_t value, char* buffer,
+                      int32_t bufferCapacity, UErrorCode* ec);
+
+/**
+ * Uses a UNumberFormatter to format a double directly to a UTF-8 string, without a UFormattedNumber.
+ * If bufferCapacity is greater than the required length, a terminating NUL is written.
+ * If bufferCapacity is less than the required length, an error code is set.
+ *
+ * The UNumberFormatter can be shared between threads.
+ *
+ * NOTE: This is a C-compatible API; C++ users should build against numberformatter.h instead.
+ *
+ * @param uformatter A formatter object created by unumf_openForSkeletonAndLocale or similar.
+ * @param value The number to be formatted.
+ * @param buffer Where to save the UTF-8 string output.
+ * @param bufferCapacity The number of bytes available in the buffer.
+ * @param ec Set if an error occurs.
+ * @return The required length, in bytes.
+ * @draft ICU 68
+ */
+U_DRAFT int32_t U_EXPORT2
+unumf_formatDoubleToUTF8(const UNumberFormatter* uformatter, double value, char* buffer,
+                         int32_t bufferCapacity, UErrorCode* ec);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Returns a representation of a UFormattedNumber as a UFormattedValue,
  * which can be subsequently passed to any API requiring that type.
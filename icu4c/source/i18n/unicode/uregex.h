@@ -348,6 +348,32 @@ uregex_setUText(URegularExpression *regexp,
                 UText              *text,
                 UErrorCode         *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+  *  Set the UTF-8 subject text string upon which the regular expression will look
+  *  for matches. Equivalent to uregex_setUText() with a UText from utext_openUTF8(),
+  *  except that finding matches can then scan the UTF-8 bytes directly.
+  *  <p>
+  *  Regular expression matching operations work directly on the application's
+  *  string data.  The subject string data must not be altered after calling this
+  *  function until after all regular expression operations involving this string
+  *  data are completed.
+  *
+  * @param regexp     The compiled regular expression.
+  * @param text       The UTF-8 subject text string.
+  * @param textLength The length of the subject text in bytes, or -1 if the text is
+  *                   NUL terminated.
+  * @param status     Receives errors detected by this function.
+  *
+  * @draft ICU 68
+  */
+U_DRAFT void U_EXPORT2
+uregex_setUTF8(URegularExpression *regexp,
+               const char         *text,
+               int64_t             textLength,
+               UErrorCode         *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
   *  Get the subject text that is currently associated with this 
   *   regular expression object.  If the input was supplied using uregex_setText(),
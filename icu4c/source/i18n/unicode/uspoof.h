@@ -368,6 +368,13 @@ struct USpoofCheckResult;
  */
 typedef struct USpoofCheckResult USpoofCheckResult;
 
+struct USpoofIndex;
+/**
+ * @see uspoof_openIndex
+ * @draft ICU 68
+ */
+typedef struct USpoofIndex USpoofIndex;
+
 /**
  * Enum for the kinds of checks that USpoofChecker can perform.
  * These enum values are used both to select the set of checks that
@@ -1270,6 +1277,200 @@ uspoof_getSkeletonUTF8(const USpoofChecker *sc,
                        char *dest, int32_t destCapacity,
                        UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ *  Get the "skeletons" for many UTF-8 identifiers at once.
+ *  This is the same as calling uspoof_getSkeletonUTF8() for each identifier,
+ *  but the skeletons are written one after another into a single buffer,
+ *  each followed by a terminating NUL byte, which is convenient for building
+ *  a collection of the skeletons of a large set of existing identifiers.
+ *
+ *  Ill-formed UTF-8 sequences are treated like U+FFFD, as in uspoof_getSkeletonUTF8().
+ *
+ * @param sc      The USpoofChecker
+ * @param type    Deprecated.  You may pass any number.
+ * @param ids     The UTF-8 identifiers whose skeletons will be computed.
+ * @param lengths The lengths of the identifiers, in bytes, with -1 for a
+ *                zero terminated identifier. If NULL, all identifiers are zero terminated.
+ * @param count   The number of identifiers.
+ * @param dest    The output buffer, to receive the NUL-terminated skeletons.
+ * @param destCapacity  The length of the output buffer, in bytes.
+ *                The destCapacity may be zero, in which case the function will
+ *                return the total length of the skeletons.
+ * @param skeletonOffsets  An array of count offsets; receives the offset in dest
+ *                of the skeleton of each identifier. The offsets are set even when
+ *                the buffer is too small, and then say where the skeletons would go.
+ * @param status  The error code, set if an error occurred.
+ *                U_BUFFER_OVERFLOW_ERROR is set if the destination buffer is too small
+ *                to hold all of the skeletons; its contents are then unspecified.
+ * @return        The total length of all of the skeletons, in bytes, including
+ *                their terminating NULs.
+ *
+ * @see uspoof_getSkeletonUTF8
+ * @draft ICU 68
+ */
+U_DRAFT int32_t U_EXPORT2
+uspoof_getSkeletonsUTF8(const USpoofChecker *sc,
+                        uint32_t type,
+                        const char *const *ids, const int32_t *lengths, int32_t count,
+                        char *dest, int32_t destCapacity,
+                        int32_t *skeletonOffsets,
+                        UErrorCode *status);
+
+/**
+ * Open an empty index of identifier skeletons.
+ * A USpoofIndex answers whether an identifier is confusable with any of a large
+ * set of existing identifiers in constant time, by looking up its skeleton.
+ *
+ * The index keeps only a 64-bit hash of each skeleton, so that it needs between
+ * 11 and 22 bytes per identifier. A hash collision makes an identifier that is not confusable
+ * look confusable; with 50 million identifiers, the probability that a given
+ * lookup hits one is about 3 in 10^12. An index holds at most about 100 million skeletons.
+ *
+ * The index uses the confusable data of the spoof checker, which it copies;
+ * the checker can be closed while the index is in use.
+ *
+ * An index can be used for lookups from several threads at once,
+ * but adding identifiers must not happen concurrently with any other use.
+ *
+ * @param sc      The USpoofChecker whose confusable data defines the skeletons.
+ * @param status  The error code, set if an error occurred.
+ * @return        The new index, to be closed with uspoof_closeIndex().
+ * @see uspoof_getSkeleton
+ * @draft ICU 68
+ */
+U_DRAFT USpoofIndex * U_EXPORT2
+uspoof_openIndex(const USpoofChecker *sc, UErrorCode *status);
+
+/**
+ * Open an index from its serialized form, stored in 64-bit-aligned memory,
+ * for example a memory-mapped file. Inverse of uspoof_serializeIndex().
+ *
+ * The index uses the memory directly, until an identifier with a new skeleton
+ * is added to it; then it makes its own copy. The memory must remain valid and
+ * unchanged until then, or until the index is closed. Ownership of the memory
+ * remains with the caller.
+ *
+ * The serialized data is in platform endianness. It is only valid with the same
+ * confusable data that it was built with: an index must be rebuilt for a new
+ * version of ICU, or for a spoof checker with different custom data.
+ *
+ * @param sc      The USpoofChecker whose confusable data defines the skeletons.
+ * @param data    A pointer to 64-bit-aligned memory containing the serialized index.
+ * @param length  The number of bytes available at data; can be more than necessary.
+ * @param pActualLength  Receives the actual number of bytes at data taken up by the index;
+ *                can be NULL.
+ * @param status  The error code, set if an error occurred. U_INVALID_FORMAT_ERROR
+ *                is set if the data is not a valid serialized index, or if it was
+ *                built with different confusable data than that of the checker.
+ * @return        The index, to be closed with uspoof_closeIndex().
+ * @see uspoof_serializeIndex
+ * @draft ICU 68
+ */
+U_DRAFT USpoofIndex * U_EXPORT2
+uspoof_openIndexFromSerialized(const USpoofChecker *sc,
+                               const void *data, int32_t length, int32_t *pActualLength,
+                               UErrorCode *status);
+
+/**
+ * Close an index, freeing any memory that was being held by it.
+ *
+ * @param index  The index to close.
+ * @draft ICU 68
+ */
+U_DRAFT void U_EXPORT2
+uspoof_closeIndex(USpoofIndex *index);
+
+/**
+ * Add the skeleton of an identifier to an index.
+ *
+ * @param index   The index.
+ * @param id      The identifier.
+ * @param length  The length of the identifier, in UTF-16 code units,
+ *                or -1 if it is zero terminated.
+ * @param status  The error code, set if an error occurred.
+ * @return        TRUE if the skeleton was added; FALSE if the index already contained it,
+ *                that is, if a confusable identifier had been added before.
+ * @draft ICU 68
+ */
+U_DRAFT UBool U_EXPORT2
+uspoof_addToIndex(USpoofIndex *index, const UChar *id, int32_t length, UErrorCode *status);
+
+/**
+ * Add the skeleton of a UTF-8 identifier to an index.
+ * Ill-formed UTF-8 sequences are treated like U+FFFD.
+ *
+ * @param index   The index.
+ * @param id      The UTF-8 identifier.
+ * @param length  The length of the identifier, in bytes, or -1 if it is zero terminated.
+ * @param status  The error code, set if an error occurred.
+ * @return        TRUE if the skeleton was added; FALSE if the index already contained it,
+ *                that is, if a confusable identifier had been added before.
+ * @draft ICU 68
+ */
+U_DRAFT UBool U_EXPORT2
+uspoof_addToIndexUTF8(USpoofIndex *index, const char *id, int32_t length, UErrorCode *status);
+
+/**
+ * Check whether an identifier is confusable with any identifier in an index,
+ * that is, whether the index contains its skeleton.
+ *
+ * @param index   The index.
+ * @param id      The identifier.
+ * @param length  The length of the identifier, in UTF-16 code units,
+ *                or -1 if it is zero terminated.
+ * @param status  The error code, set if an error occurred.
+ * @return        TRUE if the identifier is confusable with one in the index.
+ * @draft ICU 68
+ */
+U_DRAFT UBool U_EXPORT2
+uspoof_isConfusableWithIndex(const USpoofIndex *index, const UChar *id, int32_t length,
+                             UErrorCode *status);
+
+/**
+ * Check whether a UTF-8 identifier is confusable with any identifier in an index,
+ * that is, whether the index contains its skeleton.
+ * Ill-formed UTF-8 sequences are treated like U+FFFD.
+ *
+ * @param index   The index.
+ * @param id      The UTF-8 identifier.
+ * @param length  The length of the identifier, in bytes, or -1 if it is zero terminated.
+ * @param status  The error code, set if an error occurred.
+ * @return        TRUE if the identifier is confusable with one in the index.
+ * @draft ICU 68
+ */
+U_DRAFT UBool U_EXPORT2
+uspoof_isConfusableWithIndexUTF8(const USpoofIndex *index, const char *id, int32_t length,
+                                 UErrorCode *status);
+
+/**
+ * Get the number of distinct skeletons in an index.
+ *
+ * @param index   The index.
+ * @param status  The error code, set if an error occurred.
+ * @return        The number of skeletons.
+ * @draft ICU 68
+ */
+U_DRAFT int32_t U_EXPORT2
+uspoof_getIndexSize(const USpoofIndex *index, UErrorCode *status);
+
+/**
+ * Serialize an index into 64-bit-aligned memory, for example to write it to a file
+ * that is later memory-mapped and opened with uspoof_openIndexFromSerialized().
+ *
+ * @param index   The index.
+ * @param buf     The buffer to receive the serialized index; can be NULL for preflighting.
+ * @param capacity  The size of the buffer, in bytes.
+ * @param status  The error code, set if an error occurred.
+ *                U_BUFFER_OVERFLOW_ERROR is set if the buffer is too small.
+ * @return        The size of the serialized index, in bytes.
+ * @see uspoof_openIndexFromSerialized
+ * @draft ICU 68
+ */
+U_DRAFT int32_t U_EXPORT2
+uspoof_serializeIndex(const USpoofIndex *index, void *buf, int32_t capacity, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
   * Get the set of Candidate Characters for Inclusion in Identifiers, as defined
   * in http://unicode.org/Public/security/latest/xidmodifications.txt
@@ -1368,6 +1569,26 @@ U_DEFINE_LOCAL_OPEN_POINTER(LocalUSpoofCheckerPointer, USpoofChecker, uspoof_clo
 U_DEFINE_LOCAL_OPEN_POINTER(LocalUSpoofCheckResultPointer, USpoofCheckResult, uspoof_closeCheckResult);
 /** \endcond */
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * \class LocalUSpoofIndexPointer
+ * "Smart pointer" class, closes a USpoofIndex via `uspoof_closeIndex()`.
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 68
+ */
+
+/**
+ * \cond
+ * Note: Doxygen is giving a bogus warning on this U_DEFINE_LOCAL_OPEN_POINTER.
+ *       For now, suppress with a Doxygen cond
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUSpoofIndexPointer, USpoofIndex, uspoof_closeIndex);
+/** \endcond */
+#endif  /* U_HIDE_DRAFT_API */
+
 U_NAMESPACE_END
 
 /**
@@ -24,6 +24,8 @@
 #include "unicode/rbnf.h"
 #include "unicode/compactdecimalformat.h"
 #include "unicode/ustring.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "unicode/fmtable.h"
 #include "unicode/dcfmtsym.h"
 #include "unicode/curramt.h"
@@ -427,6 +429,124 @@ unum_parseDouble(    const   UNumberFormat*  fmt,
     return res.getDouble(*status);
 }
 
+/**
+ * Returns the number of bytes of text, up to limit, that precede the end of the text.
+ * The end is at textLength, or at the first NUL if textLength is -1.
+ */
+static int32_t
+boundedLengthUTF8(const char* text, int32_t textLength, int32_t limit)
+{
+    if(textLength >= 0) {
+        return textLength < limit ? textLength : limit;
+    }
+    int32_t length = 0;
+    while(length < limit && text[length] != 0) {
+        ++length;
+    }
+    return length;
+}
+
+/**
+ * Parses UTF-8 text by converting it to UTF-16 from the start position,
+ * and maps the resulting UTF-16 index back to a byte offset.
+ *
+ * Only a window of the text is converted, so that parsing field after field
+ * out of a long buffer does not convert the rest of the buffer every time.
+ * The window is doubled and the parse repeated while the parser gets close to
+ * its end, where a longer window could let it read further.
+ */
+static void
+parseResUTF8(Formattable& res,
+             const   UNumberFormat*  fmt,
+             const   char*           text,
+             int32_t         textLength,
+             int32_t         *parsePos /* 0 = start */,
+             UErrorCode      *status)
+{
+    // Initial window size in bytes, and how many UTF-16 units before the end of
+    // the window the parser must stop for the result to be final.
+    static const int32_t kWindowSize = 256;
+    static const int32_t kWindowMargin = 64;
+
+    if(U_FAILURE(*status))
+        return;
+    if(text == NULL || textLength < -1) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    int32_t start = parsePos != NULL ? *parsePos : 0;
+    // With a NUL-terminated text, the start is not checked against the length,
+    // which would mean reading all of the text before it.
+    if(start < 0 || (textLength >= 0 && start > textLength)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    text += start;
+    if(textLength >= 0) {
+        textLength -= start;
+    }
+
+    ParsePosition pp;
+    int32_t windowLength;
+    for(int32_t limit = kWindowSize;; limit = limit <= INT32_MAX / 2 ? limit * 2 : INT32_MAX) {
+        windowLength = boundedLengthUTF8(text, textLength, limit);
+        UBool isWholeText = windowLength < limit || windowLength == textLength;
+        if(!isWholeText) {
+            // Do not cut the text inside a character.
+            U8_SET_CP_START((const uint8_t *)text, 0, windowLength);
+        }
+        const UnicodeString src = UnicodeString::fromUTF8(StringPiece(text, windowLength));
+        pp = ParsePosition();
+        res = Formattable();
+        ((const NumberFormat*)fmt)->parse(src, res, pp);
+        int32_t stop = pp.getErrorIndex() != -1 ? pp.getErrorIndex() : pp.getIndex();
+        if(isWholeText || stop < src.length() - kWindowMargin) {
+            break;
+        }
+    }
+
+    int32_t index = pp.getErrorIndex();
+    if(index != -1) {
+        *status = U_PARSE_ERROR;
+    } else {
+        index = pp.getIndex();
+    }
+    if(parsePos != NULL) {
+        // Ill-formed sequences became one U+FFFD each, as U8_NEXT() reads them.
+        int32_t offset = 0;
+        for(int32_t units = 0; units < index && offset < windowLength;) {
+            UChar32 c;
+            U8_NEXT(text, offset, windowLength, c);
+            units += U16_LENGTH(c < 0 ? 0xfffd : c);
+        }
+        *parsePos = start + offset;
+    }
+}
+
+U_CAPI int64_t U_EXPORT2
+unum_parseInt64UTF8(const UNumberFormat*  fmt,
+        const char*   text,
+        int32_t       textLength,
+        int32_t       *parsePos /* 0 = start */,
+        UErrorCode    *status)
+{
+    Formattable res;
+    parseResUTF8(res, fmt, text, textLength, parsePos, status);
+    return res.getInt64(*status);
+}
+
+U_CAPI double U_EXPORT2
+unum_parseDoubleUTF8(const UNumberFormat*  fmt,
+        const char*   text,
+        int32_t       textLength,
+        int32_t       *parsePos /* 0 = start */,
+        UErrorCode    *status)
+{
+    Formattable res;
+    parseResUTF8(res, fmt, text, textLength, parsePos, status);
+    return res.getDouble(*status);
+}
+
 U_CAPI int32_t U_EXPORT2
 unum_parseDecimal(const UNumberFormat*  fmt,
             const UChar*    text,
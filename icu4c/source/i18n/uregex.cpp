@@ -427,6 +427,36 @@ uregex_setUText(URegularExpression *regexp2,
 }
 
 
+//------------------------------------------------------------------------------
+//
+//    uregex_setUTF8
+//
+//------------------------------------------------------------------------------
+U_CAPI void U_EXPORT2
+uregex_setUTF8(URegularExpression *regexp2,
+               const char         *text,
+               int64_t             textLength,
+               UErrorCode         *status) {
+    RegularExpression *regexp = (RegularExpression*)regexp2;
+    if (validateRE(regexp, FALSE, status) == FALSE) {
+        return;
+    }
+    if (text == NULL || textLength < -1) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    if (regexp->fOwnsText && regexp->fText != NULL) {
+        uprv_free((void *)regexp->fText);
+    }
+
+    regexp->fText       = NULL; // only fill it in on request
+    regexp->fTextLength = -1;
+    regexp->fOwnsText   = TRUE;
+    regexp->fMatcher->resetUTF8(text, textLength, *status);
+}
+
+
 
 //------------------------------------------------------------------------------
 //
@@ -20,12 +20,16 @@
 #include "unicode/uspoof.h"
 #include "unicode/ustring.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "bytesinkutil.h"
+#include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
 #include "mutex.h"
 #include "scriptset.h"
 #include "uassert.h"
 #include "ucln_in.h"
+#include "ustr_imp.h"
 #include "uspoof_impl.h"
 #include "umutex.h"
 
@@ -706,32 +710,108 @@ uspoof_getSkeletonUnicodeString(const USpoofChecker *sc,
         return dest;
     }
 
+    // Most identifiers are in NFD already.
+    // Only normalize what follows the NFD prefix, and copy only if there is something.
     UnicodeString nfdId;
-    gNfdNormalizer->normalize(id, nfdId, *status);
+    const UnicodeString *src = &id;
+    int32_t nfdPrefixLength = gNfdNormalizer->spanQuickCheckYes(id, *status);
+    if (nfdPrefixLength < id.length()) {
+        nfdId.setTo(id, 0, nfdPrefixLength);
+        gNfdNormalizer->normalizeSecondAndAppend(nfdId, id.tempSubString(nfdPrefixLength), *status);
+        src = &nfdId;
+    }
+    if (U_FAILURE(*status)) {
+        return dest;
+    }
 
     // Apply the skeleton mapping to the NFD normalized input string
     // Accumulate the skeleton, possibly unnormalized, in a UnicodeString.
-    int32_t inputIndex = 0;
     UnicodeString skelStr;
-    int32_t normalizedLen = nfdId.length();
-    for (inputIndex=0; inputIndex < normalizedLen; ) {
-        UChar32 c = nfdId.char32At(inputIndex);
-        inputIndex += U16_LENGTH(c);
+    const UChar *nfdChars = src->getBuffer();
+    int32_t normalizedLen = src->length();
+    for (int32_t inputIndex = 0; inputIndex < normalizedLen; ) {
+        UChar32 c;
+        U16_NEXT(nfdChars, inputIndex, normalizedLen, c);
         This->fSpoofData->confusableLookup(c, skelStr);
     }
 
-    gNfdNormalizer->normalize(skelStr, dest, *status);
+    // The mapped skeleton is usually in NFD as well.
+    if (gNfdNormalizer->spanQuickCheckYes(skelStr, *status) == skelStr.length()) {
+        dest = std::move(skelStr);
+    } else {
+        gNfdNormalizer->normalize(skelStr, dest, *status);
+    }
     return dest;
 }
 
+namespace {
+
+// Returns TRUE if all characters in the UTF-8 string are NFD-inert, so that it is in NFD.
+// Ill-formed sequences count as U+FFFD, which is inert.
+UBool isNFDInertUTF8(StringPiece s) {
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(s.data());
+    int32_t length = s.length();
+    for (int32_t i = 0; i < length;) {
+        if (bytes[i] < 0x80) {
+            ++i;  // ASCII is inert.
+            continue;
+        }
+        UChar32 c;
+        U8_NEXT_OR_FFFD(bytes, i, length, c);
+        if (!gNfdNormalizer->isInert(c)) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+}  // namespace
+
+void SpoofImpl::getSkeletonUTF8(StringPiece id, CharString &dest, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    // Like uspoof_getSkeletonUnicodeString(), but without converting to UTF-16,
+    // unless some text actually needs to be normalized.
+    CharString nfdId;
+    if (!isNFDInertUTF8(id)) {
+        CharStringByteSink sink(&nfdId);
+        gNfdNormalizer->normalizeUTF8(0, id, sink, nullptr, status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        id = nfdId.toStringPiece();
+    }
+
+    CharString skeleton;
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(id.data());
+    int32_t length = id.length();
+    for (int32_t i = 0; i < length && U_SUCCESS(status);) {
+        UChar32 c;
+        U8_NEXT_OR_FFFD(bytes, i, length, c);
+        fSpoofData->confusableLookup(c, skeleton, status);
+    }
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    if (isNFDInertUTF8(skeleton.toStringPiece())) {
+        dest.append(skeleton, status);
+    } else {
+        CharStringByteSink sink(&dest);
+        gNfdNormalizer->normalizeUTF8(0, skeleton.toStringPiece(), sink, nullptr, status);
+    }
+}
+
 
 U_CAPI int32_t U_EXPORT2
 uspoof_getSkeletonUTF8(const USpoofChecker *sc,
-                       uint32_t type,
+                       uint32_t /*type*/,
                        const char *id,  int32_t length,
                        char *dest, int32_t destCapacity,
                        UErrorCode *status) {
-    SpoofImpl::validateThis(sc, *status);
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
     if (U_FAILURE(*status)) {
         return 0;
     }
@@ -740,17 +820,184 @@ uspoof_getSkeletonUTF8(const USpoofChecker *sc,
         return 0;
     }
 
-    UnicodeString srcStr = UnicodeString::fromUTF8(StringPiece(id, length>=0 ? length : static_cast<int32_t>(uprv_strlen(id))));
-    UnicodeString destStr;
-    uspoof_getSkeletonUnicodeString(sc, type, srcStr, destStr, status);
+    CharString skeleton;
+    This->getSkeletonUTF8(StringPiece(id, length>=0 ? length : static_cast<int32_t>(uprv_strlen(id))),
+                          skeleton, *status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+
+    int32_t skeletonLength = skeleton.length();
+    if (skeletonLength > 0 && skeletonLength <= destCapacity) {
+        uprv_memcpy(dest, skeleton.data(), skeletonLength);
+    }
+    return u_terminateChars(dest, destCapacity, skeletonLength, status);
+}
+
+
+U_CAPI int32_t U_EXPORT2
+uspoof_getSkeletonsUTF8(const USpoofChecker *sc,
+                        uint32_t /*type*/,
+                        const char *const *ids, const int32_t *lengths, int32_t count,
+                        char *dest, int32_t destCapacity,
+                        int32_t *skeletonOffsets,
+                        UErrorCode *status) {
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (count<0 || (count>0 && (ids==NULL || skeletonOffsets==NULL)) ||
+            destCapacity<0 || (destCapacity==0 && dest!=NULL) || (destCapacity>0 && dest==NULL)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    // One skeleton buffer for all identifiers; it only grows.
+    CharString skeleton;
+    int32_t totalLength = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        int32_t length = lengths != NULL ? lengths[i] : -1;
+        if (length<-1 || ids[i]==NULL) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        skeleton.clear();
+        This->getSkeletonUTF8(StringPiece(ids[i], length>=0 ? length : static_cast<int32_t>(uprv_strlen(ids[i]))),
+                              skeleton, *status);
+        if (U_FAILURE(*status)) {
+            return 0;
+        }
+
+        // Each skeleton is followed by its NUL terminator.
+        int32_t skeletonLength = skeleton.length() + 1;
+        if (skeletonLength > INT32_MAX - totalLength) {
+            *status = U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        skeletonOffsets[i] = totalLength;
+        if (skeletonLength <= destCapacity - totalLength) {
+            uprv_memcpy(dest + totalLength, skeleton.data(), skeletonLength);
+        }
+        totalLength += skeletonLength;
+    }
+    if (totalLength > destCapacity) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return totalLength;
+}
+
+
+U_CAPI USpoofIndex * U_EXPORT2
+uspoof_openIndex(const USpoofChecker *sc, UErrorCode *status) {
+    const SpoofImpl *checker = SpoofImpl::validateThis(sc, *status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    LocalPointer<SpoofIndex> index(new SpoofIndex(*checker, *status), *status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    return index.orphan()->asUSpoofIndex();
+}
+
+U_CAPI USpoofIndex * U_EXPORT2
+uspoof_openIndexFromSerialized(const USpoofChecker *sc,
+                               const void *data, int32_t length, int32_t *pActualLength,
+                               UErrorCode *status) {
+    const SpoofImpl *checker = SpoofImpl::validateThis(sc, *status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    LocalPointer<SpoofIndex> index(new SpoofIndex(*checker, data, length, pActualLength, *status), *status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    return index.orphan()->asUSpoofIndex();
+}
+
+U_CAPI void U_EXPORT2
+uspoof_closeIndex(USpoofIndex *index) {
+    UErrorCode status = U_ZERO_ERROR;
+    SpoofIndex *This = SpoofIndex::validateThis(index, status);
+    delete This;
+}
+
+U_CAPI UBool U_EXPORT2
+uspoof_addToIndex(USpoofIndex *index, const UChar *id, int32_t length, UErrorCode *status) {
+    SpoofIndex *This = SpoofIndex::validateThis(index, *status);
+    if (U_FAILURE(*status)) {
+        return FALSE;
+    }
+    if (length < -1) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    UnicodeString idStr((length == -1), id, length);  // Aliasing constructor.
+    return This->add(idStr, *status);
+}
+
+U_CAPI UBool U_EXPORT2
+uspoof_addToIndexUTF8(USpoofIndex *index, const char *id, int32_t length, UErrorCode *status) {
+    SpoofIndex *This = SpoofIndex::validateThis(index, *status);
+    if (U_FAILURE(*status)) {
+        return FALSE;
+    }
+    if (length < -1) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    return This->addUTF8(StringPiece(id, length>=0 ? length : static_cast<int32_t>(uprv_strlen(id))), *status);
+}
+
+U_CAPI UBool U_EXPORT2
+uspoof_isConfusableWithIndex(const USpoofIndex *index, const UChar *id, int32_t length,
+                             UErrorCode *status) {
+    const SpoofIndex *This = SpoofIndex::validateThis(index, *status);
+    if (U_FAILURE(*status)) {
+        return FALSE;
+    }
+    if (length < -1) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    UnicodeString idStr((length == -1), id, length);  // Aliasing constructor.
+    return This->hasConfusable(idStr, *status);
+}
+
+U_CAPI UBool U_EXPORT2
+uspoof_isConfusableWithIndexUTF8(const USpoofIndex *index, const char *id, int32_t length,
+                                 UErrorCode *status) {
+    const SpoofIndex *This = SpoofIndex::validateThis(index, *status);
+    if (U_FAILURE(*status)) {
+        return FALSE;
+    }
+    if (length < -1) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    return This->hasConfusableUTF8(StringPiece(id, length>=0 ? length : static_cast<int32_t>(uprv_strlen(id))), *status);
+}
+
+U_CAPI int32_t U_EXPORT2
+uspoof_getIndexSize(const USpoofIndex *index, UErrorCode *status) {
+    const SpoofIndex *This = SpoofIndex::validateThis(index, *status);
     if (U_FAILURE(*status)) {
         return 0;
     }
+    return This->size();
+}
 
-    int32_t lengthInUTF8 = 0;
-    u_strToUTF8(dest, destCapacity, &lengthInUTF8,
-                destStr.getBuffer(), destStr.length(), status);
-    return lengthInUTF8;
+U_CAPI int32_t U_EXPORT2
+uspoof_serializeIndex(const USpoofIndex *index, void *buf, int32_t capacity, UErrorCode *status) {
+    const SpoofIndex *This = SpoofIndex::validateThis(index, *status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (capacity < 0 || (buf == NULL && capacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    return This->serialize(buf, capacity, *status);
 }
 
 
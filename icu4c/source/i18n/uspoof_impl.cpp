@@ -12,7 +12,10 @@
 #include "unicode/uchar.h"
 #include "unicode/uniset.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "utrie2.h"
+#include "bytesinkutil.h"
+#include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
 #include "scriptset.h"
@@ -479,6 +482,275 @@ int32_t CheckResult::toCombinedBitmask(int32_t enabledChecks) {
 CheckResult::~CheckResult() {
 }
 
+//-----------------------------------------
+//
+//   class SpoofIndex Implementation
+//
+//-----------------------------------------
+
+#define SPOOF_INDEX_INITIAL_CAPACITY 256
+
+// The largest power of 2 number of slots that still fits into an int32_t length.
+#define SPOOF_INDEX_MAX_CAPACITY 0x8000000
+
+namespace {
+
+// 64-bit FNV-1a over the UTF-8 skeleton, with the MurmurHash3 finalizer to spread
+// the bits for the slot index.  Never 0, which marks empty slots.
+uint64_t hashBytes(StringPiece s) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (int32_t i = 0; i < s.length(); ++i) {
+        hash ^= static_cast<uint8_t>(s.data()[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash != 0 ? hash : 1;
+}
+
+inline uint64_t *getSlots(SpoofIndexHeader *header) {
+    return reinterpret_cast<uint64_t *>(header + 1);
+}
+
+inline const uint64_t *getSlots(const SpoofIndexHeader *header) {
+    return reinterpret_cast<const uint64_t *>(header + 1);
+}
+
+}  // namespace
+
+SpoofIndex::SpoofIndex(const SpoofImpl &checker, UErrorCode &status) :
+        fChecker(NULL), fHeader(NULL), fOwnsHeader(FALSE) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    fChecker = new SpoofImpl(checker, status);
+    if (fChecker == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    reallocate(SPOOF_INDEX_INITIAL_CAPACITY, status);
+}
+
+SpoofIndex::SpoofIndex(const SpoofImpl &checker, const void *data, int32_t length,
+                       int32_t *pActualLength, UErrorCode &status) :
+        fChecker(NULL), fHeader(NULL), fOwnsHeader(FALSE) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (data == NULL || length < 0 || (reinterpret_cast<uintptr_t>(data) & 7) != 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    const SpoofIndexHeader *header = static_cast<const SpoofIndexHeader *>(data);
+    if (length < static_cast<int32_t>(sizeof(SpoofIndexHeader)) ||
+            header->fMagic != USPOOF_INDEX_MAGIC ||
+            header->fFormatVersion[0] != 2 ||
+            header->fCapacity <= 0 || header->fCapacity > SPOOF_INDEX_MAX_CAPACITY ||
+            (header->fCapacity & (header->fCapacity - 1)) != 0 ||
+            header->fLength != static_cast<int32_t>(sizeof(SpoofIndexHeader) + header->fCapacity * sizeof(uint64_t)) ||
+            header->fLength > length ||
+            header->fCount < 0 || header->fCount >= header->fCapacity ||
+            header->fDataChecksum != checker.fSpoofData->checksum()) {
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    // Lookups rely on the count to find an empty slot.
+    const uint64_t *slots = getSlots(header);
+    int32_t count = 0;
+    for (int32_t i = 0; i < header->fCapacity; ++i) {
+        if (slots[i] != 0) {
+            ++count;
+        }
+    }
+    if (count != header->fCount) {
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    fChecker = new SpoofImpl(checker, status);
+    if (fChecker == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    // Alias the caller's data until the first new skeleton is added.
+    fHeader = const_cast<SpoofIndexHeader *>(header);
+    if (pActualLength != NULL) {
+        *pActualLength = header->fLength;
+    }
+}
+
+SpoofIndex::~SpoofIndex() {
+    delete fChecker;
+    if (fOwnsHeader) {
+        uprv_free(fHeader);
+    }
+}
+
+USpoofIndex *SpoofIndex::asUSpoofIndex() {
+    return exportForC();
+}
+
+const SpoofIndex *SpoofIndex::validateThis(const USpoofIndex *ptr, UErrorCode &status) {
+    return validate(ptr, status);
+}
+
+SpoofIndex *SpoofIndex::validateThis(USpoofIndex *ptr, UErrorCode &status) {
+    return validate(ptr, status);
+}
+
+UBool SpoofIndex::add(const UnicodeString &id, UErrorCode &status) {
+    uint64_t hash = hashSkeleton(id, status);
+    return addHash(hash, status);
+}
+
+UBool SpoofIndex::addUTF8(StringPiece id, UErrorCode &status) {
+    uint64_t hash = hashSkeletonUTF8(id, status);
+    return addHash(hash, status);
+}
+
+UBool SpoofIndex::hasConfusable(const UnicodeString &id, UErrorCode &status) const {
+    uint64_t hash = hashSkeleton(id, status);
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    int32_t slot = findSlot(hash);
+    return slot >= 0 && getSlots(fHeader)[slot] != 0;
+}
+
+UBool SpoofIndex::hasConfusableUTF8(StringPiece id, UErrorCode &status) const {
+    uint64_t hash = hashSkeletonUTF8(id, status);
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    int32_t slot = findSlot(hash);
+    return slot >= 0 && getSlots(fHeader)[slot] != 0;
+}
+
+int32_t SpoofIndex::size() const {
+    return fHeader->fCount;
+}
+
+int32_t SpoofIndex::serialize(void *buf, int32_t capacity, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    int32_t length = fHeader->fLength;
+    if (length > capacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+        return length;
+    }
+    uprv_memcpy(buf, fHeader, length);
+    return length;
+}
+
+uint64_t SpoofIndex::hashSkeleton(const UnicodeString &id, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    // Hash the UTF-8 form, so that both kinds of input find the same skeletons.
+    UnicodeString skeleton;
+    uspoof_getSkeletonUnicodeString(fChecker->asUSpoofChecker(), 0, id, skeleton, &status);
+    CharString skeleton8;
+    CharStringByteSink sink(&skeleton8);
+    skeleton.toUTF8(sink);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    return hashBytes(skeleton8.toStringPiece());
+}
+
+uint64_t SpoofIndex::hashSkeletonUTF8(StringPiece id, UErrorCode &status) const {
+    CharString skeleton;
+    fChecker->getSkeletonUTF8(id, skeleton, status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    return hashBytes(skeleton.toStringPiece());
+}
+
+int32_t SpoofIndex::findSlot(uint64_t hash) const {
+    const uint64_t *slots = getSlots(fHeader);
+    int32_t mask = fHeader->fCapacity - 1;
+    // The table is never full, but probe at most every slot once anyway.
+    int32_t i = static_cast<int32_t>(hash & mask);
+    for (int32_t probes = 0; probes < fHeader->fCapacity; ++probes) {
+        if (slots[i] == 0 || slots[i] == hash) {
+            return i;
+        }
+        i = (i + 1) & mask;
+    }
+    return -1;
+}
+
+UBool SpoofIndex::addHash(uint64_t hash, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    int32_t slot = findSlot(hash);
+    if (slot >= 0 && getSlots(fHeader)[slot] != 0) {
+        return FALSE;
+    }
+    // Keep the load factor at most 3/4, and copy aliased data before writing to it.
+    int32_t capacity = fHeader->fCapacity;
+    if ((fHeader->fCount + 1) > capacity / 4 * 3) {
+        if (capacity >= SPOOF_INDEX_MAX_CAPACITY) {
+            status = U_BUFFER_OVERFLOW_ERROR;
+            return FALSE;
+        }
+        reallocate(capacity * 2, status);
+    } else if (!fOwnsHeader) {
+        reallocate(capacity, status);
+    }
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    slot = findSlot(hash);
+    if (slot < 0) {
+        status = U_INTERNAL_PROGRAM_ERROR;
+        return FALSE;
+    }
+    getSlots(fHeader)[slot] = hash;
+    ++fHeader->fCount;
+    return TRUE;
+}
+
+void SpoofIndex::reallocate(int32_t capacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int32_t length = static_cast<int32_t>(sizeof(SpoofIndexHeader) + capacity * sizeof(uint64_t));
+    SpoofIndexHeader *header = static_cast<SpoofIndexHeader *>(uprv_malloc(length));
+    if (header == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memset(header, 0, length);
+    header->fMagic = USPOOF_INDEX_MAGIC;
+    header->fFormatVersion[0] = 2;
+    header->fLength = length;
+    header->fCapacity = capacity;
+    header->fDataChecksum = fHeader != NULL ? fHeader->fDataChecksum : fChecker->fSpoofData->checksum();
+
+    SpoofIndexHeader *oldHeader = fHeader;
+    fHeader = header;
+    if (oldHeader != NULL) {
+        const uint64_t *oldSlots = getSlots(oldHeader);
+        uint64_t *slots = getSlots(header);
+        for (int32_t i = 0; i < oldHeader->fCapacity; ++i) {
+            if (oldSlots[i] != 0) {
+                slots[findSlot(oldSlots[i])] = oldSlots[i];
+            }
+        }
+        header->fCount = oldHeader->fCount;
+        if (fOwnsHeader) {
+            uprv_free(oldHeader);
+        }
+    }
+    fOwnsHeader = TRUE;
+}
+
 //----------------------------------------------------------------------------------------------
 //
 //   class SpoofData Implementation
@@ -756,6 +1028,10 @@ int32_t SpoofData::size() const {
     return fRawData->fLength;
 }
 
+uint64_t SpoofData::checksum() const {
+    return hashBytes(StringPiece(reinterpret_cast<const char *>(fRawData), fRawData->fLength));
+}
+
 //-------------------------------
 //
 // Front-end APIs for SpoofData
@@ -763,6 +1039,44 @@ int32_t SpoofData::size() const {
 //-------------------------------
 
 int32_t SpoofData::confusableLookup(UChar32 inChar, UnicodeString &dest) const {
+    int32_t index = findKey(inChar);
+
+    // Did we find an entry?  If not, the char maps to itself.
+    if (index < 0) {
+        dest.append(inChar);
+        return 1;
+    }
+
+    // Add the element to the string builder and return.
+    return appendValueTo(index, dest);
+}
+
+void SpoofData::confusableLookup(UChar32 inChar, CharString &dest, UErrorCode &status) const {
+    char buffer[U8_MAX_LENGTH];
+    int32_t bufferLength = 0;
+    int32_t index = findKey(inChar);
+
+    // If there is no entry, the char maps to itself.
+    // Values of length 1 are stored directly as a single BMP char.
+    if (index < 0 || ConfusableDataUtils::keyToLength(fCFUKeys[index]) == 1) {
+        UChar32 c = index < 0 ? inChar : fCFUValues[index];
+        U8_APPEND_UNSAFE(buffer, bufferLength, c);
+        dest.append(buffer, bufferLength, status);
+        return;
+    }
+
+    const UChar *value = fCFUStrings + fCFUValues[index];
+    int32_t stringLength = ConfusableDataUtils::keyToLength(fCFUKeys[index]);
+    for (int32_t i = 0; i < stringLength;) {
+        UChar32 c;
+        U16_NEXT_UNSAFE(value, i, c);
+        bufferLength = 0;
+        U8_APPEND_UNSAFE(buffer, bufferLength, c);
+        dest.append(buffer, bufferLength, status);
+    }
+}
+
+int32_t SpoofData::findKey(UChar32 inChar) const {
     // Perform a binary search.
     // [lo, hi), i.e lo is inclusive, hi is exclusive.
     // The result after the loop will be in lo.
@@ -781,14 +1095,7 @@ int32_t SpoofData::confusableLookup(UChar32 inChar, UnicodeString &dest) const {
         }
     } while (hi - lo > 1);
 
-    // Did we find an entry?  If not, the char maps to itself.
-    if (codePointAt(lo) != inChar) {
-        dest.append(inChar);
-        return 1;
-    }
-
-    // Add the element to the string builder and return.
-    return appendValueTo(lo, dest);
+    return codePointAt(lo) == inChar ? lo : -1;
 }
 
 int32_t SpoofData::length() const {
@@ -45,9 +45,14 @@ U_NAMESPACE_BEGIN
 // Magic number for sanity checking spoof checkers.
 #define USPOOF_CHECK_MAGIC 0x2734ecde
 
+// Magic number for sanity checking spoof indexes and their serialized data.
+#define USPOOF_INDEX_MAGIC 0x5c6f1d28
+
+class CharString;
 class ScriptSet;
 class SpoofData;
 struct SpoofDataHeader;
+struct SpoofIndexHeader;
 class ConfusableDataUtils;
 
 /**
@@ -89,6 +94,12 @@ class SpoofImpl : public UObject,
     int32_t findHiddenOverlay(const UnicodeString& input, UErrorCode& status) const;
     bool isIllegalCombiningDotLeadCharacter(UChar32 cp) const;
 
+    /**
+     * Append the skeleton of a UTF-8 identifier to dest, without converting it to UTF-16.
+     * Ill-formed sequences are treated like U+FFFD.  Implemented in uspoof.cpp.
+     */
+    void getSkeletonUTF8(StringPiece id, CharString &dest, UErrorCode &status) const;
+
     /** parse a hex number.  Untility used by the builders.   */
     static UChar32 ScanHex(const UChar *s, int32_t start, int32_t limit, UErrorCode &status);
 
@@ -135,6 +146,75 @@ class CheckResult : public UObject,
     URestrictionLevel fRestrictionLevel;   // The restriction level of the string.
 };
 
+/**
+ *  Class SpoofIndex corresponds directly to the plain C API opaque type
+ *  USpoofIndex.  One can be cast to the other.
+ *
+ *  The index is a hash set of the skeletons of many identifiers.  Only a 64-bit hash
+ *  of each UTF-8 skeleton is kept, in an open addressing table with linear probing.
+ *  The table and a SpoofIndexHeader are one block of memory, which is also the
+ *  serialized form; an index opened from serialized data aliases it until it is modified.
+ */
+class SpoofIndex : public UObject,
+        public IcuCApiHelper<USpoofIndex, SpoofIndex, USPOOF_INDEX_MAGIC> {
+public:
+    SpoofIndex(const SpoofImpl &checker, UErrorCode &status);
+    SpoofIndex(const SpoofImpl &checker, const void *data, int32_t length, int32_t *pActualLength,
+               UErrorCode &status);
+    virtual ~SpoofIndex();
+
+    USpoofIndex *asUSpoofIndex();
+    static SpoofIndex *validateThis(USpoofIndex *ptr, UErrorCode &status);
+    static const SpoofIndex *validateThis(const USpoofIndex *ptr, UErrorCode &status);
+
+    // Add the skeleton of an identifier.
+    // Return FALSE if the index already had the skeleton, that is, a confusable identifier.
+    UBool add(const UnicodeString &id, UErrorCode &status);
+    UBool addUTF8(StringPiece id, UErrorCode &status);
+
+    // Check whether the index has the skeleton of the identifier.
+    UBool hasConfusable(const UnicodeString &id, UErrorCode &status) const;
+    UBool hasConfusableUTF8(StringPiece id, UErrorCode &status) const;
+
+    // The number of distinct skeletons in the index.
+    int32_t size() const;
+
+    int32_t serialize(void *buf, int32_t capacity, UErrorCode &status) const;
+
+private:
+    uint64_t hashSkeleton(const UnicodeString &id, UErrorCode &status) const;
+    uint64_t hashSkeletonUTF8(StringPiece id, UErrorCode &status) const;
+    // Get the slot with the hash, or else the empty slot where it would go.
+    // Return -1 if the table has neither.
+    int32_t findSlot(uint64_t hash) const;
+    UBool addHash(uint64_t hash, UErrorCode &status);
+    // Move the hashes into newly allocated memory, with the given number of slots.
+    void reallocate(int32_t capacity, UErrorCode &status);
+
+    SpoofImpl         *fChecker;     // Owned copy, for computing skeletons.
+    SpoofIndexHeader  *fHeader;      // Header and slots; read-only if not owned.
+    UBool              fOwnsHeader;  // TRUE if fHeader was allocated by this index.
+
+    SpoofIndex(const SpoofIndex &) = delete;
+    SpoofIndex &operator=(const SpoofIndex &) = delete;
+};
+
+//
+//  Spoof index data layout: a SpoofIndexHeader followed by fCapacity uint64_t slots.
+//  A slot holds the hash of one skeleton, or 0 if it is empty.
+//  The data is in platform endianness and needs 64-bit alignment.
+//
+struct SpoofIndexHeader {
+    int32_t       fMagic;             // (0x5c6f1d28)
+    uint8_t       fFormatVersion[4];  // Data Format. Currently version 2.
+    int32_t       fLength;            // Total length in bytes of the data, including this header.
+    int32_t       fCount;             // Number of non-empty slots.
+    int32_t       fCapacity;          // Number of slots, a power of 2.
+    int32_t       unused;             // Padding, keeps the checksum and slots 64-bit aligned.
+    uint64_t      fDataChecksum;      // SpoofData::checksum() of the confusable data
+                                      //   that the skeletons were computed with.
+};
+
 
 //
 //  Confusable Mappings Data Structures, version 2.0
@@ -245,12 +325,18 @@ class SpoofData: public UMemory {
     // Not to be confused with length, which returns the number of confusable entries.
     int32_t size() const;
 
+    // Get a 64-bit hash of the raw data, which identifies it in a serialized SpoofIndex.
+    uint64_t checksum() const;
+
     // Get the confusable skeleton transform for a single code point.
     // The result is a string with a length between 1 and 18 as of Unicode 9.
     // This is the main public endpoint for this class.
     // @return   The length in UTF-16 code units of the substition string.
     int32_t confusableLookup(UChar32 inChar, UnicodeString &dest) const;
 
+    // Same as above, but append the transform to a UTF-8 string.
+    void confusableLookup(UChar32 inChar, CharString &dest, UErrorCode &status) const;
+
     // Get the number of confusable entries in this SpoofData.
     int32_t length() const;
 
@@ -263,6 +349,9 @@ class SpoofData: public UMemory {
     int32_t appendValueTo(int32_t index, UnicodeString& dest) const;
 
   private:
+    // Get the index of the entry for the code point, or -1 if it maps to itself.
+    int32_t findKey(UChar32 inChar) const;
+
     // Reserve space in the raw data.  For use by builder when putting together a
     //   new set of data.  Init the new storage to zero, to prevent inconsistent
     //   results if it is not all otherwise set by the requester.
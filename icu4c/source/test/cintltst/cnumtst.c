@@ -75,6 +75,7 @@ static void TestSetMaxFracAndRoundIncr(void);
 static void TestIgnorePadding(void);
 static void TestSciNotationMaxFracCap(void);
 static void TestMinIntMinFracZero(void);
+static void TestParseUTF8(void);
 
 #define TESTCASE(x) addTest(root, &x, "tsformat/cnumtst/" #x)
 
@@ -116,6 +117,7 @@ void addNumForTest(TestNode** root)
     TESTCASE(TestIgnorePadding);
     TESTCASE(TestSciNotationMaxFracCap);
     TESTCASE(TestMinIntMinFracZero);
+    TESTCASE(TestParseUTF8);
 }
 
 /* test Parse int 64 */
@@ -3576,4 +3578,139 @@ static void TestMinIntMinFracZero(void) {
     }
 }
 
+typedef struct {
+    const char*  locale;
+    const char*  text;       /* UTF-8 */
+    int32_t      start;
+    UErrorCode   expectedStatus;
+    int32_t      expectedPos;
+    double       expectedValue;
+} ParseUTF8Item;
+
+static const ParseUTF8Item parseUTF8Items[] = {
+    { "en_US", "1,234.5",                        0, U_ZERO_ERROR,  7, 1234.5 },
+    { "en_US", "x -12",                          2, U_ZERO_ERROR,  5, -12.0 },
+    { "en_US", "12abc",                          0, U_ZERO_ERROR,  2, 12.0 },
+    { "en_US", "abc",                            0, U_PARSE_ERROR, 0, 0.0 },
+    { "en_US", "12\xFF" "3",                     0, U_ZERO_ERROR,  2, 12.0 },
+    { "de",    "\xC3\xA4 1.234,5",               3, U_ZERO_ERROR,  10, 1234.5 },
+    { "fr",    "1\xE2\x80\xAF" "234,5",           0, U_ZERO_ERROR,  9, 1234.5 },
+    { "ar",    "\xD9\xA1\xD9\xA2\xD9\xAB\xD9\xA5", 0, U_ZERO_ERROR,  8, 12.5 },
+    { NULL,    NULL,                             0, U_ZERO_ERROR,  0, 0.0 }
+};
+
+static void TestParseUTF8(void) {
+    const ParseUTF8Item* itemPtr;
+    for (itemPtr = parseUTF8Items; itemPtr->locale != NULL; itemPtr++) {
+        UErrorCode status = U_ZERO_ERROR;
+        UNumberFormat* unum = unum_open(UNUM_DECIMAL, NULL, 0, itemPtr->locale, NULL, &status);
+        if (U_FAILURE(status)) {
+            log_data_err("unum_open UNUM_DECIMAL for %s fails with %s\n", itemPtr->locale, u_errorName(status));
+            continue;
+        }
+        status = U_ZERO_ERROR;
+        int32_t parsePos = itemPtr->start;
+        double value = unum_parseDoubleUTF8(unum, itemPtr->text, -1, &parsePos, &status);
+        if (status != itemPtr->expectedStatus || parsePos != itemPtr->expectedPos ||
+                (U_SUCCESS(status) && value != itemPtr->expectedValue)) {
+            log_err("unum_parseDoubleUTF8 %s \"%s\" from %d: expected %s pos %d value %.1f, got %s pos %d value %.1f\n",
+                    itemPtr->locale, itemPtr->text, itemPtr->start,
+                    u_errorName(itemPtr->expectedStatus), itemPtr->expectedPos, itemPtr->expectedValue,
+                    u_errorName(status), parsePos, value);
+        }
+        unum_close(unum);
+    }
+
+    {
+        UErrorCode status = U_ZERO_ERROR;
+        UNumberFormat* unum = unum_open(UNUM_DECIMAL, NULL, 0, "en_US", NULL, &status);
+        if (U_FAILURE(status)) {
+            log_data_err("unum_open UNUM_DECIMAL for en_US fails with %s\n", u_errorName(status));
+            return;
+        }
+        unum_setAttribute(unum, UNUM_GROUPING_USED, 0);
+        status = U_ZERO_ERROR;
+        int64_t value = unum_parseInt64UTF8(unum, "-9223372036854775808", -1, NULL, &status);
+        if (U_FAILURE(status) || value != U_INT64_MIN) {
+            log_err("unum_parseInt64UTF8 INT64_MIN: got %s\n", u_errorName(status));
+        }
+
+        /* Only the given length is parsed. */
+        status = U_ZERO_ERROR;
+        int32_t parsePos = 0;
+        value = unum_parseInt64UTF8(unum, "12345", 3, &parsePos, &status);
+        if (U_FAILURE(status) || value != 123 || parsePos != 3) {
+            log_err("unum_parseInt64UTF8 with length: got %s pos %d\n", u_errorName(status), parsePos);
+        }
+
+        status = U_ZERO_ERROR;
+        parsePos = 6;
+        unum_parseDoubleUTF8(unum, "12345", 5, &parsePos, &status);
+        if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("unum_parseDoubleUTF8 with start past the end: expected U_ILLEGAL_ARGUMENT_ERROR, got %s\n",
+                    u_errorName(status));
+        }
+        status = U_ZERO_ERROR;
+        unum_parseDoubleUTF8(unum, NULL, 0, NULL, &status);
+        if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("unum_parseDoubleUTF8 with NULL text: expected U_ILLEGAL_ARGUMENT_ERROR, got %s\n",
+                    u_errorName(status));
+        }
+
+        /* Many fields parsed one after the other out of one long text. */
+        {
+            enum { kFieldCount = 5000 };
+            char* text = (char*)malloc(kFieldCount * 8 + 1);
+            int32_t length = 0;
+            int32_t i, pass;
+            for (i = 0; i < kFieldCount; i++) {
+                length += sprintf(text + length, "%d;", i * 7);
+            }
+            for (pass = 0; pass < 2; pass++) {
+                parsePos = 0;
+                for (i = 0; i < kFieldCount; i++) {
+                    status = U_ZERO_ERROR;
+                    value = unum_parseInt64UTF8(unum, text, pass == 0 ? length : -1, &parsePos, &status);
+                    if (U_FAILURE(status) || value != i * 7 || text[parsePos] != ';') {
+                        log_err("unum_parseInt64UTF8 field %d: got %s value %d pos %d\n",
+                                i, u_errorName(status), (int32_t)value, parsePos);
+                        break;
+                    }
+                    parsePos++;
+                }
+                if (parsePos != length) {
+                    log_err("unum_parseInt64UTF8 fields: ended at %d instead of %d\n", parsePos, length);
+                }
+            }
+            free(text);
+        }
+
+        /* Numbers longer than the part of the text that is converted at first. */
+        {
+            char text[1002];
+            double dValue;
+            uprv_memset(text, '0', 1000);
+            text[0] = '1';
+            text[300] = 'x';
+            text[301] = 0;
+            status = U_ZERO_ERROR;
+            parsePos = 0;
+            dValue = unum_parseDoubleUTF8(unum, text, -1, &parsePos, &status);
+            if (U_FAILURE(status) || parsePos != 300 || dValue != 1e299) {
+                log_err("unum_parseDoubleUTF8 long number: got %s pos %d\n", u_errorName(status), parsePos);
+            }
+            text[300] = '0';
+            text[301] = '0';
+            text[1000] = 'x';
+            status = U_ZERO_ERROR;
+            parsePos = 1;
+            dValue = unum_parseDoubleUTF8(unum, text, 1001, &parsePos, &status);
+            if (U_FAILURE(status) || parsePos != 1000 || dValue != 0.0) {
+                log_err("unum_parseDoubleUTF8 long zeros: got %s pos %d\n", u_errorName(status), parsePos);
+            }
+        }
+        unum_close(unum);
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
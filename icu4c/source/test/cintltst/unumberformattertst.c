@@ -30,6 +30,8 @@ static void TestSkeletonParseError(void);
 
 static void TestPerUnitInArabic(void);
 
+static void TestFormatToUTF8(void);
+
 void addUNumberFormatterTest(TestNode** root);
 
 #define TESTCASE(x) addTest(root, &x, "tsformat/unumberformatter/" #x)
@@ -41,6 +43,7 @@ void addUNumberFormatterTest(TestNode** root) {
     TESTCASE(TestFormattedValue);
     TESTCASE(TestSkeletonParseError);
     TESTCASE(TestPerUnitInArabic);
+    TESTCASE(TestFormatToUTF8);
 }
 
 
@@ -343,4 +346,40 @@ static void TestPerUnitInArabic() {
     }
     unumf_closeResult(formatted);
 }
+
+static void TestFormatToUTF8() {
+    UErrorCode ec = U_ZERO_ERROR;
+    char buffer[CAPACITY];
+    int32_t length;
+
+    UNumberFormatter* f = unumf_openForSkeletonAndLocale(u"currency/EUR", -1, "de", &ec);
+    if (!assertSuccessCheck("Should create without error", &ec, TRUE)) {
+        return;
+    }
+
+    length = unumf_formatDoubleToUTF8(f, -5142.3, buffer, CAPACITY, &ec);
+    assertSuccess("Should format double without error", &ec);
+    assertEquals("Should produce expected UTF-8 string", "-5.142,30\xC2\xA0\xE2\x82\xAC", buffer);
+    assertIntEquals("Should return the length in bytes", 14, length);
+
+    length = unumf_formatIntToUTF8(f, 7, buffer, CAPACITY, &ec);
+    assertSuccess("Should format integer without error", &ec);
+    assertEquals("Should produce expected UTF-8 string", "7,00\xC2\xA0\xE2\x82\xAC", buffer);
+    assertIntEquals("Should return the length in bytes", 9, length);
+
+    // Preflighting:
+    length = unumf_formatDoubleToUTF8(f, -5142.3, NULL, 0, &ec);
+    assertIntEquals("Should preflight the length", 14, length);
+    assertIntEquals("Should set overflow error", U_BUFFER_OVERFLOW_ERROR, ec);
+    ec = U_ZERO_ERROR;
+    length = unumf_formatDoubleToUTF8(f, -5142.3, buffer, 10, &ec);
+    assertIntEquals("Should return the length on overflow", 14, length);
+    assertIntEquals("Should set overflow error", U_BUFFER_OVERFLOW_ERROR, ec);
+    ec = U_ZERO_ERROR;
+
+    unumf_formatIntToUTF8(f, 7, NULL, 5, &ec);
+    assertIntEquals("Should reject NULL buffer with capacity", U_ILLEGAL_ARGUMENT_ERROR, ec);
+
+    unumf_close(f);
+}
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -22,6 +22,7 @@
 #include "cstring.h"
 #include "unicode/localpointer.h"
 #include "islamcal.h"
+#include "ethpccal.h"
 
 #define mkcstr(U) u_austrcpy(calloc(8, u_strlen(U) + 1), U)
 
@@ -346,6 +347,13 @@ void CalendarTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
             TestChineseCalendarMapping();
           }
           break;
+        case 37:
+          name = "TestComputeFieldsCache";
+          if(exec) {
+            logln("TestComputeFieldsCache---"); logln("");
+            TestComputeFieldsCache();
+          }
+          break;
         default: name = ""; break;
     }
 }
@@ -3724,6 +3732,80 @@ void CalendarTest::TestChineseCalendarMapping() {
     }
 }
 
+void CalendarTest::TestComputeFieldsCache() {
+    // A calendar that is set to nearby times reuses the fields and zone
+    // offsets from the previous time. Compare it with a calendar whose
+    // time zone is reset before every setTime(), which drops that cache.
+    static const char* const locales[] = {
+        "en@calendar=gregorian", "en@calendar=islamic", "en@calendar=islamic-civil",
+        "en@calendar=chinese", "en@calendar=hebrew", "en@calendar=japanese",
+    };
+    static const struct {
+        const char* zone;
+        UDate start;  // shortly before a zone transition
+    } zones[] = {
+        { "America/New_York",   1583560800000.0 },  // 2020-03-07T06:00Z
+        { "Europe/London",      1603580400000.0 },  // 2020-10-24T23:00Z
+        { "Australia/Lord_Howe", 1585998000000.0 }, // 2020-04-04T11:00Z
+        { "Pacific/Apia",       1325073600000.0 },  // 2011-12-28T12:00Z, skips a day
+        { "Etc/GMT-14",         1600000000000.0 },
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+        for (int32_t j = 0; j < UPRV_LENGTHOF(zones); ++j) {
+            UErrorCode status = U_ZERO_ERROR;
+            LocalPointer<TimeZone> zone(TimeZone::createTimeZone(zones[j].zone));
+            LocalPointer<Calendar> cal(Calendar::createInstance(zone->clone(), Locale(locales[i]), status));
+            LocalPointer<Calendar> ref(Calendar::createInstance(zone->clone(), Locale(locales[i]), status));
+            if (failure(status, "Calendar::createInstance", TRUE)) {
+                return;
+            }
+            // Steps of 3h43m17s cross midnight and the zone transition at
+            // different times of day; every 7th step goes back.
+            UDate time = zones[j].start;
+            for (int32_t step = 0; step < 60; ++step) {
+                if (step == 30) {
+                    cal->setFirstDayOfWeek(UCAL_MONDAY);
+                    ref->setFirstDayOfWeek(UCAL_MONDAY);
+                }
+                time += (step % 7 == 6 ? -2 : 1) * 13397000.0;
+                cal->setTime(time, status);
+                ref->adoptTimeZone(zone->clone());
+                ref->setTime(time, status);
+                for (int32_t f = 0; f < UCAL_FIELD_COUNT; ++f) {
+                    UCalendarDateFields field = (UCalendarDateFields)f;
+                    int32_t actual = cal->get(field, status);
+                    int32_t expected = ref->get(field, status);
+                    if (actual != expected) {
+                        errln(UnicodeString("Fail: ") + locales[i] + " " + zones[j].zone +
+                              " at " + time + ": " + fieldName(field) + " = " + actual +
+                              ", expected " + expected);
+                    }
+                }
+                if (failure(status, "Calendar::get")) {
+                    return;
+                }
+            }
+        }
+    }
+
+    // Switching the era of an Ethiopic calendar drops the cached fields of the day.
+    UErrorCode status = U_ZERO_ERROR;
+    EthiopicCalendar ethiopic(Locale("en@calendar=ethiopic"), status);
+    LocalPointer<Calendar> ameteAlem(Calendar::createInstance(Locale("en@calendar=ethiopic-amete-alem"), status));
+    if (failure(status, "EthiopicCalendar")) {
+        return;
+    }
+    UDate time = 1600000000000.0;
+    ethiopic.setTime(time, status);
+    ethiopic.get(UCAL_ERA, status);
+    ethiopic.setAmeteAlemEra(TRUE);
+    ethiopic.setTime(time + 3600000.0, status);
+    ameteAlem->setTime(time + 3600000.0, status);
+    assertEquals("Ethiopic era after setAmeteAlemEra", ameteAlem->get(UCAL_ERA, status), ethiopic.get(UCAL_ERA, status));
+    assertEquals("Ethiopic year after setAmeteAlemEra", ameteAlem->get(UCAL_YEAR, status), ethiopic.get(UCAL_YEAR, status));
+    failure(status, "Calendar::get");
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
 //eof
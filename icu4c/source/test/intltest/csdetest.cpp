@@ -21,6 +21,7 @@
 #include "xmlparser.h"
 
 #include <memory>
+#include <string>
 #include <stdlib.h>
 #include <string.h>
 
@@ -109,6 +110,14 @@ void CharsetDetectionTest::runIndexedTest( int32_t index, UBool exec, const char
             if (exec) Ticket6954Test();
             break;
 
+       case 10: name = "StopConfidenceTest";
+            if (exec) StopConfidenceTest();
+            break;
+
+       case 11: name = "InputLimitTest";
+            if (exec) InputLimitTest();
+            break;
+
         default: name = "";
             break; //needed to end loop
     }
@@ -839,3 +848,103 @@ void CharsetDetectionTest::Ticket6954Test() {
     TEST_ASSERT(strcmp(name1, "windows-1252")==0);
 #endif
 }
+
+void CharsetDetectionTest::StopConfidenceTest() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString ss = "This is a string with some non-ascii characters that will "
+                       "be converted to UTF-8, then shoved through the detection process.  "
+                       "\\u0391\\u0392\\u0393\\u0394\\u0395";
+    UnicodeString s = ss.unescape();
+    int32_t utf8Length = 0;
+    std::unique_ptr<char[]> utf8Bytes(extractBytes(s, "UTF-8", utf8Length));
+    const char *ascii = "This is a small sample of some English text. Just enough to be sure that it detects correctly.";
+    LocalUCharsetDetectorPointer csd(ucsdet_open(&status));
+    TEST_ASSERT_SUCCESS(status);
+
+    // With the default stopping confidence, detect() finds the same best match as detectAll().
+    const char *texts[] = {utf8Bytes.get(), ascii};
+    int32_t lengths[] = {utf8Length, -1};
+    for (int32_t i = 0; i < UPRV_LENGTHOF(texts); i += 1) {
+        ucsdet_setText(csd.getAlias(), texts[i], lengths[i], &status);
+        const UCharsetMatch *match = ucsdet_detect(csd.getAlias(), &status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT(match != NULL);
+        const char *name = ucsdet_getName(match, &status);
+        int32_t confidence = ucsdet_getConfidence(match, &status);
+
+        int32_t matchCount = 0;
+        const UCharsetMatch **matches = ucsdet_detectAll(csd.getAlias(), &matchCount, &status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT(matchCount > 1);
+        TEST_ASSERT(strcmp(name, ucsdet_getName(matches[0], &status)) == 0);
+        TEST_ASSERT(confidence == ucsdet_getConfidence(matches[0], &status));
+    }
+
+    ucsdet_setText(csd.getAlias(), utf8Bytes.get(), utf8Length, &status);
+    const UCharsetMatch *match = ucsdet_detect(csd.getAlias(), &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(strcmp(ucsdet_getName(match, &status), "UTF-8") == 0);
+    TEST_ASSERT(ucsdet_getConfidence(match, &status) == 100);
+
+    // A low stopping confidence takes the first plausible match.
+    ucsdet_setStopConfidence(csd.getAlias(), 10, &status);
+    ucsdet_setText(csd.getAlias(), ascii, -1, &status);
+    match = ucsdet_detect(csd.getAlias(), &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(strcmp(ucsdet_getName(match, &status), "UTF-8") == 0);
+    int32_t matchCount = 0;
+    const UCharsetMatch **matches = ucsdet_detectAll(csd.getAlias(), &matchCount, &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(strcmp(ucsdet_getName(matches[0], &status), "ISO-8859-1") == 0);
+
+    ucsdet_setStopConfidence(csd.getAlias(), 0, &status);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+    status = U_ZERO_ERROR;
+    ucsdet_setStopConfidence(csd.getAlias(), 101, &status);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+}
+
+void CharsetDetectionTest::InputLimitTest() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString ss = "This is a string with some non-ascii characters that will "
+                       "be converted to UTF-8, then shoved through the detection process.  "
+                       "\\u0391\\u0392\\u0393\\u0394\\u0395";
+    UnicodeString s = ss.unescape();
+    int32_t utf8Length = 0;
+    std::unique_ptr<char[]> utf8Bytes(extractBytes(s, "UTF-8", utf8Length));
+
+    // Valid UTF-8 followed by bytes that can never occur in UTF-8.
+    std::string text(utf8Bytes.get(), utf8Length);
+    text.append(20, '\xFF');
+
+    LocalUCharsetDetectorPointer csd(ucsdet_open(&status));
+    ucsdet_setText(csd.getAlias(), text.data(), (int32_t)text.length(), &status);
+    const UCharsetMatch *match = ucsdet_detect(csd.getAlias(), &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(strcmp(ucsdet_getName(match, &status), "UTF-8") != 0);
+
+    ucsdet_setInputLimit(csd.getAlias(), utf8Length, &status);
+    match = ucsdet_detect(csd.getAlias(), &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(strcmp(ucsdet_getName(match, &status), "UTF-8") == 0);
+    TEST_ASSERT(ucsdet_getConfidence(match, &status) == 100);
+
+    // The whole text is still converted.
+    UChar buffer[200];
+    int32_t length = ucsdet_getUChars(match, buffer, UPRV_LENGTHOF(buffer), &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(length == s.length() + 20);
+
+    // The limit applies to text set afterwards, too.
+    ucsdet_setText(csd.getAlias(), text.data(), (int32_t)text.length(), &status);
+    match = ucsdet_detect(csd.getAlias(), &status);
+    TEST_ASSERT(strcmp(ucsdet_getName(match, &status), "UTF-8") == 0);
+
+    ucsdet_setInputLimit(csd.getAlias(), 0, &status);
+    match = ucsdet_detect(csd.getAlias(), &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(strcmp(ucsdet_getName(match, &status), "UTF-8") != 0);
+
+    ucsdet_setInputLimit(csd.getAlias(), -1, &status);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+}
@@ -33,6 +33,8 @@ class CharsetDetectionTest: public IntlTest {
     virtual void IBM420Test();
     virtual void Ticket6394Test();
     virtual void Ticket6954Test();
+    virtual void StopConfidenceTest();
+    virtual void InputLimitTest();
 
 private:
     void checkEncoding(const UnicodeString &testString,
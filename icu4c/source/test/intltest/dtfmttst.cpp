@@ -129,6 +129,8 @@ void DateFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &nam
     TESTCASE_AUTO(TestParseRegression13744);
     TESTCASE_AUTO(TestAdoptCalendarLeak);
     TESTCASE_AUTO(Test20741_ABFields);
+    TESTCASE_AUTO(TestFormatFastPath);
+    TESTCASE_AUTO(TestParseFastPath);
 
     TESTCASE_AUTO_END;
 }
@@ -5631,6 +5633,167 @@ void DateFormatTest::Test20741_ABFields() {
     }
 }
 
+void DateFormatTest::TestFormatFastPath() {
+    IcuTestErrorCode status(*this, "TestFormatFastPath");
+    // SimpleDateFormat writes common numeric fields as ASCII digits directly,
+    // unless a field has its own number format. Compare with that.
+    static const char16_t* patterns[] = {
+        u"yyyy-MM-dd'T'HH:mm:ss.SSS",
+        u"y yy yyy yyyy yyyyy",
+        u"d/M/y H:m:s",
+        u"EEE, d MMM yyyy HH:mm:ss zzz",
+        u"EEEE MMMM LLL LL ''yy'' 'o''clock' h:mm a",
+        u"MMMM d, y",
+        u"''HH'':mm''''ss",
+    };
+    static const char* locales[] = {"en", "de", "fr", "ar", "he@calendar=hebrew", "zh@calendar=chinese"};
+    static const UDate dates[] = {
+        0.0,                // 1970-01-01
+        951782400000.0,     // 2000-02-29
+        1593561599999.0,    // 2020-06-30 23:59:59.999
+        -62105126400000.0,  // year 2
+        327900585600000.0,  // year 12360
+    };
+    LocalPointer<TimeZone> zone(TimeZone::createTimeZone("America/Los_Angeles"));
+    for (auto pattern : patterns) {
+        for (auto locale : locales) {
+            status.setScope(UnicodeString(pattern) + u" " + UnicodeString(locale, -1, US_INV));
+            SimpleDateFormat fast(pattern, Locale(locale), status);
+            SimpleDateFormat slow(pattern, Locale(locale), status);
+            if (status.errDataIfFailureAndReset()) {
+                continue;
+            }
+            slow.adoptNumberFormat(u"yMdHms", NumberFormat::createInstance(Locale(locale), status), status);
+            fast.setTimeZone(*zone);
+            slow.setTimeZone(*zone);
+            for (auto date : dates) {
+                UnicodeString expected, actual;
+                FieldPositionIterator expectedIter, actualIter;
+                slow.format(date, expected, &expectedIter, status);
+                fast.format(date, actual, &actualIter, status);
+                assertEquals("format", expected, actual);
+                FieldPosition expectedPos, actualPos;
+                while (expectedIter.next(expectedPos)) {
+                    if (!assertTrue("field", actualIter.next(actualPos))) {
+                        break;
+                    }
+                    assertEquals("field", expectedPos.getField(), actualPos.getField());
+                    assertEquals("begin", expectedPos.getBeginIndex(), actualPos.getBeginIndex());
+                    assertEquals("end", expectedPos.getEndIndex(), actualPos.getEndIndex());
+                }
+                assertFalse("no more fields", actualIter.next(actualPos));
+            }
+        }
+    }
+    status.setScope("");
+
+    // The compiled pattern follows pattern changes and copies.
+    SimpleDateFormat sdf(u"yyyy-MM-dd", Locale::getEnglish(), status);
+    sdf.setTimeZone(*TimeZone::getGMT());
+    UnicodeString result;
+    assertEquals("initial", u"2000-02-29", sdf.format(951782400000.0, result));
+    sdf.applyPattern(u"HH:mm 'at' d.M.");
+    assertEquals("applyPattern", u"00:00 at 29.2.", sdf.format(951782400000.0, result.remove()));
+    SimpleDateFormat copy(sdf);
+    assertEquals("copy", u"00:00 at 29.2.", copy.format(951782400000.0, result.remove()));
+    sdf.applyLocalizedPattern(u"yy/MM", status);
+    assertEquals("applyLocalizedPattern", u"00/02", sdf.format(951782400000.0, result.remove()));
+    copy = sdf;
+    assertEquals("assignment", u"00/02", copy.format(951782400000.0, result.remove()));
+}
+
+void DateFormatTest::TestParseFastPath() {
+    IcuTestErrorCode status(*this, "TestParseFastPath");
+    // SimpleDateFormat matches numeric patterns like ISO 8601 ones directly,
+    // unless a field has its own number format. Compare with that, including
+    // text that does not match the pattern exactly.
+    static const char16_t* patterns[] = {
+        u"yyyy-MM-dd'T'HH:mm:ss.SSSXXX",
+        u"yyyy-MM-dd'T'HH:mm:ssZ",
+        u"yyyy-MM-dd HH:mm:ss",
+        u"yyyyMMdd'T'HHmmssx",
+        u"yy-MM-dd",
+        u"d.M.y H:m",
+        u"HHmmss.SSS",
+    };
+    static const char16_t* texts[] = {
+        u"2020-07-01T12:34:56.789+02:00",
+        u"2020-07-01T12:34:56.7Z",
+        u"2020-07-01T12:34:56-0800",
+        u"2020-07-01 12:34:56",
+        u"2020-07-01  12:34:56",
+        u"2020-7-1 24:00:00",
+        u"2020-13-45 12:34:56",
+        u"20200701T123456+05",
+        u"20200701T12345",
+        u"20-07-01",
+        u"1.7.2020 9:05",
+        u"123456.1234567",
+        u"-2020-07-01 12:34:56",
+        u"\u0662\u0660\u0662\u0660-07-01 12:34:56",
+        u"2020-07-01x",
+        u"",
+    };
+    static const char* locales[] = {"en", "de", "ar", "he@calendar=hebrew"};
+    for (auto pattern : patterns) {
+        for (auto locale : locales) {
+            status.setScope(UnicodeString(pattern) + u" " + UnicodeString(locale, -1, US_INV));
+            SimpleDateFormat fast(pattern, Locale(locale), status);
+            SimpleDateFormat slow(pattern, Locale(locale), status);
+            if (status.errDataIfFailureAndReset()) {
+                continue;
+            }
+            slow.adoptNumberFormat(u"yMdHmsS", NumberFormat::createInstance(Locale(locale), status), status);
+            fast.setTimeZone(*TimeZone::getGMT());
+            slow.setTimeZone(*TimeZone::getGMT());
+            for (int32_t lenient = 0; lenient < 2; lenient++) {
+                fast.setLenient(lenient);
+                slow.setLenient(lenient);
+                for (auto text : texts) {
+                    UnicodeString input = UnicodeString(text).unescape();
+                    LocalPointer<Calendar> expected(slow.getCalendar()->clone());
+                    LocalPointer<Calendar> actual(fast.getCalendar()->clone());
+                    expected->clear();
+                    actual->clear();
+                    ParsePosition expectedPos(0), actualPos(0);
+                    slow.parse(input, *expected, expectedPos);
+                    fast.parse(input, *actual, actualPos);
+                    UnicodeString message = UnicodeString(text) + u" lenient=" + lenient;
+                    assertEquals(message + u" index", expectedPos.getIndex(), actualPos.getIndex());
+                    assertEquals(message + u" error index", expectedPos.getErrorIndex(), actualPos.getErrorIndex());
+                    if (expectedPos.getErrorIndex() < 0) {
+                        UErrorCode expectedStatus = U_ZERO_ERROR, actualStatus = U_ZERO_ERROR;
+                        UDate expectedDate = expected->getTime(expectedStatus);
+                        UDate actualDate = actual->getTime(actualStatus);
+                        assertEquals(message + u" status", u_errorName(expectedStatus), u_errorName(actualStatus));
+                        assertEquals(message + u" date", expectedDate, actualDate);
+                    }
+                }
+            }
+        }
+    }
+    status.setScope("");
+
+    // RFC 3339 timestamps
+    SimpleDateFormat rfc3339(u"yyyy-MM-dd'T'HH:mm:ss.SSSXXX", Locale::getRoot(), status);
+    UDate date = rfc3339.parse(u"2020-06-30T23:59:59.999Z", status);
+    assertEquals("UTC", 1593561599999.0, date);
+    date = rfc3339.parse(u"2020-07-01T01:59:59.999+02:00", status);
+    assertEquals("offset", 1593561599999.0, date);
+
+    // Six or more Z's are localized GMT, like ZZZZ, both ways.
+    for (auto pattern : {u"yyyy-MM-dd'T'HH:mm:ss ZZZZ", u"yyyy-MM-dd'T'HH:mm:ss ZZZZZZ"}) {
+        SimpleDateFormat gmtFormat(pattern, Locale::getEnglish(), status);
+        LocalPointer<TimeZone> zone(TimeZone::createTimeZone(u"America/Los_Angeles"));
+        gmtFormat.setTimeZone(*zone);
+        UnicodeString formatted;
+        gmtFormat.format(1593561599000.0, formatted);
+        assertEquals(UnicodeString(pattern) + u" format", u"2020-06-30T16:59:59 GMT-07:00", formatted);
+        date = gmtFormat.parse(formatted, status);
+        assertEquals(UnicodeString(pattern) + u" parse", 1593561599000.0, date);
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
 //eof
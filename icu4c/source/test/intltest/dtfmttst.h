@@ -264,6 +264,8 @@ class DateFormatTest: public CalendarTimeZoneTest {
     void TestParseRegression13744();
     void TestAdoptCalendarLeak();
     void Test20741_ABFields();
+    void TestFormatFastPath();
+    void TestParseFastPath();
 
 private:
     UBool showParse(DateFormat &format, const UnicodeString &formattedString);
@@ -44,6 +44,7 @@ void IntlTestDateTimePatternGeneratorAPI::runIndexedTest( int32_t index, UBool e
         TESTCASE(8, test20640_HourCyclArsEnNH);
         TESTCASE(9, testFallbackWithDefaultRootLocale);
         TESTCASE(10, testGetDefaultHourCycle_OnEmptyInstance);
+        TESTCASE(11, testSharedBestPatterns);
         default: name = ""; break;
     }
 }
@@ -1507,4 +1508,69 @@ void IntlTestDateTimePatternGeneratorAPI::testGetDefaultHourCycle_OnEmptyInstanc
     }
 }
 
+// Generators from createInstance() share the best patterns found for their locale
+// until they are modified.
+void IntlTestDateTimePatternGeneratorAPI::testSharedBestPatterns() {
+    static const char16_t* const skeletons[] = {
+        u"yMMMd", u"yMMMEd", u"jm", u"Hms", u"yMdjm", u"MMMMdhhmm", u"GyMMMMEEEEdjmsz", u"yQQQ", u"Bh"
+    };
+    static const UDateTimePatternMatchOptions options[] = {
+        UDATPG_MATCH_NO_OPTIONS, UDATPG_MATCH_HOUR_FIELD_LENGTH, UDATPG_MATCH_ALL_FIELDS_LENGTH
+    };
+    static const char* const locales[] = { "en", "de", "ja", "ar@numbers=latn", "en@calendar=japanese" };
+
+    for (int32_t i = 0; i < UPRV_LENGTHOF(locales); i++) {
+        UErrorCode status = U_ZERO_ERROR;
+        Locale locale(locales[i]);
+        LocalPointer<DateTimePatternGenerator> first(DateTimePatternGenerator::createInstance(locale, status), status);
+        LocalPointer<DateTimePatternGenerator> second(DateTimePatternGenerator::createInstance(locale, status), status);
+        LocalPointer<DateTimePatternGenerator> unshared(DateTimePatternGenerator::createInstance(locale, status), status);
+        if (U_FAILURE(status)) {
+            dataerrln("ERROR: createInstance(%s) failed: %s", locales[i], u_errorName(status));
+            continue;
+        }
+        LocalPointer<DateTimePatternGenerator> cloned(first->clone());
+        // Setting a value, even an unchanged one, stops the generator from using shared best patterns.
+        unshared->setDecimal(unshared->getDecimal());
+
+        for (int32_t j = 0; j < UPRV_LENGTHOF(skeletons); j++) {
+            for (int32_t k = 0; k < UPRV_LENGTHOF(options); k++) {
+                UnicodeString skeleton(skeletons[j]);
+                UnicodeString expected = unshared->getBestPattern(skeleton, options[k], status);
+                UnicodeString fromFirst = first->getBestPattern(skeleton, options[k], status);
+                UnicodeString fromSecond = second->getBestPattern(skeleton, options[k], status);
+                UnicodeString fromClone = cloned->getBestPattern(skeleton, options[k], status);
+                if (U_FAILURE(status)) {
+                    errln("ERROR: %s getBestPattern failed: %s", locales[i], u_errorName(status));
+                    return;
+                }
+                assertEquals(UnicodeString(locales[i]) + u" first " + skeleton, expected, fromFirst);
+                assertEquals(UnicodeString(locales[i]) + u" second " + skeleton, expected, fromSecond);
+                assertEquals(UnicodeString(locales[i]) + u" clone " + skeleton, expected, fromClone);
+            }
+        }
+    }
+
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<DateTimePatternGenerator> shared(DateTimePatternGenerator::createInstance(Locale::getEnglish(), status), status);
+    LocalPointer<DateTimePatternGenerator> modified(DateTimePatternGenerator::createInstance(Locale::getEnglish(), status), status);
+    if (U_FAILURE(status)) {
+        dataerrln("ERROR: createInstance(en) failed: %s", u_errorName(status));
+        return;
+    }
+    UnicodeString before = shared->getBestPattern(u"yMdjm", status);
+    modified->setDateTimeFormat(u"{1} @ {0}");
+    UnicodeString after = modified->getBestPattern(u"yMdjm", status);
+    assertSuccess("getBestPattern", status);
+    assertTrue(u"modified generator uses its own dateTimeFormat: " + after, after.indexOf(u'@') >= 0);
+    assertEquals("shared best pattern is unchanged", before, shared->getBestPattern(u"yMdjm", status));
+
+    UnicodeString conflictingPattern;
+    modified.adoptInstead(DateTimePatternGenerator::createInstance(Locale::getEnglish(), status));
+    modified->addPattern(u"d-MMM-y", TRUE, conflictingPattern, status);
+    assertEquals("added pattern is used", u"d-MMM-y", modified->getBestPattern(u"yMMMd", status));
+    assertEquals("shared generator is unaffected", u"MMM d, y", shared->getBestPattern(u"yMMMd", status));
+    assertSuccess("addPattern", status);
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
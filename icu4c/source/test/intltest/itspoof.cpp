@@ -28,6 +28,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string>
 
 #define TEST_ASSERT_SUCCESS(status) UPRV_BLOCK_MACRO_BEGIN { \
     if (U_FAILURE(status)) { \
@@ -108,6 +109,8 @@ void IntlTestSpoof::runIndexedTest( int32_t index, UBool exec, const char* &name
     TESTCASE_AUTO(testBug13314_MixedNumbers);
     TESTCASE_AUTO(testBug13328_MixedCombiningMarks);
     TESTCASE_AUTO(testCombiningDot);
+    TESTCASE_AUTO(testSkeletonsUTF8);
+    TESTCASE_AUTO(testSpoofIndex);
     TESTCASE_AUTO_END;
 }
 
@@ -238,6 +241,17 @@ void IntlTestSpoof::checkSkeleton(const USpoofChecker *sc, uint32_t type,
         errln(UnicodeString(" Actual   Skeleton: \"") + actual + UnicodeString("\"\n") +
               UnicodeString(" Expected Skeleton: \"") + uExpected + UnicodeString("\""));
     }
+
+    std::string utf8Input, utf8Expected;
+    uInput.toUTF8String(utf8Input);
+    uExpected.toUTF8String(utf8Expected);
+    char utf8Actual[100];
+    int32_t length = uspoof_getSkeletonUTF8(sc, type, utf8Input.c_str(), -1,
+                                            utf8Actual, UPRV_LENGTHOF(utf8Actual), &status);
+    if (U_FAILURE(status) || utf8Expected != std::string(utf8Actual, length)) {
+        errln("File %s, Line %d, Test case from line %d, UTF-8 skeleton differs, status %s",
+              __FILE__, __LINE__, lineNum, u_errorName(status));
+    }
 }
 
 void IntlTestSpoof::testAreConfusable() {
@@ -406,6 +420,16 @@ void IntlTestSpoof::testConfData() {
         uspoof_getSkeletonUnicodeString(sc.getAlias(), skeletonType, from, actual, &status);
         TEST_ASSERT_SUCCESS(status);
         TEST_ASSERT(actual == expected);
+
+        std::string utf8From, utf8Expected;
+        char utf8Actual[200];
+        from.toUTF8String(utf8From);
+        expected.toUTF8String(utf8Expected);
+        int32_t utf8Length = uspoof_getSkeletonUTF8(sc.getAlias(), skeletonType,
+            utf8From.data(), static_cast<int32_t>(utf8From.length()),
+            utf8Actual, UPRV_LENGTHOF(utf8Actual), &status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT(utf8Expected == std::string(utf8Actual, utf8Length));
         if (actual != expected) {
             errln(parseLine.group(0, status));
             UnicodeString line = "Actual: ";
@@ -775,4 +799,167 @@ void IntlTestSpoof::testCombiningDot() {
     }
 }
 
+void IntlTestSpoof::testSkeletonsUTF8() {
+    // Inputs that are not in NFD, skeletons that are not, supplementary and ill-formed text.
+    static const char *const ids[] = {
+        "paypal", "p\xC3\xA0ypal", "\xE2\x91\xBE", "\xF0\x9D\x90\x80" "bc", "a\xCC\x81\xCC\xA3",
+        "\xC3\x85ngstr\xC3\xB6m", "ab\xFF" "cd\xE2\x82", "", "\xEF\xB7\xBB", "\xD6\x9C"
+    };
+    int32_t lengths[UPRV_LENGTHOF(ids)];
+    for (int32_t i = 0; i < UPRV_LENGTHOF(ids); i++) {
+        lengths[i] = static_cast<int32_t>(uprv_strlen(ids[i]));
+    }
+    lengths[0] = -1;
+
+    UErrorCode status = U_ZERO_ERROR;
+    LocalUSpoofCheckerPointer sc(uspoof_open(&status));
+    if (!assertSuccess("uspoof_open", status)) {
+        return;
+    }
+
+    int32_t offsets[UPRV_LENGTHOF(ids)];
+    int32_t totalLength = uspoof_getSkeletonsUTF8(sc.getAlias(), 0, ids, lengths, UPRV_LENGTHOF(ids),
+                                                  nullptr, 0, offsets, &status);
+    assertEquals("preflighting", U_BUFFER_OVERFLOW_ERROR, status);
+    status = U_ZERO_ERROR;
+    LocalArray<char> skeletons(new char[totalLength]);
+    assertEquals("total length", totalLength,
+                 uspoof_getSkeletonsUTF8(sc.getAlias(), 0, ids, lengths, UPRV_LENGTHOF(ids),
+                                         skeletons.getAlias(), totalLength, offsets, &status));
+    if (!assertSuccess("uspoof_getSkeletonsUTF8", status)) {
+        return;
+    }
+
+    for (int32_t i = 0; i < UPRV_LENGTHOF(ids); i++) {
+        // Compare with the UTF-16 skeleton, which treats ill-formed UTF-8 the same way.
+        UnicodeString expected16;
+        uspoof_getSkeletonUnicodeString(sc.getAlias(), 0, UnicodeString::fromUTF8(ids[i]), expected16, &status);
+        std::string expected;
+        expected16.toUTF8String(expected);
+        assertEquals(UnicodeString("skeleton ") + i, expected.c_str(), skeletons.getAlias() + offsets[i]);
+
+        char single[100];
+        int32_t length = uspoof_getSkeletonUTF8(sc.getAlias(), 0, ids[i], lengths[i],
+                                                single, UPRV_LENGTHOF(single), &status);
+        assertEquals(UnicodeString("single skeleton ") + i, expected.c_str(), std::string(single, length).c_str());
+    }
+    assertSuccess("skeletons", status);
+    assertEquals("last skeleton ends the buffer", totalLength,
+                 offsets[UPRV_LENGTHOF(ids) - 1] + static_cast<int32_t>(uprv_strlen(skeletons.getAlias() + offsets[UPRV_LENGTHOF(ids) - 1])) + 1);
+
+    // Too small a buffer still reports where every skeleton would go.
+    int32_t smallOffsets[UPRV_LENGTHOF(ids)];
+    char small[4];
+    assertEquals("overflow length", totalLength,
+                 uspoof_getSkeletonsUTF8(sc.getAlias(), 0, ids, lengths, UPRV_LENGTHOF(ids),
+                                         small, UPRV_LENGTHOF(small), smallOffsets, &status));
+    assertEquals("overflow", U_BUFFER_OVERFLOW_ERROR, status);
+    for (int32_t i = 0; i < UPRV_LENGTHOF(ids); i++) {
+        assertEquals("overflow offset", offsets[i], smallOffsets[i]);
+    }
+}
+
+void IntlTestSpoof::testSpoofIndex() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalUSpoofCheckerPointer sc(uspoof_open(&status));
+    LocalUSpoofIndexPointer index(uspoof_openIndex(sc.getAlias(), &status));
+    if (!assertSuccess("uspoof_openIndex", status)) {
+        return;
+    }
+    // The index keeps working without the checker.
+    sc.adoptInstead(nullptr);
+
+    assertTrue("add paypal", uspoof_addToIndexUTF8(index.getAlias(), "paypal", -1, &status));
+    assertTrue("add scoping", uspoof_addToIndex(index.getAlias(), u"scoping", -1, &status));
+    assertFalse("add confusable paypa1", uspoof_addToIndexUTF8(index.getAlias(), "paypa1", -1, &status));
+    // Cyrillic о and р in "sсоріng" make it confusable with "scoping".
+    assertFalse("add confusable scoping",
+                uspoof_addToIndex(index.getAlias(), u"s\u0441\u043E\u0440\u0456ng", -1, &status));
+    assertEquals("size", 2, uspoof_getIndexSize(index.getAlias(), &status));
+
+    assertTrue("paypal", uspoof_isConfusableWithIndex(index.getAlias(), u"paypal", -1, &status));
+    assertTrue("UTF-8 Cyrillic pаypal",
+               uspoof_isConfusableWithIndexUTF8(index.getAlias(), "p\xD0\xB0ypal", -1, &status));
+    assertTrue("scoping prefix", uspoof_isConfusableWithIndexUTF8(index.getAlias(), "scopingx", 7, &status));
+    assertFalse("paypal2", uspoof_isConfusableWithIndex(index.getAlias(), u"paypal2", -1, &status));
+    assertFalse("empty", uspoof_isConfusableWithIndexUTF8(index.getAlias(), "", -1, &status));
+    assertSuccess("lookups", status);
+
+    // Grow the index well past its initial capacity.
+    char id[20];
+    for (int32_t i = 0; i < 5000; i++) {
+        sprintf(id, "user%d", (int)i);
+        uspoof_addToIndexUTF8(index.getAlias(), id, -1, &status);
+    }
+    assertEquals("size after growing", 5002, uspoof_getIndexSize(index.getAlias(), &status));
+    // Digit 0 and letter O have the same skeleton, and 1 and l.
+    assertTrue("userl234 like user1234", uspoof_isConfusableWithIndexUTF8(index.getAlias(), "userl234", -1, &status));
+    assertTrue("user4OOO like user4000", uspoof_isConfusableWithIndexUTF8(index.getAlias(), "user4OOO", -1, &status));
+    assertFalse("user5000", uspoof_isConfusableWithIndexUTF8(index.getAlias(), "user5000", -1, &status));
+    assertSuccess("growing", status);
+
+    // Serialize, then use the data in place.
+    int32_t length = uspoof_serializeIndex(index.getAlias(), nullptr, 0, &status);
+    assertEquals("preflighting", U_BUFFER_OVERFLOW_ERROR, status);
+    status = U_ZERO_ERROR;
+    LocalArray<uint64_t> data(new uint64_t[(length + 7) / 8]);
+    assertEquals("serialized length", length,
+                 uspoof_serializeIndex(index.getAlias(), data.getAlias(), length, &status));
+    sc.adoptInstead(uspoof_open(&status));
+    int32_t actualLength = 0;
+    LocalUSpoofIndexPointer loaded(
+        uspoof_openIndexFromSerialized(sc.getAlias(), data.getAlias(), length + 8, &actualLength, &status));
+    if (!assertSuccess("uspoof_openIndexFromSerialized", status)) {
+        return;
+    }
+    assertEquals("actual length", length, actualLength);
+    assertEquals("loaded size", 5002, uspoof_getIndexSize(loaded.getAlias(), &status));
+    assertTrue("loaded paypal", uspoof_isConfusableWithIndex(loaded.getAlias(), u"paypa1", -1, &status));
+    assertFalse("loaded user5000", uspoof_isConfusableWithIndexUTF8(loaded.getAlias(), "user5000", -1, &status));
+
+    // Adding copies the data first; the serialized data stays unchanged.
+    LocalArray<uint64_t> copy(new uint64_t[(length + 7) / 8]);
+    uprv_memcpy(copy.getAlias(), data.getAlias(), length);
+    assertTrue("add to loaded", uspoof_addToIndexUTF8(loaded.getAlias(), "user5000", -1, &status));
+    assertTrue("loaded has user5000", uspoof_isConfusableWithIndexUTF8(loaded.getAlias(), "user5000", -1, &status));
+    assertTrue("serialized data unchanged", uprv_memcmp(copy.getAlias(), data.getAlias(), length) == 0);
+    assertEquals("original size", 5002, uspoof_getIndexSize(index.getAlias(), &status));
+    assertSuccess("loaded", status);
+
+    // Bad data.
+    uprv_memset(copy.getAlias(), 0, length);
+    LocalUSpoofIndexPointer bad(uspoof_openIndexFromSerialized(sc.getAlias(), copy.getAlias(), length, nullptr, &status));
+    assertEquals("invalid data", U_INVALID_FORMAT_ERROR, status);
+    status = U_ZERO_ERROR;
+    bad.adoptInstead(uspoof_openIndexFromSerialized(sc.getAlias(), data.getAlias(), length - 8, nullptr, &status));
+    assertEquals("truncated data", U_INVALID_FORMAT_ERROR, status);
+
+    // The header has the count at int32_t index 3, and the slots follow 32 bytes of header.
+    int32_t *copyHeader = reinterpret_cast<int32_t *>(copy.getAlias());
+    uprv_memcpy(copy.getAlias(), data.getAlias(), length);
+    copyHeader[3] -= 1;
+    status = U_ZERO_ERROR;
+    bad.adoptInstead(uspoof_openIndexFromSerialized(sc.getAlias(), copy.getAlias(), length, nullptr, &status));
+    assertEquals("wrong count", U_INVALID_FORMAT_ERROR, status);
+    // A full table with a plausible count would make lookups probe forever.
+    int32_t numSlots = (length - 32) / 8;
+    for (int32_t i = 0; i < numSlots; i++) {
+        copy[4 + i] = i + 1;
+    }
+    status = U_ZERO_ERROR;
+    bad.adoptInstead(uspoof_openIndexFromSerialized(sc.getAlias(), copy.getAlias(), length, nullptr, &status));
+    assertEquals("full table", U_INVALID_FORMAT_ERROR, status);
+
+    // The index only fits the confusable data that it was built with.
+    const char *confusables = "0061 ; 0062 ; MA\n";
+    UParseError pe;
+    status = U_ZERO_ERROR;
+    LocalUSpoofCheckerPointer custom(uspoof_openFromSource(confusables, -1, "", 0, nullptr, &pe, &status));
+    if (!assertSuccess("uspoof_openFromSource", status)) {
+        return;
+    }
+    bad.adoptInstead(uspoof_openIndexFromSerialized(custom.getAlias(), data.getAlias(), length, nullptr, &status));
+    assertEquals("other confusable data", U_INVALID_FORMAT_ERROR, status);
+}
+
 #endif /* !UCONFIG_NO_REGULAR_EXPRESSIONS && !UCONFIG_NO_NORMALIZATION && !UCONFIG_NO_FILE_IO */
@@ -56,6 +56,10 @@ class IntlTestSpoof: public IntlTest {
 
     void testCombiningDot();
 
+    void testSkeletonsUTF8();
+
+    void testSpoofIndex();
+
     // Internal function to run a single skeleton test case.
     void  checkSkeleton(const USpoofChecker *sc, uint32_t flags, 
                         const char *input, const char *expected, int32_t lineNum);
@@ -84,6 +84,11 @@ class NumberFormatterApiTest : public IntlTestWithFieldPosition {
     void localPointerCAPI();
     void toObject();
     void toDecimalNumber();
+    void formatToBuffer();
+    void formatToUTF8();
+    void simpleIntegerFastPath();
+    void formatBatch();
+    void skeletonCache();
 
     void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par = 0);
 
@@ -171,6 +176,8 @@ class DecimalQuantityTest : public IntlTest {
     void testNickelRounding();
     void testCompactDecimalSuppressedExponent();
     void testSuppressedExponentUnchangedByInitialScaling();
+    void testLongDecimals();
+    void testShortestDouble();
 
     void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par = 0);
 
@@ -17,6 +17,7 @@
 #include "numbertest.h"
 #include "unicode/utypes.h"
 #include "number_utypes.h"
+#include "unifiedcache.h"
 
 using number::impl::UFormattedNumberData;
 
@@ -110,6 +111,11 @@ void NumberFormatterApiTest::runIndexedTest(int32_t index, UBool exec, const cha
         TESTCASE_AUTO(localPointerCAPI);
         TESTCASE_AUTO(toObject);
         TESTCASE_AUTO(toDecimalNumber);
+        TESTCASE_AUTO(formatToBuffer);
+        TESTCASE_AUTO(formatToUTF8);
+        TESTCASE_AUTO(simpleIntegerFastPath);
+        TESTCASE_AUTO(formatBatch);
+        TESTCASE_AUTO(skeletonCache);
     TESTCASE_AUTO_END;
 }
 
@@ -3410,6 +3416,296 @@ void NumberFormatterApiTest::toDecimalNumber() {
         "9.8765E+14", fn.toDecimalNumber<std::string>(status).c_str());
 }
 
+void NumberFormatterApiTest::formatToBuffer() {
+    IcuTestErrorCode status(*this, "formatToBuffer");
+    // Both the unoptimized and the compiled formatter.
+    LocalizedNumberFormatter formatters[] = {
+        NumberFormatter::withLocale("de").threshold(0),
+        NumberFormatter::withLocale("de").threshold(1),
+    };
+    for (const LocalizedNumberFormatter& formatter : formatters) {
+        char16_t buffer[20];
+        for (int32_t i = 0; i < 3; i++) {
+            int32_t length = formatter.formatInt(-1234567, buffer, UPRV_LENGTHOF(buffer), status);
+            assertEquals("formatInt", u"-1.234.567", UnicodeString(buffer, length));
+            assertEquals("formatInt NUL", (char16_t)0, buffer[length]);
+            length = formatter.formatDouble(3.5e6, buffer, UPRV_LENGTHOF(buffer), status);
+            assertEquals("formatDouble", formatter.formatDouble(3.5e6, status).toString(status),
+                UnicodeString(buffer, length));
+        }
+
+        // Preflighting and overflow.
+        assertEquals("preflight", 10, formatter.formatInt(-1234567, nullptr, 0, status));
+        status.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+        assertEquals("overflow", 10, formatter.formatInt(-1234567, buffer, 9, status));
+        status.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+        assertEquals("no terminator", 10, formatter.formatInt(-1234567, buffer, 10, status));
+        status.expectErrorAndReset(U_STRING_NOT_TERMINATED_WARNING);
+        formatter.formatDouble(1.0, nullptr, 5, status);
+        status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+    }
+}
+
+void NumberFormatterApiTest::formatToUTF8() {
+    IcuTestErrorCode status(*this, "formatToUTF8");
+    LocalizedNumberFormatter formatter = NumberFormatter::withLocale("fr")
+        .unit(CurrencyUnit(u"EUR", status));
+
+    std::string actual;
+    StringByteSink<std::string> sink(&actual);
+    formatter.formatDoubleToUTF8(-1234.5, sink, status);
+    std::string expected;
+    formatter.formatDouble(-1234.5, status).toString(status).toUTF8String(expected);
+    assertEquals("formatDoubleToUTF8", expected.c_str(), actual.c_str());
+
+    // Appends to the sink.
+    actual = "n=";
+    formatter.formatIntToUTF8(42, sink, status);
+    expected = "n=";
+    formatter.formatInt(42, status).toString(status).toUTF8String(expected);
+    assertEquals("formatIntToUTF8", expected.c_str(), actual.c_str());
+}
+
+void NumberFormatterApiTest::simpleIntegerFastPath() {
+    IcuTestErrorCode status(*this, "simpleIntegerFastPath");
+    // Compiled formatters print integers without the MicroPropsGenerator chain when the settings
+    // allow it. The output, including fields, must be the same as with the general path.
+    static const char16_t* skeletons[] = {
+        u"",
+        u"group-off",
+        u"group-min2",
+        u"group-on-aligned",
+        u"sign-always",
+        u"sign-accounting-except-zero currency/EUR precision-integer",
+        u"percent",
+        u"precision-integer",
+        u"numbering-system/arab",
+        // Not eligible for the fast path:
+        u"integer-width/+000",
+        u"@@@",
+        u"scale/2",
+        u"compact-short",
+        u"measure-unit/length-meter unit-width-full-name",
+        u"decimal-always",
+    };
+    static const char* locales[] = {"en", "de-CH", "es", "en-IN", "ar", "fa", "hi-u-nu-deva"};
+    static const int64_t values[] = {
+        0, 7, -7, 42, 999, 1000, -1000, 12345, 123456, -1234567, 1000000000,
+        INT64_MAX, INT64_MIN, INT64_MIN + 1};
+
+    for (const char16_t* skeleton : skeletons) {
+        for (const char* locale : locales) {
+            UnlocalizedNumberFormatter unlocalized = NumberFormatter::forSkeleton(skeleton, status);
+            LocalizedNumberFormatter general = unlocalized.threshold(0).locale(locale);
+            LocalizedNumberFormatter compiled = unlocalized.threshold(1).locale(locale);
+            compiled.formatInt(0, status);
+            for (int64_t value : values) {
+                UnicodeString message = UnicodeString(skeleton) + u" " + locale + u" " + Int64ToUnicodeString(value);
+                FormattedNumber expected = general.formatInt(value, status);
+                FormattedNumber actual = compiled.formatInt(value, status);
+                assertEquals(message, expected.toString(status), actual.toString(status));
+
+                ConstrainedFieldPosition expectedPosition;
+                ConstrainedFieldPosition actualPosition;
+                for (;;) {
+                    UBool hasExpected = expected.nextPosition(expectedPosition, status);
+                    UBool hasActual = actual.nextPosition(actualPosition, status);
+                    assertEquals(message + u" has field", hasExpected, hasActual);
+                    if (!hasExpected || !hasActual) {
+                        break;
+                    }
+                    assertEquals(message + u" field", expectedPosition.getField(), actualPosition.getField());
+                    assertEquals(message + u" start", expectedPosition.getStart(), actualPosition.getStart());
+                    assertEquals(message + u" limit", expectedPosition.getLimit(), actualPosition.getLimit());
+                }
+
+                char16_t buffer[64];
+                int32_t length = compiled.formatInt(value, buffer, UPRV_LENGTHOF(buffer), status);
+                assertEquals(message + u" buffer", expected.toString(status), UnicodeString(buffer, length));
+                if (status.errIfFailureAndReset()) {
+                    return;
+                }
+            }
+        }
+    }
+}
+
+void NumberFormatterApiTest::formatBatch() {
+    IcuTestErrorCode status(*this, "formatBatch");
+    LocalizedNumberFormatter lnf = NumberFormatter::withLocale("de-CH").precision(Precision::maxFraction(2));
+    static const int64_t ints[] = {0, -5, 1234567, INT64_MIN};
+    const double doubles[] = {0.5, -1234.567, 1e20, uprv_getNaN()};
+    static const StringPiece decimals[] = {"1.005", "-98765432109876543210.5", "0"};
+    char16_t buffer[128];
+    int32_t offsets[5];
+
+    // Repeat so that the compiled formatter is used as well.
+    for (int32_t round = 0; round < 5; round++) {
+        int32_t length = lnf.formatIntBatch(ints, UPRV_LENGTHOF(ints), buffer, UPRV_LENGTHOF(buffer),
+            offsets, status);
+        UnicodeString expected;
+        for (int32_t i = 0; i < UPRV_LENGTHOF(ints); i++) {
+            UnicodeString item = lnf.formatInt(ints[i], status).toString(status);
+            assertEquals("int item", item,
+                UnicodeString(buffer + offsets[i], offsets[i + 1] - offsets[i]));
+            expected.append(item);
+        }
+        assertEquals("int total", expected, UnicodeString(buffer, length));
+        assertEquals("int offsets end", length, offsets[UPRV_LENGTHOF(ints)]);
+        assertEquals("int terminated", 0, buffer[length]);
+
+        length = lnf.formatDoubleBatch(doubles, UPRV_LENGTHOF(doubles), buffer,
+            UPRV_LENGTHOF(buffer), offsets, status);
+        expected.remove();
+        for (int32_t i = 0; i < UPRV_LENGTHOF(doubles); i++) {
+            UnicodeString item = lnf.formatDouble(doubles[i], status).toString(status);
+            assertEquals("double item", item,
+                UnicodeString(buffer + offsets[i], offsets[i + 1] - offsets[i]));
+            expected.append(item);
+        }
+        assertEquals("double total", expected, UnicodeString(buffer, length));
+
+        length = lnf.formatDecimalBatch(decimals, UPRV_LENGTHOF(decimals), buffer,
+            UPRV_LENGTHOF(buffer), offsets, status);
+        expected.remove();
+        for (int32_t i = 0; i < UPRV_LENGTHOF(decimals); i++) {
+            UnicodeString item = lnf.formatDecimal(decimals[i], status).toString(status);
+            assertEquals("decimal item", item,
+                UnicodeString(buffer + offsets[i], offsets[i + 1] - offsets[i]));
+            expected.append(item);
+        }
+        assertEquals("decimal total", expected, UnicodeString(buffer, length));
+    }
+
+    // Preflighting sets the offsets too.
+    int32_t length = lnf.formatIntBatch(ints, UPRV_LENGTHOF(ints), nullptr, 0, offsets, status);
+    status.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+    assertEquals("preflight", lnf.formatInt(INT64_MIN, status).toString(status).length(),
+        length - offsets[3]);
+    int32_t small = lnf.formatIntBatch(ints, UPRV_LENGTHOF(ints), buffer, 5, offsets, status);
+    status.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+    assertEquals("overflow length", length, small);
+
+    // An empty batch.
+    length = lnf.formatIntBatch(nullptr, 0, buffer, UPRV_LENGTHOF(buffer), offsets, status);
+    assertEquals("empty", 0, length);
+    assertEquals("empty offsets", 0, offsets[0]);
+
+    // Errors. The offsets of the values that were not formatted are set to the end of the
+    // last formatted string.
+    StringPiece bad[] = {"1", "x", "2"};
+    for (int32_t i = 0; i < 4; i++) { offsets[i] = -1; }
+    length = lnf.formatDecimalBatch(bad, 3, buffer, UPRV_LENGTHOF(buffer), offsets, status);
+    status.expectErrorAndReset(U_DECIMAL_NUMBER_SYNTAX_ERROR);
+    assertEquals("bad length", 0, length);
+    assertEquals("bad offsets[0]", 0, offsets[0]);
+    for (int32_t i = 1; i < 4; i++) {
+        assertEquals("bad offsets", 1, offsets[i]);
+    }
+    StringPiece nullItem[] = {"1", StringPiece(static_cast<const char*>(nullptr), 1)};
+    for (int32_t i = 0; i < 3; i++) { offsets[i] = -1; }
+    lnf.formatDecimalBatch(nullItem, 2, buffer, UPRV_LENGTHOF(buffer), offsets, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+    assertEquals("null item offsets[1]", 1, offsets[1]);
+    assertEquals("null item offsets[2]", 1, offsets[2]);
+    for (int32_t i = 0; i < 3; i++) { offsets[i] = -1; }
+    lnf.formatDecimalBatch(nullptr, 2, buffer, UPRV_LENGTHOF(buffer), offsets, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+    for (int32_t i = 0; i < 3; i++) {
+        assertEquals("null values offsets", 0, offsets[i]);
+    }
+    lnf.formatIntBatch(ints, 1, buffer, UPRV_LENGTHOF(buffer), nullptr, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+    lnf.formatIntBatch(ints, -1, buffer, UPRV_LENGTHOF(buffer), offsets, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+}
+
+void NumberFormatterApiTest::skeletonCache() {
+    IcuTestErrorCode status(*this, "skeletonCache");
+    static const char16_t* skeletons[] = {
+        u"",
+        u"precision-integer",
+        u"currency/EUR unit-width-narrow",
+        u"percent scale/100 .00",
+        u"compact-short",
+        u"measure-unit/length-meter unit-width-full-name",
+    };
+    static const char* locales[] = {"en", "de-CH", "ar", "ja"};
+    static const double values[] = {0, -1.5, 1234.6678, 1e9};
+
+    for (auto skeleton : skeletons) {
+        for (auto locale : locales) {
+            status.setScope(UnicodeString(skeleton) + u" " + UnicodeString(locale, -1, US_INV));
+            LocalizedNumberFormatter cached1 = NumberFormatter::forSkeleton(skeleton, locale, status);
+            LocalizedNumberFormatter cached2 = NumberFormatter::forSkeleton(skeleton, locale, status);
+            LocalizedNumberFormatter expected = NumberFormatter::forSkeleton(skeleton, status).locale(locale);
+            if (status.errIfFailureAndReset()) {
+                continue;
+            }
+            assertTrue("Compiled", cached1.getCompiled() != nullptr);
+            assertEquals("Compiled call count", INT32_MIN, cached1.getCallCount());
+            assertTrue("Shared", cached1.getCompiled() == cached2.getCompiled());
+            assertEquals("Skeleton", expected.toSkeleton(status), cached1.toSkeleton(status));
+            for (auto value : values) {
+                assertEquals("Format",
+                    expected.formatDouble(value, status).toString(status),
+                    cached1.formatDouble(value, status).toString(status));
+            }
+        }
+    }
+    status.setScope("");
+
+    LocalizedNumberFormatter en = NumberFormatter::forSkeleton(u"precision-integer", "en", status);
+    LocalizedNumberFormatter de = NumberFormatter::forSkeleton(u"precision-integer", "de", status);
+    assertTrue("Different locales", en.getCompiled() != de.getCompiled());
+
+    // A shared formatter can be changed like any other.
+    assertEquals("Changed",
+        u"1235",
+        NumberFormatter::forSkeleton(u"precision-integer", "en", status)
+            .grouping(UNUM_GROUPING_OFF)
+            .formatDouble(1234.6, status)
+            .toString(status));
+    assertEquals("Changed copy",
+        u"1234.6",
+        en.precision(Precision::unlimited()).grouping(UNUM_GROUPING_OFF)
+            .formatDouble(1234.6, status)
+            .toString(status));
+    assertEquals("Unchanged", u"1,235", en.formatDouble(1234.6, status).toString(status));
+
+    // The shared formatter outlives the formatters that used it.
+    const number::impl::NumberFormatterImpl* compiled = en.getCompiled();
+    LocalizedNumberFormatter moved = std::move(en);
+    assertTrue("Moved", compiled == moved.getCompiled());
+    moved = NumberFormatter::withLocale("en");
+    assertEquals("Shared after move",
+        u"1,235",
+        NumberFormatter::forSkeleton(u"precision-integer", "en", status)
+            .formatDouble(1234.6, status)
+            .toString(status));
+
+    // The shared formatter outlives the cache entry that created it.
+    LocalizedNumberFormatter scientific =
+        NumberFormatter::forSkeleton(u"scientific/*ee/sign-always", "en", status);
+    LocalizedNumberFormatter scientificExpected =
+        NumberFormatter::forSkeleton(u"scientific/*ee/sign-always", status).locale("en");
+    const UnifiedCache* cache = UnifiedCache::getInstance(status);
+    if (U_SUCCESS(status)) {
+        cache->flush();
+    }
+    for (auto value : values) {
+        assertEquals("Format after flush",
+            scientificExpected.formatDouble(value, status).toString(status),
+            scientific.formatDouble(value, status).toString(status));
+    }
+
+    // Errors are reported on every call.
+    for (int32_t i = 0; i < 2; i++) {
+        NumberFormatter::forSkeleton(u"precision-bogus", "en", status);
+        status.expectErrorAndReset(U_NUMBER_SKELETON_SYNTAX_ERROR);
+    }
+}
+
 
 void NumberFormatterApiTest::assertFormatDescending(
         const char16_t* umessage,
@@ -7,11 +7,15 @@
 
 #include "number_decimalquantity.h"
 #include "number_decnum.h"
+#include "double-conversion.h"
+#include "charstr.h"
 #include "math.h"
 #include <cmath>
 #include "number_utils.h"
 #include "numbertest.h"
 
+using double_conversion::DoubleToStringConverter;
+
 void DecimalQuantityTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char *) {
     if (exec) {
         logln("TestSuite DecimalQuantityTest: ");
@@ -32,6 +36,8 @@ void DecimalQuantityTest::runIndexedTest(int32_t index, UBool exec, const char *
         TESTCASE_AUTO(testNickelRounding);
         TESTCASE_AUTO(testCompactDecimalSuppressedExponent);
         TESTCASE_AUTO(testSuppressedExponentUnchangedByInitialScaling);
+        TESTCASE_AUTO(testLongDecimals);
+        TESTCASE_AUTO(testShortestDouble);
     TESTCASE_AUTO_END;
 }
 
@@ -656,4 +662,98 @@ void DecimalQuantityTest::testSuppressedExponentUnchangedByInitialScaling() {
     }
 }
 
+void DecimalQuantityTest::testLongDecimals() {
+    IcuTestErrorCode status(*this, "testLongDecimals");
+    DecimalQuantity fq;
+
+    // Round trip through decNumber, which shares the byte array layout
+    fq.setToDecNumber("-1234567890123456789012345.678901", status);
+    assertToStringAndHealth(fq, u"<DecimalQuantity 0:0 bytes -1234567890123456789012345678901E-6>");
+    DecNum dn;
+    fq.toDecNum(dn, status);
+    DecimalQuantity copy;
+    copy.setToDecNum(dn, status);
+    assertEquals("Round trip", fq.toPlainString(), copy.toPlainString());
+    assertTrue("Round trip negative", copy.isNegative());
+
+    // Shifts on the byte array
+    DecNum multiplicand;
+    multiplicand.setTo("1000", status);
+    fq.multiplyBy(multiplicand, status);
+    assertToStringAndHealth(fq, u"<DecimalQuantity 0:0 bytes -1234567890123456789012345678901E-3>");
+    fq.roundToMagnitude(-2, RoundingMode::UNUM_ROUND_HALFEVEN, status);
+    assertToStringAndHealth(fq, u"<DecimalQuantity 0:0 bytes -12345678901234567890123456789E-1>");
+    fq.roundToMagnitude(20, RoundingMode::UNUM_ROUND_CEILING, status);
+    assertToStringAndHealth(fq, u"<DecimalQuantity 0:0 long -12345678E20>");
+    fq.setToDecNumber("99999999999999999999.5", status);
+    fq.roundToMagnitude(0, RoundingMode::UNUM_ROUND_HALFUP, status);
+    assertToStringAndHealth(fq, u"<DecimalQuantity 0:0 long 1E20>");
+    fq.setToDecNumber("12345678901234567890", status);
+    fq.appendDigit(7, 3, false);
+    assertEquals("Append", u"12345678901234567890.0007", fq.toPlainString());
+    assertHealth(fq);
+
+    // Numbers in the long storage, and zero
+    fq.setToLong(-9876543210LL);
+    fq.toDecNum(dn, status);
+    copy.setToDecNum(dn, status);
+    assertEquals("Long round trip", u"-9876543210", copy.toPlainString());
+    fq.setToLong(0);
+    fq.toDecNum(dn, status);
+    copy.setToDecNum(dn, status);
+    assertEquals("Zero round trip", u"0", copy.toPlainString());
+}
+
+void DecimalQuantityTest::testShortestDouble() {
+    IcuTestErrorCode status(*this, "testShortestDouble");
+    // Doubles with a short decimal form take a fast path; the digits must be the same as from
+    // double-conversion.
+    double doubles[3000];
+    int32_t count = 0;
+    uint64_t seed = 12345;
+    while (count < UPRV_LENGTHOF(doubles)) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint64_t bits = seed >> 11;
+        double d;
+        switch (count % 3) {
+        case 0:
+            // Decimal data, like prices and measurements
+            d = static_cast<double>(bits % 100000000) / std::pow(10.0, static_cast<double>(bits % 12));
+            break;
+        case 1:
+            d = static_cast<double>(bits % 1000) * std::pow(10.0, static_cast<double>(bits % 40) - 20);
+            break;
+        default:
+            // Any double
+            uprv_memcpy(&d, &seed, sizeof(d));
+            break;
+        }
+        if (std::isnan(d) || !std::isfinite(d) || d == 0) { continue; }
+        doubles[count++] = std::fabs(d);
+    }
+
+    for (double d : doubles) {
+        char buffer[DoubleToStringConverter::kBase10MaximalLength + 1];
+        bool sign;
+        int32_t length;
+        int32_t point;
+        DoubleToStringConverter::DoubleToAscii(
+            d, DoubleToStringConverter::DtoaMode::SHORTEST, 0,
+            buffer, sizeof(buffer), &sign, &length, &point);
+        char exponent[16];
+        snprintf(exponent, sizeof(exponent), "E%d", point - length);
+        CharString decimal;
+        decimal.append(buffer, length, status).append(exponent, status);
+        DecimalQuantity expected;
+        expected.setToDecNumber(decimal.toStringPiece(), status);
+
+        DecimalQuantity actual;
+        actual.setToDouble(d);
+        actual.roundToInfinity();
+        assertEquals(decimal.data(), expected.toScientificString(), actual.toScientificString());
+        // Back to a double, with the fast path for short decimals
+        assertEquals(decimal.data(), d, expected.toDouble());
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
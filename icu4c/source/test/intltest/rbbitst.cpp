@@ -30,6 +30,7 @@
 #endif
 #include "unicode/schriter.h"
 #include "unicode/uchar.h"
+#include "unicode/ucharstriebuilder.h"
 #include "unicode/utf16.h"
 #include "unicode/ucnv.h"
 #include "unicode/uniset.h"
@@ -41,9 +42,11 @@
 #include "charstr.h"
 #include "cmemory.h"
 #include "cstr.h"
+#include "dictionarydata.h"
 #include "intltest.h"
 #include "rbbitst.h"
 #include "rbbidata.h"
+#include "ucmndata.h"
 #include "utypeinfo.h"  // for 'typeid' to work
 #include "uvector.h"
 #include "uvectr32.h"
@@ -128,6 +131,7 @@ void RBBITest::runIndexedTest( int32_t index, UBool exec, const char* &name, cha
     TESTCASE_AUTO(TestReverse);
     TESTCASE_AUTO(TestBug13692);
     TESTCASE_AUTO(TestDebugRules);
+    TESTCASE_AUTO(TestRegisterDictionary);
 
 #if U_ENABLE_TRACING
     TESTCASE_AUTO(TestTraceCreateCharacter);
@@ -4883,6 +4887,137 @@ void RBBITest::TestDebugRules() {
 #endif
 }
 
+// Register a dictionary for New Tai Lue, for which ICU has none, and check
+// that word break iteration segments with it.
+void RBBITest::TestRegisterDictionary() {
+    IcuTestErrorCode status(*this, "TestRegisterDictionary");
+    const UnicodeString text(u"\u1980\u1981\u1982\u1983\u1984\u1985\u1980\u1981");
+    const UnicodeSet taiLue(u"[\u1980-\u19AB]", status);
+
+    // Without a dictionary, the run of New Tai Lue is a single word.
+    LocalPointer<BreakIterator> bi(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    if (status.errDataIfFailureAndReset("createWordInstance")) {
+        return;
+    }
+    bi->setText(text);
+    assertEquals("unregistered first", 0, bi->first());
+    assertEquals("unregistered next", 8, bi->next());
+
+    // Build the dictionary data file image the way gendict does:
+    // ICU data header, indexes, then a UCharsTrie.
+    UCharsTrieBuilder builder(status);
+    builder.add(u"\u1980\u1981", 0, status);
+    builder.add(u"\u1982\u1983\u1984", 0, status);
+    UnicodeString trie;
+    builder.buildUnicodeString(USTRINGTRIE_BUILD_SMALL, trie, status);
+    if (status.errIfFailureAndReset()) {
+        return;
+    }
+
+    const int32_t headerSize = 32;
+    const int32_t trieOffset = DictionaryData::IX_COUNT * 4;
+    const int32_t totalSize = trieOffset + trie.length() * U_SIZEOF_UCHAR;
+    std::vector<int32_t> buffer((headerSize + totalSize + 3) / 4, 0);
+    DataHeader *header = reinterpret_cast<DataHeader *>(buffer.data());
+    header->dataHeader.headerSize = headerSize;
+    header->dataHeader.magic1 = 0xda;
+    header->dataHeader.magic2 = 0x27;
+    header->info.size = sizeof(UDataInfo);
+    header->info.isBigEndian = U_IS_BIG_ENDIAN;
+    header->info.charsetFamily = U_CHARSET_FAMILY;
+    header->info.sizeofUChar = U_SIZEOF_UCHAR;
+    uprv_memcpy(header->info.dataFormat, "Dict", 4);
+    header->info.formatVersion[0] = 1;
+    int32_t *indexes = buffer.data() + headerSize / 4;
+    indexes[DictionaryData::IX_STRING_TRIE_OFFSET] = trieOffset;
+    indexes[DictionaryData::IX_RESERVED1_OFFSET] = totalSize;
+    indexes[DictionaryData::IX_RESERVED2_OFFSET] = totalSize;
+    indexes[DictionaryData::IX_TOTAL_SIZE] = totalSize;
+    indexes[DictionaryData::IX_TRIE_TYPE] = DictionaryData::TRIE_TYPE_UCHARS;
+    indexes[DictionaryData::IX_TRANSFORM] = DictionaryData::TRANSFORM_NONE;
+    trie.extract(reinterpret_cast<UChar *>(indexes) + trieOffset / U_SIZEOF_UCHAR, trie.length(), status);
+    if (status.errIfFailureAndReset()) {
+        return;
+    }
+    int32_t length = headerSize + totalSize;
+
+    // Rejected registrations.
+    RuleBasedBreakIterator::registerDictionary(UnicodeSet(), buffer.data(), length, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+    RuleBasedBreakIterator::registerDictionary(taiLue, buffer.data(), 8, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+    RuleBasedBreakIterator::registerDictionary(taiLue, buffer.data(), headerSize + 8, status);
+    status.expectErrorAndReset(U_INVALID_FORMAT_ERROR);
+    header->info.formatVersion[0] = 2;
+    RuleBasedBreakIterator::registerDictionary(taiLue, buffer.data(), length, status);
+    status.expectErrorAndReset(U_INVALID_FORMAT_ERROR);
+    header->info.formatVersion[0] = 1;
+
+    URegistryKey key = RuleBasedBreakIterator::registerDictionary(taiLue, buffer.data(), length, status);
+    if (status.errIfFailureAndReset()) {
+        return;
+    }
+    assertTrue("registry key", key != NULL);
+
+    // Dictionary words are split apart; the unknown U+1985 is a word of its own.
+    bi.adoptInstead(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    if (status.errIfFailureAndReset()) {
+        RuleBasedBreakIterator::unregisterDictionary(key, status);
+        return;
+    }
+    bi->setText(text);
+    static const int32_t expected[] = {0, 2, 5, 6, 8};
+    int32_t i = 0;
+    for (int32_t pos = bi->first(); pos != BreakIterator::DONE; pos = bi->next()) {
+        if (i >= UPRV_LENGTHOF(expected)) {
+            errln("Unexpected extra boundary %d", pos);
+            break;
+        }
+        assertEquals(UnicodeString("boundary ") + i, expected[i], pos);
+        ++i;
+    }
+    assertEquals("boundary count", UPRV_LENGTHOF(expected), i);
+    bi.adoptInstead(nullptr);
+
+    // Unregister, so that the dictionary data does not need to outlive this test.
+    // New break iterators are back to treating the run as one word.
+    assertTrue("unregister", RuleBasedBreakIterator::unregisterDictionary(key, status));
+    status.errIfFailureAndReset();
+    assertFalse("unregister twice", RuleBasedBreakIterator::unregisterDictionary(key, status));
+    status.errIfFailureAndReset();
+    bi.adoptInstead(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    if (status.errIfFailureAndReset()) {
+        return;
+    }
+    bi->setText(text);
+    assertEquals("unregistered again first", 0, bi->first());
+    assertEquals("unregistered again next", 8, bi->next());
+
+    // A break iterator keeps using the dictionary after it is unregistered,
+    // and the engine goes away with the iterator, so that repeated
+    // registration does not accumulate engines.
+    for (int32_t cycle = 0; cycle < 20; ++cycle) {
+        key = RuleBasedBreakIterator::registerDictionary(taiLue, buffer.data(), length, status);
+        if (status.errIfFailureAndReset()) {
+            return;
+        }
+        bi.adoptInstead(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+        if (status.errIfFailureAndReset()) {
+            RuleBasedBreakIterator::unregisterDictionary(key, status);
+            return;
+        }
+        bi->setText(text);
+        assertEquals("cycle first", 0, bi->first());
+        assertEquals("cycle next", 2, bi->next());
+        assertTrue("cycle unregister", RuleBasedBreakIterator::unregisterDictionary(key, status));
+        bi->setText(text);
+        assertEquals("cycle first after unregister", 0, bi->first());
+        assertEquals("cycle next after unregister", 2, bi->next());
+        status.errIfFailureAndReset();
+    }
+    bi.adoptInstead(nullptr);
+}
+
 #if U_ENABLE_TRACING
 static std::vector<std::string> gData;
 static std::vector<int32_t> gEntryFn;
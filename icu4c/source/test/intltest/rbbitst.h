@@ -83,6 +83,7 @@ class RBBITest: public IntlTest {
     void TestReverse(std::unique_ptr<RuleBasedBreakIterator>bi);
     void TestBug13692();
     void TestDebugRules();
+    void TestRegisterDictionary();
 
     void TestDebug();
     void TestProperties();
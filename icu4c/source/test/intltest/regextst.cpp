@@ -31,6 +31,7 @@
 
 #include "unicode/localpointer.h"
 #include "unicode/regex.h"
+#include "unicode/regexset.h"
 #include "unicode/stringpiece.h"
 #include "unicode/uchar.h"
 #include "unicode/ucnv.h"
@@ -107,6 +108,11 @@ void RegexTest::runIndexedTest( int32_t index, UBool exec, const char* &name, ch
     TESTCASE_AUTO(TestBug13632);
     TESTCASE_AUTO(TestBug20359);
     TESTCASE_AUTO(TestBug20863);
+    TESTCASE_AUTO(TestDFAPrefilter);
+    TESTCASE_AUTO(TestRequiredString);
+    TESTCASE_AUTO(TestRegexSet);
+    TESTCASE_AUTO(TestUTF8Find);
+    TESTCASE_AUTO(TestDFAMatches);
     TESTCASE_AUTO_END;
 }
 
@@ -1224,16 +1230,16 @@ void RegexTest::API_Match() {
 
     //
     //  Time Outs.
-    //       Note:  These tests will need to be changed when the regexp engine is
-    //              able to detect and cut short the exponential time behavior on
-    //              this type of match.
+    //       Note:  A pattern like "(a+)+b" is matched by the DFA, which cuts short the
+    //              exponential time behavior on this type of match. The back reference
+    //              keeps these patterns in the backtracking engine.
     //
     {
         UErrorCode status = U_ZERO_ERROR;
         //    Enough 'a's in the string to cause the match to time out.
         //       (Each on additonal 'a' doubles the time)
         UnicodeString testString("aaaaaaaaaaaaaaaaaaaaa");
-        RegexMatcher matcher("(a+)+b", testString, 0, status);
+        RegexMatcher matcher("(a+)+b\\1", testString, 0, status);
         REGEX_CHECK_STATUS;
         REGEX_ASSERT(matcher.getTimeLimit() == 0);
         matcher.setTimeLimit(100, status);
@@ -1241,11 +1247,21 @@ void RegexTest::API_Match() {
         REGEX_ASSERT(matcher.lookingAt(status) == FALSE);
         REGEX_ASSERT(status == U_REGEX_TIME_OUT);
     }
+    {
+        UErrorCode status = U_ZERO_ERROR;
+        //   Without the back reference, the DFA fails the match within the time limit.
+        UnicodeString testString("aaaaaaaaaaaaaaaaaaaaa");
+        RegexMatcher matcher("(a+)+b", testString, 0, status);
+        REGEX_CHECK_STATUS;
+        matcher.setTimeLimit(100, status);
+        REGEX_ASSERT(matcher.lookingAt(status) == FALSE);
+        REGEX_CHECK_STATUS;
+    }
     {
         UErrorCode status = U_ZERO_ERROR;
         //   Few enough 'a's to slip in under the time limit.
         UnicodeString testString("aaaaaaaaaaaaaaaaaa");
-        RegexMatcher matcher("(a+)+b", testString, 0, status);
+        RegexMatcher matcher("(a+)+b\\1", testString, 0, status);
         REGEX_CHECK_STATUS;
         matcher.setTimeLimit(100, status);
         REGEX_ASSERT(matcher.lookingAt(status) == FALSE);
@@ -6014,4 +6030,478 @@ void RegexTest::TestBug20863() {
 }
 
 
+void RegexTest::TestDFAPrefilter() {
+    // Patterns made only of literals, sets, alternation and loops are first checked
+    // with a DFA. Input that can not match must fail quickly, without running the
+    // backtracking engine, which would take exponential time on these patterns.
+    // The check is also made when a time limit is set, so the limit is not reached.
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString input;
+    for (int32_t i=0; i<60; ++i) {
+        input.append(u'a');
+    }
+    static const char16_t *patterns[] = {u"(a|aa)+b", u"(a+)+b", u"(?:a*)*[bc]", u"(.*a)+(.*a)+x"};
+    for (const char16_t *pat: patterns) {
+        LocalPointer<RegexMatcher> matcher(new RegexMatcher(UnicodeString(pat), input, 0, status), status);
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        assertFalse(WHERE, matcher->find(status));
+        assertFalse(WHERE, matcher->lookingAt(status));
+        assertFalse(WHERE, matcher->matches(status));
+        assertSuccess(WHERE, status);
+        assertTrue(WHERE, matcher->hitEnd());
+
+        matcher->setTimeLimit(10, status);
+        assertFalse(WHERE, matcher->lookingAt(status));
+        assertFalse(WHERE, matcher->find(0, status));
+        assertSuccess(WHERE, status);
+    }
+
+    // Input that does match still gets the normal match results and capture groups.
+    LocalPointer<RegexPattern> pattern(RegexPattern::compile(u"(a|aa)+(b)", 0, status), status);
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    RegexPattern patternCopy(*pattern);
+    UnicodeString matchInput(u"xaaab aab");
+    LocalPointer<RegexMatcher> matcher(patternCopy.matcher(matchInput, status), status);
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    assertTrue(WHERE, matcher->find(status));
+    assertEquals(WHERE, 1, matcher->start(status));
+    assertEquals(WHERE, 5, matcher->end(status));
+    assertEquals(WHERE, u"a", matcher->group(1, status));
+    assertEquals(WHERE, u"b", matcher->group(2, status));
+    assertTrue(WHERE, matcher->find(status));
+    assertEquals(WHERE, 6, matcher->start(status));
+    assertFalse(WHERE, matcher->find(status));
+    assertFalse(WHERE, matcher->matches(status));
+    matcher->reset(UnicodeString(u"aab"));
+    assertTrue(WHERE, matcher->matches(status));
+    assertTrue(WHERE, matcher->lookingAt(1, status));
+    assertEquals(WHERE, 3, matcher->end(status));
+    assertSuccess(WHERE, status);
+
+    // Line endings and the DOTALL CR/LF pair.
+    LocalPointer<RegexMatcher> dotMatcher(new RegexMatcher(u"a.b", UnicodeString(u"a\nb a\r\nb"), UREGEX_DOTALL, status), status);
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    assertTrue(WHERE, dotMatcher->find(status));
+    assertEquals(WHERE, 0, dotMatcher->start(status));
+    assertTrue(WHERE, dotMatcher->find(status));
+    assertEquals(WHERE, 4, dotMatcher->start(status));
+    assertEquals(WHERE, 8, dotMatcher->end(status));
+    assertFalse(WHERE, dotMatcher->find(status));
+    assertSuccess(WHERE, status);
+}
+
+
+void RegexTest::TestRequiredString() {
+    // find() first checks that a literal string required by every match occurs in the input.
+    // Literals that are optional, or in alternatives or look-around, must not be required.
+    static const struct {
+        const char16_t *pattern;
+        const char16_t *input;
+        int32_t        start;       // Expected start of the first match, -1 for none.
+    } cases[] = {
+        {u"\\d+ ERROR: .*",  u"12 WARN: x\n34 ERROR: y", 11},
+        {u"\\d+ ERROR: .*",  u"12 WARN: x\n34 EROR: y",  -1},
+        {u"(foo|bar)baz",      u"barbaz",                   0},
+        {u"(foo|bar)baz",      u"barbax",                  -1},
+        {u"ab?c",              u"xac",                      1},
+        {u"(?:abc)?d",         u"xd",                       1},
+        {u"(?:ab)*cd",         u"abxcd",                    3},
+        {u"q{0,2}zz",          u"zz",                       0},
+        {u"q{1,2}zz",          u"qzq",                     -1},
+        {u".(?=abc)",          u"xabc",                     0},
+        {u".(?<!abc)d",        u"xd",                       0},
+        {u"(?i)\\w+ERROR",   u"xerror",                   0},
+        {u"[a-z]+\\x{1F600}", u"ab\\x{1F600}",            -1},
+        {u"[a-z]+\\x{1F600}", u"ab\U0001F600",             0},
+    };
+    for (const auto &cas: cases) {
+        UErrorCode status = U_ZERO_ERROR;
+        UnicodeString pattern(cas.pattern);
+        UnicodeString input(cas.input);
+        LocalPointer<RegexMatcher> matcher(new RegexMatcher(pattern, input, 0, status), status);
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        assertEquals(UnicodeString(WHERE) + " " + pattern, (UBool)(cas.start >= 0), matcher->find(status));
+        if (cas.start >= 0) {
+            assertEquals(UnicodeString(WHERE) + " " + pattern, cas.start, matcher->start(status));
+        }
+        assertSuccess(WHERE, status);
+
+        // The same, on UTF-8 input.
+        std::string utf8Input;
+        input.toUTF8String(utf8Input);
+        LocalUTextPointer ut(utext_openUTF8(NULL, utf8Input.data(), (int64_t)utf8Input.length(), &status));
+        matcher->reset(ut.getAlias());
+        assertEquals(UnicodeString(WHERE) + " " + pattern, (UBool)(cas.start >= 0), matcher->find(status));
+        assertSuccess(WHERE, status);
+    }
+
+    // Repeated find() calls, and a region that excludes the required string.
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString input(u"id=1 id=22 id=333");
+    RegexMatcher matcher(u"id=\\d+", input, 0, status);
+    int32_t count = 0;
+    while (matcher.find(status)) {
+        ++count;
+    }
+    assertEquals(WHERE, 3, count);
+    matcher.region(6, 10, status);
+    assertFalse(WHERE, matcher.find(status));
+    matcher.region(4, 17, status);
+    assertTrue(WHERE, matcher.find(status));
+    assertEquals(WHERE, 5, matcher.start(status));
+    assertSuccess(WHERE, status);
+
+    // Start positions too far before an occurrence of the required string are skipped.
+    // The matches must be the same as the engine's, which tries every position when
+    // there is a find progress callback.
+    static const char16_t *skipPatterns[] = {
+        u"(\\d{1,3})-ERR",
+        u"(?:ab|c)(\\w?)xyz",
+        u"([^ ]{0,4})\\x{1F600}",
+        u"(a|\\u00e9\\u00e9)z",
+        u"(.)..needle",
+    };
+    static const char16_t *skipInputs[] = {
+        u"1234-ERR 12-ERR x-ERR",
+        u"abxyz cxyz abqxyz aqxyz",
+        u"\u00e9\u00e9\U0001F600 abcdef\U0001F600 \U0001F600",
+        u"\u00e9\u00e9z az \u00e9z",
+        u"\u4e00\u4e01\u4e02needle xyneedle",
+    };
+    for (const char16_t *skipPattern: skipPatterns) {
+        for (const char16_t *skipInput: skipInputs) {
+            UnicodeString utf16Input = UnicodeString(skipInput).unescape();
+            std::string utf8Input;
+            utf16Input.toUTF8String(utf8Input);
+            RegexMatcher m(skipPattern, 0, status);
+            RegexMatcher expected(skipPattern, 0, status);
+            progressCallBackContext cbInfo = {this, 0, 0, 0};
+            cbInfo.reset(INT32_MAX);
+            expected.setFindProgressCallback(testProgressCallBackFn, &cbInfo, status);
+            for (int32_t utf8 = 0; utf8 < 2; utf8++) {
+                if (utf8) {
+                    m.resetUTF8(utf8Input.data(), (int64_t)utf8Input.length(), status);
+                    expected.resetUTF8(utf8Input.data(), (int64_t)utf8Input.length(), status);
+                } else {
+                    m.reset(utf16Input);
+                    expected.reset(utf16Input);
+                }
+                UnicodeString where = UnicodeString(WHERE) + " " + skipPattern + " / " + skipInput;
+                for (;;) {
+                    UBool found = m.find(status);
+                    assertEquals(where, expected.find(status), found);
+                    assertEquals(where, expected.hitEnd(), m.hitEnd());
+                    if (!found || U_FAILURE(status)) {
+                        break;
+                    }
+                    assertEquals(where, expected.start64(status), m.start64(status));
+                    assertEquals(where, expected.end64(status), m.end64(status));
+                }
+            }
+            assertSuccess(WHERE, status);
+        }
+    }
+}
+
+
+void RegexTest::TestRegexSet() {
+    // A RegexSet must report the same matches as separate RegexMatchers, for patterns
+    // that are combined into its DFA and for those that are not.
+    static const UnicodeString patterns[] = {
+        u"ERROR: \\w+",           // Combined.
+        u"(foo|bar)+baz",
+        u"[\\u0430-\\u044f]+\\d",
+        u"x*",                      // Matches everywhere.
+        u"\\d{3}-\\d{4}",       // Counted loop, matched separately.
+        u"(?i)warn",                // Case insensitive.
+        u"^start",                  // Anchored.
+        u"(?s)a.\\n",             // Dot-all; the DFA is not exact for CR/LF.
+        u"(\\w)\\1",            // Back reference.
+    };
+    static const char16_t *inputs[] = {
+        u"",
+        u"ERROR: disk full",
+        u"ERROR:",
+        u"foobarbaz 555-1234",
+        u"start of WARNing",
+        u"not start \u0434\u043e7",
+        u"a\r\n",
+        u"ab\n",
+        u"no doubles",
+        u"aa",
+    };
+    int32_t count = UPRV_LENGTHOF(patterns);
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError pe;
+    LocalPointer<RegexSet> set(RegexSet::compile(patterns, count, 0, pe, status), status);
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    assertEquals(WHERE, count, set->size());
+    assertEquals(WHERE, patterns[4], set->getPattern(4).pattern());
+
+    for (const char16_t *inputChars: inputs) {
+        UnicodeString input(inputChars);
+        UBool matched[UPRV_LENGTHOF(patterns)];
+        int32_t found = set->findAll(input, matched, status);
+        int32_t expectedFound = 0;
+        for (int32_t i = 0; i < count; i++) {
+            RegexMatcher matcher(patterns[i], input, 0, status);
+            UBool expected = matcher.find(status);
+            assertEquals(UnicodeString(WHERE) + " " + patterns[i] + " / " + input, expected, matched[i]);
+            expectedFound += expected;
+        }
+        assertEquals(WHERE, expectedFound, found);
+
+        // The same, on UTF-8 input.
+        std::string utf8Input;
+        input.toUTF8String(utf8Input);
+        LocalUTextPointer ut(utext_openUTF8(NULL, utf8Input.data(), (int64_t)utf8Input.length(), &status));
+        UBool matched8[UPRV_LENGTHOF(patterns)];
+        assertEquals(WHERE, found, set->findAll(ut.getAlias(), matched8, status));
+        for (int32_t i = 0; i < count; i++) {
+            assertEquals(UnicodeString(WHERE) + " " + patterns[i] + " / " + input, matched[i], matched8[i]);
+        }
+        assertEquals(WHERE, found, set->findAllUTF8(utf8Input, matched8, status));
+        for (int32_t i = 0; i < count; i++) {
+            assertEquals(UnicodeString(WHERE) + " " + patterns[i] + " / " + input, matched[i], matched8[i]);
+        }
+        assertSuccess(WHERE, status);
+    }
+
+    // Many patterns in one set.
+    UnicodeString manyPatterns[200];
+    for (int32_t i = 0; i < UPRV_LENGTHOF(manyPatterns); i++) {
+        manyPatterns[i] = UnicodeString(u"key") + Int64ToUnicodeString(i) + u"=[a-z]+";
+    }
+    LocalPointer<RegexSet> manySet(RegexSet::compile(manyPatterns, UPRV_LENGTHOF(manyPatterns), 0, pe, status), status);
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    UBool manyMatched[UPRV_LENGTHOF(manyPatterns)];
+    assertEquals(WHERE, 3, manySet->findAll(u"key7=x key17= key170=y key199=zz", manyMatched, status));
+    assertTrue(WHERE, manyMatched[7] && manyMatched[170] && manyMatched[199]);
+    assertFalse(WHERE, manyMatched[17] || manyMatched[1] || manyMatched[19]);
+    assertSuccess(WHERE, status);
+
+    // A pattern that does not compile.
+    static const UnicodeString badPatterns[] = {u"abc", u"a(b"};
+    LocalPointer<RegexSet> badSet(RegexSet::compile(badPatterns, 2, 0, pe, status), status);
+    assertEquals(WHERE, U_REGEX_MISMATCHED_PAREN, status);
+    assertTrue(WHERE, badSet.isNull());
+}
+
+
+void RegexTest::TestUTF8Find() {
+    // find() on UTF-8 input, set with resetUTF8(), uregex_setUTF8() or reset(UText *)
+    // with a UText from utext_openUTF8(), scans the input bytes directly for possible
+    // match starts, within the region. The matches must be the same as those found
+    // through UText alone, which is what happens when there is a find progress callback.
+    static const char16_t *patterns[] = {
+        u"o",                       // Start character.
+        u"\\u00e9t\\u00e9",         // Start string, multi-byte.
+        u"\\U0001F600+",            // Supplementary start character.
+        u"\\uFFFD",                 // Also matches ill-formed input.
+        u"[\\u0430-\\u044f]+\\d",   // Start set.
+        u"[a\\u4e00]b*",
+        u"\\d{2}-\\d{2}",           // Start set, counted loops.
+        u"(?i)x.*y",                // Start set, case insensitive.
+        u"\\w+ing",                 // Required string.
+    };
+    static const char *inputs[] = {
+        "",
+        "foo boo",
+        "caf\xc3\xa9 \xc3\xa9t\xc3\xa9 \xc3\xa9t\xc3\xa9",
+        "\xf0\x9f\x98\x80\xf0\x9f\x98\x80 x \xf0\x9f\x98\x80",
+        "bad \xc3 \xe0\x80 \xef\xbf\xbd o \xff",
+        "\xd0\xb4\xd0\xbe" "7 \xe4\xb8\x80" "bb ab",
+        "12-34 1-2 56-78",
+        "X then Y, x\xc3y",
+        "nothing singing ring",
+    };
+    UErrorCode status = U_ZERO_ERROR;
+    for (const char16_t *pattern: patterns) {
+        UParseError pe;
+        LocalPointer<RegexPattern> pat(RegexPattern::compile(UnicodeString(pattern), 0, pe, status), status);
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        for (int32_t i = 0; i < 2 * UPRV_LENGTHOF(inputs); i++) {
+            // Each input on its own, then within a region that leaves out its first and
+            //   last code points.
+            const char *input = inputs[i / 2];
+            UBool inRegion = (i & 1) != 0;
+            int32_t regionStart = 0;
+            int32_t regionLimit = (int32_t)strlen(input);
+            if (inRegion && regionLimit > 0) {
+                U8_FWD_1(input, regionStart, regionLimit);
+                U8_BACK_1((const uint8_t *)input, regionStart, regionLimit);
+            }
+            LocalUTextPointer ut(utext_openUTF8(NULL, input, -1, &status));
+            LocalPointer<RegexMatcher> m(pat->matcher(status), status);
+            LocalPointer<RegexMatcher> mUText(pat->matcher(status), status);
+            LocalPointer<RegexMatcher> expected(pat->matcher(status), status);
+            LocalURegularExpressionPointer re(uregex_open(pattern, -1, 0, NULL, &status));
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            progressCallBackContext cbInfo = {this, 0, 0, 0};
+            cbInfo.reset(INT32_MAX);
+            expected->setFindProgressCallback(testProgressCallBackFn, &cbInfo, status);
+            m->resetUTF8(input, -1, status);
+            mUText->reset(ut.getAlias());
+            expected->reset(ut.getAlias());
+            uregex_setUTF8(re.getAlias(), input, -1, &status);
+            if (inRegion) {
+                m->region(regionStart, regionLimit, status);
+                mUText->region(regionStart, regionLimit, status);
+                expected->region(regionStart, regionLimit, status);
+                uregex_setRegion64(re.getAlias(), regionStart, regionLimit, &status);
+            }
+            for (;;) {
+                UBool found = m->find(status);
+                UBool foundUText = mUText->find(status);
+                UBool foundC = uregex_findNext(re.getAlias(), &status);
+                UBool expectedFound = expected->find(status);
+                UnicodeString where = UnicodeString(WHERE) + " " + pattern + " / " + input +
+                                      (inRegion ? " (region)" : "");
+                assertEquals(where, expectedFound, found);
+                assertEquals(where, expectedFound, foundUText);
+                assertEquals(where, expectedFound, foundC);
+                assertEquals(where, (UBool)expected->hitEnd(), (UBool)m->hitEnd());
+                if (!found || !foundUText || !foundC || !expectedFound) {
+                    break;
+                }
+                assertEquals(where, expected->start64(status), m->start64(status));
+                assertEquals(where, expected->end64(status), m->end64(status));
+                assertEquals(where, expected->start64(status), mUText->start64(status));
+                assertEquals(where, expected->end64(status), mUText->end64(status));
+                assertEquals(where, expected->start64(status), uregex_start64(re.getAlias(), 0, &status));
+                assertEquals(where, expected->end64(status), uregex_end64(re.getAlias(), 0, &status));
+            }
+            assertSuccess(WHERE, status);
+        }
+    }
+}
+
+
+void RegexTest::TestDFAMatches() {
+    // For patterns without capture groups, the DFA finds matches by itself, without
+    // the backtracking engine. The results, including hitEnd() and requireEnd(), must
+    // be the same as the engine's, which is used when there is a find progress callback.
+    static const char16_t *patterns[] = {
+        u"a+b",
+        u"(?:a|ab)(?:c|bcd)",       // Leftmost first, not longest.
+        u"a|",
+        u"",
+        u"^abc",
+        u"abc$",
+        u"\\s*$",
+        u"x\\Z",
+        u"x\\z",
+        u"(?m)^b",
+        u"(?m)c$",
+        u"(?d)x$",
+        u"(?md)^x$",
+        u"\\bfoo\\b",
+        u"\\Bo",
+        u"(?i)stra\\u00dfe",      // Full case folding.
+        u"(?i)\\u00df",
+        u"(?i)k",
+        u"a{2,4}",
+        u"(?:ab){1,3}?c",
+        u"(?:a|b){3,}",
+        u"(?s).*b",
+        u".*$",
+        u"(?s)a.b",
+        u"[a-c]*?c",
+        u"(?:x*)*y",                // Nullable loop, left to the engine.
+        u"\\d+(?:\\.\\d+)?",
+    };
+    static const char16_t *inputs[] = {
+        u"",
+        u"abc",
+        u"aab abcd",
+        u"foo foobar foo",
+        u"a\r\nb\r\n",
+        u"x\n",
+        u"xx\r\n",
+        u"b\nb\r\nc",
+        u"STRASSE strasse Stra\u00dfe",
+        u"\u212a k",
+        u"aaaaa",
+        u"ababc",
+        u"abcabc\n",
+        u"x\u0301foo",
+        u"1.5 22.",
+    };
+    UErrorCode status = U_ZERO_ERROR;
+    for (const char16_t *pattern: patterns) {
+        UParseError pe;
+        LocalPointer<RegexPattern> pat(RegexPattern::compile(UnicodeString(pattern), 0, pe, status), status);
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        for (const char16_t *inputChars: inputs) {
+            UnicodeString input(inputChars);
+            input = input.unescape();
+            std::string utf8Input;
+            input.toUTF8String(utf8Input);
+            LocalPointer<RegexMatcher> m(pat->matcher(input, status), status);
+            LocalPointer<RegexMatcher> m8(pat->matcher(status), status);
+            LocalPointer<RegexMatcher> expected(pat->matcher(input, status), status);
+            LocalPointer<RegexMatcher> expected8(pat->matcher(status), status);
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            progressCallBackContext cbInfo = {this, 0, 0, 0};
+            cbInfo.reset(INT32_MAX);
+            expected->setFindProgressCallback(testProgressCallBackFn, &cbInfo, status);
+            expected8->setFindProgressCallback(testProgressCallBackFn, &cbInfo, status);
+            m8->resetUTF8(utf8Input.data(), (int64_t)utf8Input.length(), status);
+            expected8->resetUTF8(utf8Input.data(), (int64_t)utf8Input.length(), status);
+            UnicodeString where = UnicodeString(WHERE) + " " + pattern + " / " + input;
+
+            RegexMatcher *matchers[] = {m.getAlias(), expected.getAlias(), m8.getAlias(), expected8.getAlias()};
+            for (int32_t i = 0; i < UPRV_LENGTHOF(matchers); i += 2) {
+                RegexMatcher &dfaMatcher = *matchers[i];
+                RegexMatcher &engine = *matchers[i + 1];
+                for (;;) {
+                    UBool found = dfaMatcher.find(status);
+                    UBool expectedFound = engine.find(status);
+                    assertEquals(where, expectedFound, found);
+                    assertEquals(where, engine.hitEnd(), dfaMatcher.hitEnd());
+                    assertEquals(where, engine.requireEnd(), dfaMatcher.requireEnd());
+                    if (!found || !expectedFound) {
+                        break;
+                    }
+                    assertEquals(where, engine.start64(status), dfaMatcher.start64(status));
+                    assertEquals(where, engine.end64(status), dfaMatcher.end64(status));
+                }
+                assertEquals(where, engine.lookingAt(status), dfaMatcher.lookingAt(status));
+                assertEquals(where, engine.hitEnd(), dfaMatcher.hitEnd());
+                assertEquals(where, engine.requireEnd(), dfaMatcher.requireEnd());
+                if (dfaMatcher.lookingAt(status)) {
+                    assertEquals(where, engine.end64(status), dfaMatcher.end64(status));
+                }
+                assertEquals(where, engine.matches(status), dfaMatcher.matches(status));
+                assertEquals(where, engine.hitEnd(), dfaMatcher.hitEnd());
+                assertEquals(where, engine.requireEnd(), dfaMatcher.requireEnd());
+            }
+            assertSuccess(where, status);
+        }
+    }
+}
+
+
 #endif  /* !UCONFIG_NO_REGULAR_EXPRESSIONS  */
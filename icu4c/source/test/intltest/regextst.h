@@ -61,6 +61,11 @@ class RegexTest: public IntlTest {
     virtual void TestBug13632();
     virtual void TestBug20359();
     virtual void TestBug20863();
+    virtual void TestDFAPrefilter();
+    virtual void TestRequiredString();
+    virtual void TestRegexSet();
+    virtual void TestUTF8Find();
+    virtual void TestDFAMatches();
 
     // The following functions are internal to the regexp tests.
     virtual void assertUText(const char *expected, UText *actual, const char *file, int line);
@@ -24,6 +24,7 @@
 #include "intltest.h"
 #include "tsmthred.h"
 #include "unicode/ushape.h"
+#include "unicode/ucsdet.h"
 #include "unicode/translit.h"
 #include "sharedobject.h"
 #include "unifiedcache.h"
@@ -79,6 +80,9 @@ void MultithreadTest::runIndexedTest( int32_t index, UBool exec,
     TESTCASE_AUTO(Test20104);
 #endif /* #if !UCONFIG_NO_FORMATTING */
 #endif /* #if !UCONFIG_NO_TRANSLITERATION */
+#if !UCONFIG_NO_CONVERSION
+    TESTCASE_AUTO(TestCharsetDetection);
+#endif
     TESTCASE_AUTO_END;
 }
 
@@ -1366,3 +1370,55 @@ void MultithreadTest::Test20104() {
 #endif /* !UCONFIG_NO_FORMATTING */
 
 #endif /* !UCONFIG_NO_TRANSLITERATION */
+
+
+//
+// Charset detection. Each thread classifies a batch of texts with its own detector,
+// reusing it for each text. The detectors share the charset recognizers.
+//
+
+#if !UCONFIG_NO_CONVERSION
+class CharsetDetectionThread : public SimpleThread {
+public:
+    CharsetDetectionThread() {}
+    virtual void run();
+};
+
+void CharsetDetectionThread::run() {
+    static const char *texts[] = {
+        "This is a small sample of some English text. Just enough to be sure that it detects correctly.",
+        "<html><body><p>Some text with \xCE\x91\xCE\x92\xCE\x93\xCE\x94\xCE\x95 in it.</p></body></html>",
+        "\xEF\xBB\xBF" "A UTF-8 text with a byte order mark."
+    };
+    static const char *expected[] = {"ISO-8859-1", "UTF-8", "UTF-8"};
+
+    UErrorCode status = U_ZERO_ERROR;
+    LocalUCharsetDetectorPointer csd(ucsdet_open(&status));
+    ucsdet_enableInputFilter(csd.getAlias(), TRUE);
+    for (int32_t loop = 0; loop < 100; loop++) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(texts); i++) {
+            ucsdet_setText(csd.getAlias(), texts[i], -1, &status);
+            const UCharsetMatch *match = ucsdet_detect(csd.getAlias(), &status);
+            if (!IntlTest::gTest->assertSuccess(WHERE, status)) {
+                return;
+            }
+            const char *name = ucsdet_getName(match, &status);
+            if (uprv_strcmp(name, expected[i]) != 0) {
+                IntlTest::gTest->errln("%s:%d text %d detected as %s, expected %s",
+                                       __FILE__, __LINE__, (int)i, name, expected[i]);
+                return;
+            }
+        }
+    }
+}
+
+void MultithreadTest::TestCharsetDetection() {
+    CharsetDetectionThread threads[4];
+    for (auto &thread:threads) {
+        thread.start();
+    }
+    for (auto &thread:threads) {
+        thread.join();
+    }
+}
+#endif /* !UCONFIG_NO_CONVERSION */
@@ -49,6 +49,7 @@ class MultithreadTest : public IntlTest
     void TestBreakTranslit();
     void TestIncDec();
     void Test20104();
+    void TestCharsetDetection();
 };
 
 #endif
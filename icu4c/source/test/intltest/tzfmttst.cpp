@@ -26,6 +26,7 @@
 #include "cstring.h"
 #include "cstr.h"
 #include "mutex.h"
+#include "tznames_impl.h"
 #include "simplethread.h"
 #include "uassert.h"
 #include "zonemeta.h"
@@ -86,6 +87,7 @@ TimeZoneFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &name
         TESTCASE(6, TestFormatCustomZone);
         TESTCASE(7, TestFormatTZDBNamesAllZoneCoverage);
         TESTCASE(8, TestAdoptDefaultThreadSafe);
+        TESTCASE(9, TestFrozenNamesTrie);
     default: name = ""; break;
     }
 }
@@ -1340,4 +1342,89 @@ TimeZoneFormatTest::TestFormatTZDBNamesAllZoneCoverage(void) {
         }
     }
 }
+namespace {
+
+// Collects the values of all of the keys that a TextTrieMap search matches.
+class TrieValueCollector : public TextTrieMapSearchResultHandler {
+public:
+    UnicodeString fResult;
+    virtual UBool handleMatch(int32_t matchLength, const CharacterNode *node, UErrorCode &) {
+        for (int32_t i = 0; i < node->countValues(); i++) {
+            fResult.append(u' ').append(*(const UChar *)node->getValue(i))
+                   .append((UChar)(0x30 + matchLength));
+        }
+        return TRUE;
+    }
+};
+
+UnicodeString searchTrie(const TextTrieMap &trie, const UnicodeString &text, UErrorCode &status) {
+    TrieValueCollector collector;
+    trie.search(text, 0, &collector, status);
+    return collector.fResult;
+}
+
+UnicodeString findNames(const TimeZoneNames &names, const UnicodeString &text, uint32_t types,
+                        UErrorCode &status) {
+    UnicodeString result;
+    LocalPointer<TimeZoneNames::MatchInfoCollection> matches(names.find(text, 0, types, status));
+    for (int32_t i = 0; matches.isValid() && i < matches->size(); i++) {
+        UnicodeString id;
+        if (!matches->getTimeZoneIDAt(i, id)) {
+            matches->getMetaZoneIDAt(i, id);
+        }
+        result.append(u' ').append(id).append(u'/').append((UChar)(0x30 + matches->getNameTypeAt(i) % 10));
+    }
+    return result;
+}
+
+}  // namespace
+
+void
+TimeZoneFormatTest::TestFrozenNamesTrie(void) {
+    UErrorCode status = U_ZERO_ERROR;
+    // A frozen TextTrieMap finds what it found before, and keys put after
+    // freeze() are found as well.
+    static const UChar a = u'a', b = u'b', c = u'c', d = u'd';
+    TextTrieMap trie(TRUE, NULL);
+    trie.put(u"ab", (void *)&a, status);
+    trie.put(u"AB", (void *)&b, status);
+    trie.put(u"abc", (void *)&c, status);
+    UnicodeString before = searchTrie(trie, u"ABCD", status);
+    assertEquals("before freeze", u" a2 b2 c3", before);
+    trie.freeze(status);
+    assertEquals("frozen", before, searchTrie(trie, u"ABCD", status));
+    trie.put(u"abcd", (void *)&d, status);
+    trie.put(u"x", (void *)&a, status);
+    assertEquals("put after freeze", u" a2 b2 c3 d4", searchTrie(trie, u"ABCD", status));
+    assertEquals("put after freeze, other key", u" a1", searchTrie(trie, u"x", status));
+    assertEquals("frozen again", u" a2 b2 c3 d4", searchTrie(trie, u"abcd", status));
+    assertSuccess("TextTrieMap", status);
+
+    // TimeZoneNames freezes its names trie once all names are loaded, which a
+    // find() without a perfect match triggers. Names of zones that are loaded
+    // after that are still found.
+    LocalPointer<TimeZoneNames> names(TimeZoneNames::createInstance(Locale::getEnglish(), status));
+    if (status == U_MISSING_RESOURCE_ERROR || status == U_FILE_ACCESS_ERROR) {
+        dataerrln("TimeZoneNames::createInstance failed - %s", u_errorName(status));
+        return;
+    }
+    const uint32_t types = UTZNM_LONG_STANDARD | UTZNM_LONG_DAYLIGHT | UTZNM_EXEMPLAR_LOCATION;
+    UnicodeString pacificBefore = findNames(*names, u"Pacific Standard Time", types, status);
+    assertTrue("Pacific Standard Time found", pacificBefore.length() > 0);
+    findNames(*names, u"Pacific Standard Time and more", types, status);
+    assertEquals("Pacific Standard Time after full load", pacificBefore,
+                 findNames(*names, u"Pacific Standard Time", types, status));
+
+    // A link ID is not part of the full load, and gets a location name from the ID.
+    assertEquals("Knox IN before load", u"", findNames(*names, u"Knox IN", types, status));
+    UnicodeString location;
+    names->getExemplarLocationName(u"America/Knox_IN", location);
+    assertEquals("America/Knox_IN location", u"Knox IN", location);
+    assertEquals("Knox IN", u" America/Knox_IN/" + UnicodeString((UChar)(0x30 + UTZNM_EXEMPLAR_LOCATION % 10)),
+                 findNames(*names, u"Knox IN", types, status));
+    assertEquals("Pacific Standard Time after later load", pacificBefore,
+                 findNames(*names, u"Pacific Standard Time", types, status));
+    assertSuccess("TimeZoneNames", status);
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
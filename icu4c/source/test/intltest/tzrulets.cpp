@@ -142,6 +142,7 @@ void TimeZoneRuleTest::runIndexedTest( int32_t index, UBool exec, const char* &n
         CASE(15, TestT6669);
         CASE(16, TestVTimeZoneWrapper);
         CASE(17, TestT8943);
+        CASE(18, TestOlsonOffsetIndex);
         default: name = ""; break;
     }
 }
@@ -2662,6 +2663,77 @@ TimeZoneRuleTest::TestT8943(void) {
     delete rbtz;
 }
 
+/*
+ * Check that the UTC offsets of Olson zones match their transitions, over
+ * enough lookups for the lazily built offset index to be used, and past the
+ * years it covers.
+ */
+void
+TimeZoneRuleTest::TestOlsonOffsetIndex(void) {
+    UDate start = getUTCMillis(1850, UCAL_JANUARY, 1);
+    UDate end = getUTCMillis(2250, UCAL_JANUARY, 1);
+
+    UErrorCode status = U_ZERO_ERROR;
+    TestZIDEnumeration tzenum(!quick);
+    while (TRUE) {
+        const UnicodeString *tzid = tzenum.snext(status);
+        if (tzid == NULL) {
+            break;
+        }
+        if (U_FAILURE(status)) {
+            errln("FAIL: error returned while enumerating timezone IDs.");
+            break;
+        }
+        BasicTimeZone *tz = (BasicTimeZone*)TimeZone::createTimeZone(*tzid);
+        TimeZoneTransition tzt, tzt0;
+        UBool first = TRUE;
+        UDate time = start;
+        while (tz->getNextTransition(time, FALSE, tzt) && tzt.getTime() < end) {
+            verifyOffsets(*tz, *tzt.getFrom(), first ? start : time, tzt.getTime());
+            tzt0 = tzt;
+            first = FALSE;
+            time = tzt.getTime();
+        }
+        if (!first) {
+            verifyOffsets(*tz, *tzt0.getTo(), time, end);
+        }
+        delete tz;
+    }
+}
+
+/*
+ * Check that the UTC offsets at several times in [start, end) are the
+ * offsets of the rule in effect there
+ */
+void
+TimeZoneRuleTest::verifyOffsets(BasicTimeZone& icutz, const TimeZoneRule& rule, UDate start, UDate end) {
+    UErrorCode status = U_ZERO_ERROR;
+    const UDate times[] = {
+        start,
+        start + (end - start) / 3,
+        start + (end - start) / 2,
+        end - HOUR,
+        end - 1
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(times); i++) {
+        if (times[i] < start) {
+            continue;
+        }
+        int32_t raw, dst;
+        icutz.getOffset(times[i], FALSE, raw, dst, status);
+        if (U_FAILURE(status)) {
+            errln("FAIL: Error in getOffset");
+            return;
+        }
+        if (raw != rule.getRawOffset() || dst != rule.getDSTSavings()) {
+            UnicodeString tzid;
+            errln((UnicodeString)"FAIL: Wrong offsets " + raw + "/" + dst + " at "
+                + dateToString(times[i]) + " for " + icutz.getID(tzid)
+                + " - expected " + rule.getRawOffset() + "/" + rule.getDSTSavings());
+        }
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
 //eof
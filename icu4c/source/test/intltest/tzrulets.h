@@ -40,9 +40,11 @@ class TimeZoneRuleTest : public CalendarTimeZoneTest {
     void TestT6669(void);
     void TestVTimeZoneWrapper(void);
     void TestT8943(void);
+    void TestOlsonOffsetIndex(void);
 
 private:
     void verifyTransitions(BasicTimeZone& icutz, UDate start, UDate end);
+    void verifyOffsets(BasicTimeZone& icutz, const TimeZoneRule& rule, UDate start, UDate end);
     void compareTransitionsAscending(BasicTimeZone& z1, BasicTimeZone& z2,
         UDate start, UDate end, UBool inclusive);
     void compareTransitionsDescending(BasicTimeZone& z1, BasicTimeZone& z2,
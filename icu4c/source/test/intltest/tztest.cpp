@@ -12,6 +12,7 @@
 
 #include "unicode/timezone.h"
 #include "unicode/simpletz.h"
+#include "unicode/rbtz.h"
 #include "unicode/calendar.h"
 #include "unicode/gregocal.h"
 #include "unicode/resbund.h"
@@ -23,6 +24,9 @@
 #include "cstring.h"
 #include "olsontz.h"
 
+#include <algorithm>
+#include <vector>
+
 #define CASE(id,test) case id:                               \
                           name = #test;                      \
                           if (exec) {                        \
@@ -75,6 +79,8 @@ void TimeZoneTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestGetGMT);
     TESTCASE_AUTO(TestGetWindowsID);
     TESTCASE_AUTO(TestGetIDForWindowsID);
+    TESTCASE_AUTO(TestGetOffsets);
+    TESTCASE_AUTO(TestSharedSystemZones);
     TESTCASE_AUTO_END;
 }
 
@@ -2492,4 +2498,161 @@ void TimeZoneTest::TestGetIDForWindowsID(void) {
     }
 }
 
+/*
+ * BasicTimeZone::getOffsets() and getOffsetsFromLocal() must return the same
+ * offsets as getOffset() and getOffsetFromLocal() for each time.
+ */
+void TimeZoneTest::TestGetOffsets(void) {
+    static const char *ZONES[] = {
+        "America/New_York",
+        "Europe/London",
+        "Australia/Lord_Howe",  // 30 minute DST
+        "Pacific/Apia",         // skipped a day in 2011
+        "America/Sao_Paulo",    // DST ended in 2019
+        "Asia/Tokyo",
+        0
+    };
+    for (int32_t i = 0; ZONES[i] != 0; i++) {
+        LocalPointer<BasicTimeZone> tz((BasicTimeZone*)TimeZone::createTimeZone(ZONES[i]));
+        checkGetOffsets(*tz);
+    }
+
+    UErrorCode status = U_ZERO_ERROR;
+    SimpleTimeZone stz(-5*U_MILLIS_PER_HOUR, "SimpleUS",
+        UCAL_MARCH, 2, UCAL_SUNDAY, 2*U_MILLIS_PER_HOUR,
+        UCAL_NOVEMBER, 1, UCAL_SUNDAY, 2*U_MILLIS_PER_HOUR, status);
+    if (U_FAILURE(status)) {
+        errln("FAIL: Couldn't create SimpleTimeZone");
+        return;
+    }
+    checkGetOffsets(stz);
+
+    // A RuleBasedTimeZone with the rules of a historical zone
+    LocalPointer<BasicTimeZone> olson((BasicTimeZone*)TimeZone::createTimeZone("Europe/Paris"));
+    int32_t ruleCount = olson->countTransitionRules(status);
+    const InitialTimeZoneRule *initial;
+    LocalArray<const TimeZoneRule *> trsrules(new const TimeZoneRule*[ruleCount]);
+    olson->getTimeZoneRules(initial, trsrules.getAlias(), ruleCount, status);
+    RuleBasedTimeZone rbtz("RBTZ Europe/Paris", initial->clone());
+    for (int32_t i = 0; i < ruleCount; i++) {
+        rbtz.addTransitionRule(trsrules[i]->clone(), status);
+    }
+    rbtz.complete(status);
+    if (U_FAILURE(status)) {
+        errln("FAIL: Couldn't create RuleBasedTimeZone");
+        return;
+    }
+    checkGetOffsets(rbtz);
+}
+
+void TimeZoneTest::checkGetOffsets(const BasicTimeZone& tz) {
+    UnicodeString id;
+    tz.getID(id);
+
+    // Sorted times from 1900 to 2060, including the times right around
+    // each transition in UTC and in local time.
+    std::vector<UDate> dates;
+    UDate start = -2208988800000.0;  // 1900-01-01T00:00Z
+    UDate end = 2840140800000.0;     // 2060-01-01T00:00Z
+    for (UDate d = start; d < end; d += U_MILLIS_PER_DAY + 197 * 60 * 1000) {
+        dates.push_back(d);
+    }
+    TimeZoneTransition tzt;
+    UDate t = start;
+    while (tz.getNextTransition(t, FALSE, tzt) && tzt.getTime() < end) {
+        t = tzt.getTime();
+        int32_t before = tzt.getFrom()->getRawOffset() + tzt.getFrom()->getDSTSavings();
+        int32_t after = tzt.getTo()->getRawOffset() + tzt.getTo()->getDSTSavings();
+        const UDate around[] = { t - 1, t, t + 1, t + before - 1, t + before, t + after - 1, t + after };
+        dates.insert(dates.end(), around, around + UPRV_LENGTHOF(around));
+    }
+    std::sort(dates.begin(), dates.end());
+    int32_t count = (int32_t)dates.size();
+
+    std::vector<int32_t> raw(count), dst(count);
+    for (int32_t pass = 0; pass < 2; pass++) {
+        if (pass == 1) {
+            // Unsorted input must work, too.
+            std::reverse(dates.begin(), dates.end());
+        }
+        UErrorCode status = U_ZERO_ERROR;
+        tz.getOffsets(dates.data(), count, raw.data(), dst.data(), status);
+        if (!assertSuccess(id + " getOffsets", status)) {
+            return;
+        }
+        for (int32_t i = 0; i < count; i++) {
+            int32_t expRaw, expDst;
+            tz.getOffset(dates[i], FALSE, expRaw, expDst, status);
+            if (raw[i] != expRaw || dst[i] != expDst) {
+                errln(UnicodeString("FAIL: getOffsets for ") + id + " at " + dates[i] + ": "
+                    + raw[i] + "/" + dst[i] + ", expected " + expRaw + "/" + expDst);
+                break;
+            }
+        }
+
+        static const UTimeZoneLocalOption OPTIONS[][2] = {
+            {UCAL_TZ_LOCAL_FORMER, UCAL_TZ_LOCAL_LATTER},
+            {UCAL_TZ_LOCAL_LATTER, UCAL_TZ_LOCAL_FORMER},
+            {UCAL_TZ_LOCAL_STANDARD_FORMER, UCAL_TZ_LOCAL_DAYLIGHT_LATTER},
+            {UCAL_TZ_LOCAL_DAYLIGHT_LATTER, UCAL_TZ_LOCAL_STANDARD_FORMER},
+        };
+        for (int32_t opt = 0; opt < UPRV_LENGTHOF(OPTIONS); opt++) {
+            tz.getOffsetsFromLocal(dates.data(), count, OPTIONS[opt][0], OPTIONS[opt][1],
+                raw.data(), dst.data(), status);
+            if (!assertSuccess(id + " getOffsetsFromLocal", status)) {
+                return;
+            }
+            for (int32_t i = 0; i < count; i++) {
+                int32_t expRaw, expDst;
+                tz.getOffsetFromLocal(dates[i], OPTIONS[opt][0], OPTIONS[opt][1], expRaw, expDst, status);
+                if (raw[i] != expRaw || dst[i] != expDst) {
+                    errln(UnicodeString("FAIL: getOffsetsFromLocal for ") + id + " at " + dates[i]
+                        + " with options " + opt + ": " + raw[i] + "/" + dst[i]
+                        + ", expected " + expRaw + "/" + expDst);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void TimeZoneTest::TestSharedSystemZones(void) {
+    // System zones are created from cached data. Every instance must still
+    // be independent of the others.
+    static const char* const IDS[] = {"America/Los_Angeles", "US/Pacific", "Europe/Berlin", "Asia/Tokyo"};
+    UDate date = 1593561600000.0; // 2020-07-01T00:00:00Z
+    for (int32_t i = 0; i < UPRV_LENGTHOF(IDS); i++) {
+        UnicodeString id(IDS[i], -1, US_INV);
+        LocalPointer<TimeZone> tz1(TimeZone::createTimeZone(id));
+        LocalPointer<TimeZone> tz2(TimeZone::createTimeZone(id));
+        UnicodeString id1, id2;
+        assertEquals("zone ID", id, tz1->getID(id1));
+        assertEquals("zone ID of second instance", id, tz2->getID(id2));
+        assertTrue(id + " instances are distinct", tz1.getAlias() != tz2.getAlias());
+        assertTrue(id + " instances are equal", *tz1 == *tz2);
+
+        UErrorCode status = U_ZERO_ERROR;
+        int32_t raw = tz2->getRawOffset();
+        int32_t expRaw, expDst;
+        tz2->getOffset(date, FALSE, expRaw, expDst, status);
+        tz1->setRawOffset(raw + U_MILLIS_PER_HOUR);
+        tz1->setID(UNICODE_STRING_SIMPLE("Test/Modified"));
+        LocalPointer<TimeZone> tz3(TimeZone::createTimeZone(id));
+        UnicodeString id3;
+        assertEquals("zone ID after modifying another instance", id, tz3->getID(id3));
+        assertEquals(id + " raw offset after modifying another instance", raw, tz3->getRawOffset());
+        int32_t raw3, dst3;
+        tz3->getOffset(date, FALSE, raw3, dst3, status);
+        assertSuccess("getOffset", status);
+        assertEquals(id + " offset after modifying another instance", expRaw + expDst, raw3 + dst3);
+    }
+
+    // Unknown IDs still fall back to Etc/Unknown, also when asked again.
+    for (int32_t i = 0; i < 2; i++) {
+        LocalPointer<TimeZone> unknown(TimeZone::createTimeZone(UNICODE_STRING_SIMPLE("Bogus/Zone")));
+        UnicodeString unknownID;
+        assertEquals("unknown zone", UNICODE_STRING_SIMPLE("Etc/Unknown"), unknown->getID(unknownID));
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
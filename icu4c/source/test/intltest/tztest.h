@@ -104,6 +104,11 @@ class TimeZoneTest: public CalendarTimeZoneTest {
     void TestGetWindowsID(void);
     void TestGetIDForWindowsID(void);
 
+    void TestGetOffsets(void);
+    void checkGetOffsets(const BasicTimeZone& tz);
+
+    void TestSharedSystemZones(void);
+
     static const UDate INTERVAL;
 
 private:
@@ -60,6 +60,14 @@ UPerfFunction* DateFormatPerfTest::runIndexedTest(int32_t index, UBool exec,cons
         TESTCASE(22,DateFmtCopy10000);
         TESTCASE(23,DateFmtCreate250);
         TESTCASE(24,DateFmtCreate10000);
+        TESTCASE(25,DateFmtISO250);
+        TESTCASE(26,DateFmtISO10000);
+        TESTCASE(27,DateFmtLog250);
+        TESTCASE(28,DateFmtLog10000);
+        TESTCASE(29,DateFmtLogStream250);
+        TESTCASE(30,DateFmtLogStream10000);
+        TESTCASE(31,DateParseISO250);
+        TESTCASE(32,DateParseISO10000);
 
 
         default: 
@@ -176,6 +184,39 @@ UPerfFunction* DateFormatPerfTest::DateFmtCopy10000(){
     return new DateFmtCopyFunction(10000, locale);
 }
 
+UPerfFunction* DateFormatPerfTest::DateFmtISO250(){
+    return new DateFmtPatternFunction(1, locale, u"yyyy-MM-dd'T'HH:mm:ss.SSS");
+}
+
+UPerfFunction* DateFormatPerfTest::DateFmtISO10000(){
+    return new DateFmtPatternFunction(40, locale, u"yyyy-MM-dd'T'HH:mm:ss.SSS");
+}
+
+UPerfFunction* DateFormatPerfTest::DateFmtLog250(){
+    return new DateFmtPatternFunction(1, locale, u"EEE, dd MMM yyyy HH:mm:ss");
+}
+
+UPerfFunction* DateFormatPerfTest::DateFmtLog10000(){
+    return new DateFmtPatternFunction(40, locale, u"EEE, dd MMM yyyy HH:mm:ss");
+}
+
+UPerfFunction* DateFormatPerfTest::DateFmtLogStream250(){
+    // 2020-06-01T12:00Z
+    return new DateFmtPatternFunction(1, locale, u"EEE, dd MMM yyyy HH:mm:ss", "America/New_York", 1591012800000.0);
+}
+
+UPerfFunction* DateFormatPerfTest::DateFmtLogStream10000(){
+    return new DateFmtPatternFunction(40, locale, u"EEE, dd MMM yyyy HH:mm:ss", "America/New_York", 1591012800000.0);
+}
+
+UPerfFunction* DateFormatPerfTest::DateParseISO250(){
+    return new DateParsePatternFunction(1, locale, u"yyyy-MM-dd'T'HH:mm:ss.SSSXXX");
+}
+
+UPerfFunction* DateFormatPerfTest::DateParseISO10000(){
+    return new DateParsePatternFunction(40, locale, u"yyyy-MM-dd'T'HH:mm:ss.SSSXXX");
+}
+
 UPerfFunction* DateFormatPerfTest::DateFmtCreate250(){
     return new DateFmtCreateFunction(250, locale);
 }
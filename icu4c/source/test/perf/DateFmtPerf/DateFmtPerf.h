@@ -21,6 +21,7 @@
 #include "unicode/dtitvfmt.h"
 #include "unicode/utypes.h"
 #include "unicode/datefmt.h"
+#include "unicode/smpdtfmt.h"
 #include "unicode/calendar.h"
 #include "unicode/uclean.h"
 #include "unicode/brkiter.h"
@@ -236,6 +237,141 @@ class DateFmtFunction : public UPerfFunction
 
 };
 
+// Formats timestamps with a fixed pattern, as for log lines.
+class DateFmtPatternFunction : public UPerfFunction
+{
+
+private:
+        int num;
+        SimpleDateFormat *fmt;
+        UDate dates[250];
+public:
+
+        DateFmtPatternFunction(int a, const char* loc, const char16_t* pattern)
+        {
+                num = a;
+                UErrorCode status2 = U_ZERO_ERROR;
+                fmt = new SimpleDateFormat(UnicodeString(pattern), Locale(loc), status2);
+                check(status2, "SimpleDateFormat()");
+                fmt->adoptTimeZone(TimeZone::createTimeZone("GMT"));
+                Calendar *cal = Calendar::createInstance(TimeZone::createTimeZone("GMT"), status2);
+                check(status2, "Calendar::createInstance");
+                // (dates are imported from datedata.h), at different times of day
+                for(int i = 0; i < NUM_DATES; i++) {
+                    cal->clear();
+                    cal->set(years[i], months[i], days[i], i % 24, (i * 7) % 60, (i * 13) % 60);
+                    dates[i] = cal->getTime(status2) + i;
+                }
+                check(status2, "Calendar::getTime");
+                delete cal;
+        }
+
+        // Consecutive timestamps, as in a log file: every 5m47.123s
+        // starting at the given time in the given zone, spanning one midnight.
+        DateFmtPatternFunction(int a, const char* loc, const char16_t* pattern, const char* zone, UDate start)
+        {
+                num = a;
+                UErrorCode status2 = U_ZERO_ERROR;
+                fmt = new SimpleDateFormat(UnicodeString(pattern), Locale(loc), status2);
+                check(status2, "SimpleDateFormat()");
+                fmt->adoptTimeZone(TimeZone::createTimeZone(zone));
+                for(int i = 0; i < NUM_DATES; i++) {
+                    dates[i] = start + i * 347123.0;
+                }
+        }
+
+        ~DateFmtPatternFunction()
+        {
+                delete fmt;
+        }
+
+        virtual void call(UErrorCode* status)
+        {
+                UnicodeString str;
+                for(int j = 0; j < num; j++) {
+                    for(int i = 0; i < NUM_DATES; i++) {
+                        str.remove();
+                        fmt->format(dates[i], str);
+                    }
+                }
+                if (str.isBogus()) {
+                    *status = U_MEMORY_ALLOCATION_ERROR;
+                }
+        }
+
+        virtual long getOperationsPerIteration()
+        {
+                return NUM_DATES * num;
+        }
+
+        // Verify that a UErrorCode is successful; exit(1) if not
+        void check(UErrorCode& status, const char* msg) {
+                if (U_FAILURE(status)) {
+                        printf("ERROR: %s (%s)\n", u_errorName(status), msg);
+                        exit(1);
+                }
+        }
+
+};
+
+// Parses timestamps with a fixed numeric pattern, such as ISO 8601 ones.
+class DateParsePatternFunction : public UPerfFunction
+{
+
+private:
+        int num;
+        SimpleDateFormat *fmt;
+        UnicodeString texts[250];
+public:
+
+        DateParsePatternFunction(int a, const char* loc, const char16_t* pattern)
+        {
+                num = a;
+                UErrorCode status2 = U_ZERO_ERROR;
+                fmt = new SimpleDateFormat(UnicodeString(pattern), Locale(loc), status2);
+                check(status2, "SimpleDateFormat()");
+                fmt->adoptTimeZone(TimeZone::createTimeZone("GMT"));
+                Calendar *cal = Calendar::createInstance(TimeZone::createTimeZone("GMT"), status2);
+                check(status2, "Calendar::createInstance");
+                // (dates are imported from datedata.h), at different times of day
+                for(int i = 0; i < NUM_DATES; i++) {
+                    cal->clear();
+                    cal->set(years[i], months[i], days[i], i % 24, (i * 7) % 60, (i * 13) % 60);
+                    fmt->format(cal->getTime(status2) + i, texts[i]);
+                }
+                check(status2, "Calendar::getTime");
+                delete cal;
+        }
+
+        ~DateParsePatternFunction()
+        {
+                delete fmt;
+        }
+
+        virtual void call(UErrorCode* status)
+        {
+                for(int j = 0; j < num; j++) {
+                    for(int i = 0; i < NUM_DATES; i++) {
+                        fmt->parse(texts[i], *status);
+                    }
+                }
+        }
+
+        virtual long getOperationsPerIteration()
+        {
+                return NUM_DATES * num;
+        }
+
+        // Verify that a UErrorCode is successful; exit(1) if not
+        void check(UErrorCode& status, const char* msg) {
+                if (U_FAILURE(status)) {
+                        printf("ERROR: %s (%s)\n", u_errorName(status), msg);
+                        exit(1);
+                }
+        }
+
+};
+
 class DateFmtCreateFunction : public UPerfFunction
 {
 
@@ -826,6 +962,14 @@ class DateFormatPerfTest : public UPerfTest
 	UPerfFunction* DateFmtCreate10000();
 	UPerfFunction* DateFmtCopy250();
 	UPerfFunction* DateFmtCopy10000();
+	UPerfFunction* DateFmtISO250();
+	UPerfFunction* DateFmtISO10000();
+	UPerfFunction* DateFmtLog250();
+	UPerfFunction* DateFmtLog10000();
+	UPerfFunction* DateFmtLogStream250();
+	UPerfFunction* DateFmtLogStream10000();
+	UPerfFunction* DateParseISO250();
+	UPerfFunction* DateParseISO10000();
 	UPerfFunction* BreakItWord250();
 	UPerfFunction* BreakItWord10000();
 	UPerfFunction* BreakItChar250();
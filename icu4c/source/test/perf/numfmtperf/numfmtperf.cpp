@@ -0,0 +1,237 @@
+// © 2020 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+ *  file name:  numfmtperf.cpp
+ *  encoding:   UTF-8
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  Performance test program for the conversion of doubles in number formatting:
+ *  the shortest decimal representation of a double, and the double value of a
+ *  decimal number, compared with the double-conversion library.
+ *
+ * Usage from within <ICU build tree>/test/perf/numfmtperf/ :
+ * (Linux)
+ *  make
+ *  export LD_LIBRARY_PATH=../../../lib:../../../stubdata:../../../tools/ctestfw
+ *  ./numfmtperf --passes 3 --iterations 100
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "unicode/numberformatter.h"
+#include "unicode/uperf.h"
+#include "cmemory.h"
+#include "double-conversion.h"
+#include "number_decimalquantity.h"
+#include "toolutil.h"
+
+using icu::double_conversion::DoubleToStringConverter;
+using icu::double_conversion::StringToDoubleConverter;
+using icu::number::LocalizedNumberFormatter;
+using icu::number::NumberFormatter;
+using icu::number::Precision;
+using icu::number::impl::DecimalQuantity;
+
+static const int32_t kNumDoubles = 1000;
+
+// Test object.
+class NumberFormatPerfTest : public UPerfTest {
+public:
+    NumberFormatPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, NULL, 0, "", status) {
+        // Half of the doubles come from decimal data, like prices and measurements,
+        // the others are any finite doubles.
+        uint64_t seed = 20200601;
+        int32_t count = 0;
+        while (count < kNumDoubles) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            double d;
+            if ((count & 1) == 0) {
+                uint64_t bits = seed >> 11;
+                d = (double)(bits % 10000000) / pow(10.0, (double)(bits % 7));
+            } else {
+                uprv_memcpy(&d, &seed, sizeof(d));
+                d = fabs(d);
+            }
+            if (d != d || d < 1e-9 || d > 1e15) {
+                continue;
+            }
+            doubles[count] = d;
+            // The shortest decimal strings, to be converted back to doubles.
+            char buffer[DoubleToStringConverter::kBase10MaximalLength + 1];
+            bool sign;
+            int32_t length;
+            int32_t point;
+            DoubleToStringConverter::DoubleToAscii(
+                d, DoubleToStringConverter::SHORTEST, 0,
+                buffer, sizeof(buffer), &sign, &length, &point);
+            snprintf(decimals[count], sizeof(decimals[count]), "%.*sE%d",
+                     (int)length, buffer, (int)(point - length));
+            quantities[count].setToDecNumber(decimals[count], status);
+            ++count;
+        }
+    }
+
+    virtual UPerfFunction *runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=NULL);
+
+    double doubles[kNumDoubles];
+    char decimals[kNumDoubles][32];
+    DecimalQuantity quantities[kNumDoubles];
+};
+
+class DoubleFunction : public UPerfFunction {
+public:
+    DoubleFunction(const NumberFormatPerfTest &perfTest) : perf(perfTest), checksum(0) {}
+    virtual ~DoubleFunction() {
+        // Print the checksum so that the work is not optimized away.
+        fprintf(stderr, "checksum: %ld\n", (long)checksum);
+    }
+    virtual long getOperationsPerIteration() { return kNumDoubles; }
+protected:
+    const NumberFormatPerfTest &perf;
+    int64_t checksum;
+};
+
+// Shortest digits of each double, with double-conversion.
+class DoubleToAscii : public DoubleFunction {
+public:
+    DoubleToAscii(const NumberFormatPerfTest &perfTest) : DoubleFunction(perfTest) {}
+    virtual void call(UErrorCode * /*pErrorCode*/) {
+        for (int32_t i = 0; i < kNumDoubles; ++i) {
+            char buffer[DoubleToStringConverter::kBase10MaximalLength + 1];
+            bool sign;
+            int32_t length;
+            int32_t point;
+            DoubleToStringConverter::DoubleToAscii(
+                perf.doubles[i], DoubleToStringConverter::SHORTEST, 0,
+                buffer, sizeof(buffer), &sign, &length, &point);
+            checksum += length + point;
+        }
+    }
+};
+
+// Shortest digits of each double, with DecimalQuantity.
+class DecimalQuantityShortest : public DoubleFunction {
+public:
+    DecimalQuantityShortest(const NumberFormatPerfTest &perfTest) : DoubleFunction(perfTest) {}
+    virtual void call(UErrorCode * /*pErrorCode*/) {
+        DecimalQuantity dq;
+        for (int32_t i = 0; i < kNumDoubles; ++i) {
+            dq.setToDouble(perf.doubles[i]);
+            dq.roundToInfinity();
+            checksum += dq.getMagnitude();
+        }
+    }
+};
+
+// Each double formatted with all of its digits.
+class FormatDoubleUnlimited : public DoubleFunction {
+public:
+    FormatDoubleUnlimited(const NumberFormatPerfTest &perfTest, UErrorCode &status)
+            : DoubleFunction(perfTest),
+              formatter(NumberFormatter::withLocale("en").precision(Precision::unlimited())) {
+        // Compile the formatter before the timing starts.
+        formatter.formatDouble(1.5, status);
+        formatter.formatDouble(1.5, status);
+        formatter.formatDouble(1.5, status);
+    }
+    virtual void call(UErrorCode *pErrorCode) {
+        char16_t buffer[64];  // Enough for the range of the doubles
+        for (int32_t i = 0; i < kNumDoubles; ++i) {
+            checksum += formatter.formatDouble(perf.doubles[i], buffer, UPRV_LENGTHOF(buffer), *pErrorCode);
+        }
+    }
+private:
+    LocalizedNumberFormatter formatter;
+};
+
+// Double value of each shortest decimal string, with double-conversion.
+class StringToDouble : public DoubleFunction {
+public:
+    StringToDouble(const NumberFormatPerfTest &perfTest) : DoubleFunction(perfTest) {}
+    virtual void call(UErrorCode * /*pErrorCode*/) {
+        StringToDoubleConverter converter(0, 0, 0, "", "");
+        for (int32_t i = 0; i < kNumDoubles; ++i) {
+            int32_t count;
+            const char *decimal = perf.decimals[i];
+            double d = converter.StringToDouble(decimal, (int)strlen(decimal), &count);
+            checksum += d == perf.doubles[i];
+        }
+    }
+};
+
+// Double value of each shortest decimal, with DecimalQuantity, as in number parsing.
+class DecimalQuantityToDouble : public DoubleFunction {
+public:
+    DecimalQuantityToDouble(const NumberFormatPerfTest &perfTest) : DoubleFunction(perfTest) {}
+    virtual void call(UErrorCode * /*pErrorCode*/) {
+        for (int32_t i = 0; i < kNumDoubles; ++i) {
+            double d = perf.quantities[i].toDouble();
+            checksum += d == perf.doubles[i];
+        }
+    }
+};
+
+UPerfFunction *NumberFormatPerfTest::runIndexedTest(int32_t index, UBool exec,
+                                                    const char *&name, char * /*par*/) {
+    switch(index) {
+    case 0:
+        name="DoubleToAscii";
+        if(exec) {
+            return new DoubleToAscii(*this);
+        }
+        break;
+    case 1:
+        name="DecimalQuantityShortest";
+        if(exec) {
+            return new DecimalQuantityShortest(*this);
+        }
+        break;
+    case 2:
+        name="FormatDoubleUnlimited";
+        if(exec) {
+            IcuToolErrorCode errorCode("FormatDoubleUnlimited()");
+            UPerfFunction *func=new FormatDoubleUnlimited(*this, errorCode);
+            if(errorCode.isFailure()) {
+                fprintf(stderr, "FormatDoubleUnlimited() failed: %s\n", errorCode.errorName());
+                delete func;
+                return NULL;
+            }
+            return func;
+        }
+        break;
+    case 3:
+        name="StringToDouble";
+        if(exec) {
+            return new StringToDouble(*this);
+        }
+        break;
+    case 4:
+        name="DecimalQuantityToDouble";
+        if(exec) {
+            return new DecimalQuantityToDouble(*this);
+        }
+        break;
+    default:
+        name="";
+        break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[]) {
+    IcuToolErrorCode errorCode("numfmtperf main()");
+    NumberFormatPerfTest test(argc, argv, errorCode);
+    if(errorCode.isFailure()) {
+        fprintf(stderr, "NumberFormatPerfTest() failed: %s\n", errorCode.errorName());
+        test.usage();
+        return errorCode.reset();
+    }
+    if(!test.run()) {
+        fprintf(stderr, "FAILED: Tests could not be run, please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}